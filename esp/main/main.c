@@ -20,6 +20,7 @@
 #include "core/services/players/manager.h"
 #include "core/services/leds/leds.h"
 #include "core/services/storage/storage.h"
+#include "core/services/loadgen/loadgen.h"
 
 static const char *TAG = "joypad";
 
@@ -129,6 +130,12 @@ void app_main(void)
             ESP_LOGI(TAG, "Initializing input: %s", inputs[i]->name);
             inputs[i]->init();
         }
+        // Init is synchronous here; record it for the bring-up report
+        input_bringup_t* st = app_registry_input_bringup(i);
+        if (st) {
+            st->ready = true;
+            st->ready_ms = platform_time_ms();
+        }
     }
 
     // Clear any stale USB persist flags from a previous DFU/bootloader attempt
@@ -175,6 +182,7 @@ void app_main(void)
         leds_task();
         players_task();
         storage_task();
+        loadgen_task();  // Synthetic input load (idle unless started over CDC)
 
         // Poll input interfaces
         for (uint8_t i = 0; i < input_count; i++) {
@@ -193,6 +193,23 @@ static bool max3421_probe(void)
     return true;
 }
 
+// Oscillator bring-up, polled from the USB host init stage (see usbh.c)
+#define MAX3421_REG_USBIRQ   13
+#define MAX3421_REG_USBCTL   15
+#define MAX3421_OSCOKIRQ     0x01
+#define MAX3421_CHIPRES      0x20
+
+void max3421_host_start_osc(void)
+{
+    max3421_reg_write(MAX3421_REG_USBCTL, MAX3421_CHIPRES);
+    max3421_reg_write(MAX3421_REG_USBCTL, 0);
+}
+
+bool max3421_host_osc_ok(void)
+{
+    return (max3421_reg_read(MAX3421_REG_USBIRQ) & MAX3421_OSCOKIRQ) != 0;
+}
+
 // ============================================================================
 // INITIALIZATION
 // ============================================================================
@@ -7,10 +7,16 @@
 // returning canned bytes (the bug that wasted hours of debugging).
 //
 // On top of that, we run eyes_anim in the VBlank slot. The main loop's
-// ResetHalt() halts the CPU until the next VBlank IRQ fires. libgba's
-// IRQ dispatcher invokes our installed handler (which advances and
-// renders the eyes), then ResetHalt returns and we write
-// REG_JOYTR = REG_KEYINPUT — exactly as Doridian does.
+// ResetHalt() halts the CPU until the next IRQ fires. libgba's IRQ
+// dispatcher invokes our installed handler (which advances and renders
+// the eyes), then ResetHalt returns and we refresh JOYTR from
+// KEYINPUT — as Doridian does.
+//
+// After the handshake JOYTR is also refreshed from a keypad IRQ (press
+// edges) and a ~2 kHz timer IRQ (releases + everything else), so the
+// host sees KEYINPUT at most ~0.5 ms old instead of up to one VBlank.
+// Each refresh stamps a sample counter into the upper JOYTR bytes that
+// only moves when KEYINPUT changes — see joytr_refresh().
 
 #include <gba_console.h>
 #include <gba_video.h>
@@ -18,6 +24,7 @@
 #include <gba_systemcalls.h>
 #include <gba_input.h>
 #include <gba_sio.h>
+#include <gba_timers.h>
 #include <stdint.h>
 
 #include "display.h"
@@ -109,6 +116,42 @@ void ResetHalt() {
 static volatile uint32_t vblank_count = 0;
 static volatile bool     frame_ready  = false;
 
+// JOYTR sample stamp. Lower 16 bits stay KEYINPUT (what every host
+// decoder reads); byte 2 is a rolling counter bumped whenever KEYINPUT
+// differs from the last published value and byte 3 is its complement,
+// so the host can skip samples with nothing new and tell this payload
+// apart from older ones that leave the upper bytes zero (see
+// gba_input_seq()). joytr_keys starts outside KEYINPUT's 10 bits so the
+// first refresh always bumps.
+static uint8_t  joytr_seq = 0;
+static uint16_t joytr_keys = 0xFFFF;
+
+// Keypad sampling timer: Timer 3 at 1/1 prescale (16.78 MHz), reload for
+// ~2 kHz. Faster than any joybus poll rate the host uses, cheap enough
+// that the eyes render doesn't notice.
+#define JOYTR_TIMER_HZ      2000
+#define JOYTR_TIMER_RELOAD  (65536 - (16777216 / JOYTR_TIMER_HZ))
+
+// Called from IRQ handlers and the main loop. JOYTR is rewritten on every
+// call so the cable always sees a refilled register, but the counter only
+// moves with KEYINPUT. IME is masked so a timer IRQ landing mid-write
+// can't publish the same keys under two sequence numbers.
+static void joytr_refresh(void)
+{
+    uint16_t ime = REG_IME;
+    REG_IME = 0;
+    uint16_t keys = REG_KEYINPUT;
+    if (keys != joytr_keys) {
+        joytr_keys = keys;
+        joytr_seq++;
+    }
+    uint8_t seq = joytr_seq;
+    REG_JOYTR = (uint32_t)keys
+              | ((uint32_t)seq << 16)
+              | ((uint32_t)(uint8_t)~seq << 24);
+    REG_IME = ime;
+}
+
 uint32_t platform_time_ms(void)
 {
     return vblank_count * 17;
@@ -128,7 +171,7 @@ static void on_vblank_pre_handshake(void)
 // loop's own JOYTR write out by 10+ ms.
 static void on_vblank(void)
 {
-    REG_JOYTR = REG_KEYINPUT;
+    joytr_refresh();
     vblank_count++;
     if (frame_ready) {
         display_flip_page();
@@ -136,6 +179,34 @@ static void on_vblank(void)
     }
 }
 
+// Keypad IRQ (any key pressed) and sampling timer: publish the new
+// KEYINPUT immediately rather than waiting for the next VBlank. The
+// keypad IRQ only fires on press; the timer catches releases.
+static void on_keypad(void)
+{
+    joytr_refresh();
+}
+
+static void on_joytr_timer(void)
+{
+    joytr_refresh();
+}
+
+// Installed only after the handshake — like on_vblank, an earlier JOYTR
+// write would clobber the 0x30303030 handshake value.
+static void start_keypad_sampling(void)
+{
+    REG_KEYCNT = KEYIRQ_ENABLE | KEYIRQ_OR | 0x03FF;  // any of the 10 keys
+    irqSet(IRQ_KEYPAD, on_keypad);
+    irqEnable(IRQ_KEYPAD);
+
+    REG_TM3CNT_H = 0;
+    REG_TM3CNT_L = JOYTR_TIMER_RELOAD;
+    irqSet(IRQ_TIMER3, on_joytr_timer);
+    irqEnable(IRQ_TIMER3);
+    REG_TM3CNT_H = TIMER_START | TIMER_IRQ;
+}
+
 // Sleep cycle — three-phase machine driven by quiet time:
 //   Phase 0 ACTIVE  : input within IDLE_TO_WANDER_MS. Renders ACTIVE eyes.
 //   Phase 1 WANDER  : after IDLE_TO_WANDER_MS quiet, eyes drift via IDLE
@@ -275,7 +346,7 @@ static void run_splash(joypad_mode_id_t splash_mode) {
     uint32_t hold_until = vblank_count + SPLASH_FRAMES;
     while (vblank_count < hold_until) {
         ResetHalt();
-        REG_JOYTR = REG_KEYINPUT;
+        joytr_refresh();
     }
 
     if (used_image_mode) {
@@ -332,8 +403,10 @@ int main(void) {
 
     // Handshake done — swap to the JOYTR-refreshing handler so the host
     // sees fresh KEYINPUT bits at 60 Hz even when a long render extends
-    // the main loop iteration past one VBlank.
+    // the main loop iteration past one VBlank, then start the keypad/timer
+    // IRQs that refresh it between VBlanks.
     irqSet(IRQ_VBLANK, on_vblank);
+    start_keypad_sampling();
 
     // ────────────────────────────────────────────────────────────────
     // Boot splash — show a mode badge for ~SPLASH_FRAMES frames so the
@@ -355,10 +428,10 @@ int main(void) {
     // starts from t=0 here, not from when eyes_anim_init() ran.
     eyes_anim_event(EYES_EVENT_BOOT);
 
-    // Input loop — Doridian's structure verbatim. ResetHalt halts CPU
-    // until VBlank, our handler renders the eyes (added on top of the
-    // upstream payload), then we write JOYTR. Each iteration also
-    // checks JOY_RECV for a host splash command (mode-change signal).
+    // Input loop — Doridian's structure. ResetHalt halts CPU until the
+    // next IRQ (VBlank, keypad or sampling timer), then we refresh JOYTR.
+    // Rendering stays gated on VBlank below. Each iteration also checks
+    // JOY_RECV for a host splash command (mode-change signal).
     uint32_t last_render_vblank = 0;
     eyes_state_t last_state = EYES_STATE_COUNT;  // sentinel: forces 1st update
     // Edge-trigger on JOY_RECV changes — the cable's handshake leaves
@@ -367,7 +440,7 @@ int main(void) {
     uint32_t last_recv = REG_JOYRE;
     while (1) {
         ResetHalt();
-        REG_JOYTR = REG_KEYINPUT;
+        joytr_refresh();
 
         // Host splash command channel — see gba_send_splash_cmd in
         // src/native/host/gc/gba_multiboot.c. Host sends a 4-byte
@@ -23,6 +23,7 @@
 #include "core/services/players/manager.h"
 #include "core/services/leds/leds.h"
 #include "core/services/storage/storage.h"
+#include "core/services/loadgen/loadgen.h"
 
 // App layer
 extern void app_init(void);
@@ -189,6 +190,12 @@ int main(void)
             printf("[joypad] Initializing input: %s\n", inputs[i]->name);
             inputs[i]->init();
         }
+        // Init is synchronous here; record it for the bring-up report
+        input_bringup_t* st = app_registry_input_bringup(i);
+        if (st) {
+            st->ready = true;
+            st->ready_ms = platform_time_ms();
+        }
     }
 
     // Get and initialize output interfaces
@@ -248,6 +255,7 @@ int main(void)
         leds_task();
         players_task();
         storage_task();
+        loadgen_task();  // Synthetic input load (idle unless started over CDC)
 
         // Poll input interfaces
         for (uint8_t i = 0; i < input_count; i++) {
@@ -97,13 +97,17 @@ static const profile_config_t app_profile_config = {
 // APP INPUT INTERFACES
 // ============================================================================
 
-// BT2GC has no InputInterface - BT transport handles input internally
-// via bthid drivers that call router_submit_input()
+// Bluetooth input: bthid drivers call router_submit_input(); the interface
+// brings the transport up from the main loop and runs bt_task()
+
+static const InputInterface* input_interfaces[] = {
+    &bt_input_interface,
+};
 
 const InputInterface** app_get_input_interfaces(uint8_t* count)
 {
-    *count = 0;
-    return NULL;
+    *count = sizeof(input_interfaces) / sizeof(input_interfaces[0]);
+    return input_interfaces;
 }
 
 // ============================================================================
@@ -166,9 +170,9 @@ void app_init(void)
     const char* active_name = profile_get_name(OUTPUT_TARGET_GAMECUBE,
                                                 profile_get_active_index(OUTPUT_TARGET_GAMECUBE));
 
-    // Defer BT init to app_task — it takes ~1s and blocks console detection.
-    // GC output + Core 1 joybus listener must start before BT init so the
-    // console sees us during its boot probe window.
+    // BT comes up from the main loop via bt_input_interface, after the GC
+    // output and Core 1 joybus listener are already answering the console.
+    bt_input_set_transport(&bt_transport_cyw43, 0);
     printf("[app:bt2gc] BT init deferred (will start after joybus ready)\n");
     printf("[app:bt2gc]   Routing: Bluetooth -> GameCube (merge)\n");
     printf("[app:bt2gc]   Player slots: %d\n", MAX_PLAYER_SLOTS);
@@ -181,8 +185,6 @@ void app_init(void)
 // APP TASK (Called from main loop)
 // ============================================================================
 
-static bool bt_initialized = false;
-
 void app_task(void)
 {
     // Check for bootloader command on CDC serial ('B' = reboot to bootloader)
@@ -191,28 +193,12 @@ void app_task(void)
         reset_usb_boot(0, 0);
     }
 
-    // Deferred BT init: runs once after joybus listener is active on Core 1
-    if (!bt_initialized) {
-        bt_initialized = true;
-        printf("[app:bt2gc] Initializing Bluetooth...\n");
-        bt_init(&bt_transport_cyw43);
-        printf("[app:bt2gc] Bluetooth initialized\n");
-    }
-
-    // Forward rumble from GameCube console to BT controllers
-    if (gamecube_output_interface.get_rumble) {
-        uint8_t rumble = gamecube_output_interface.get_rumble();
-        for (int i = 0; i < playersCount; i++) {
-            feedback_set_rumble(i, rumble, rumble);
-        }
-    }
+    // Forward rumble from GameCube console to BT controllers (on change only)
+    feedback_console_task(ROUTING_MODE == ROUTING_MODE_MERGE);
 
     // Process button input
     button_task();
 
-    // Process Bluetooth transport
-    bt_task();
-
     // Update LED status
     leds_set_connected_devices(btstack_classic_get_connection_count());
     led_status_update();
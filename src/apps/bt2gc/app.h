@@ -61,7 +61,6 @@
 // ============================================================================
 // BLUETOOTH CONFIGURATION
 // ============================================================================
-#define BT_MAX_CONNECTIONS 4
 #define BT_SCAN_ON_STARTUP 1
 
 // ============================================================================
@@ -99,13 +99,17 @@ static const profile_config_t app_profile_config = {
 // APP INPUT INTERFACES
 // ============================================================================
 
-// BT2LOOPY has no InputInterface - BT transport handles input internally
-// via bthid drivers that call router_submit_input()
+// Bluetooth input: bthid drivers call router_submit_input(); the interface
+// brings the transport up from the main loop and runs bt_task()
+
+static const InputInterface* input_interfaces[] = {
+    &bt_input_interface,
+};
 
 const InputInterface** app_get_input_interfaces(uint8_t* count)
 {
-    *count = 0;
-    return NULL;
+    *count = sizeof(input_interfaces) / sizeof(input_interfaces[0]);
+    return input_interfaces;
 }
 
 // ============================================================================
@@ -168,9 +172,8 @@ void app_init(void)
     const char* active_name = profile_get_name(OUTPUT_TARGET_LOOPY,
                                                 profile_get_active_index(OUTPUT_TARGET_LOOPY));
 
-    // Initialize Bluetooth transport
-    printf("[app:bt2loopy] Initializing Bluetooth...\n");
-    bt_init(&bt_transport_cyw43);
+    // Bluetooth transport, brought up by bt_input_interface
+    bt_input_set_transport(&bt_transport_cyw43, 0);
 
     printf("[app:bt2loopy] Initialization complete\n");
     printf("[app:bt2loopy]   Routing: Bluetooth -> Loopy (1:1)\n");
@@ -189,9 +192,6 @@ void app_task(void)
     // Process button input
     button_task();
 
-    // Process Bluetooth transport
-    bt_task();
-
     // Update LED status
     leds_set_connected_devices(btstack_classic_get_connection_count());
     led_status_update();
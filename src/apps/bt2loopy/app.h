@@ -64,7 +64,6 @@
 // ============================================================================
 // BLUETOOTH CONFIGURATION
 // ============================================================================
-#define BT_MAX_CONNECTIONS 4            // Max BT controllers
 #define BT_SCAN_ON_STARTUP 1            // Start scanning for controllers on boot
 
 // ============================================================================
@@ -155,13 +155,17 @@ static const profile_config_t app_profile_config = {
 // APP INPUT INTERFACES
 // ============================================================================
 
-// BT2N64 has no InputInterface - BT transport handles input internally
-// via bthid drivers that call router_submit_input()
+// Bluetooth input: bthid drivers call router_submit_input(); the interface
+// brings the transport up from the main loop and runs bt_task()
+
+static const InputInterface* input_interfaces[] = {
+    &bt_input_interface,
+};
 
 const InputInterface** app_get_input_interfaces(uint8_t* count)
 {
-    *count = 0;
-    return NULL;
+    *count = sizeof(input_interfaces) / sizeof(input_interfaces[0]);
+    return input_interfaces;
 }
 
 // ============================================================================
@@ -228,9 +232,9 @@ void app_init(void)
     const char* active_name = profile_get_name(OUTPUT_TARGET_N64,
                                                 profile_get_active_index(OUTPUT_TARGET_N64));
 
-    // Defer BT init to app_task — it takes ~1s and blocks console detection.
-    // N64 output + Core 1 joybus listener must start before BT init so the
-    // console sees us during its boot probe window.
+    // BT comes up from the main loop via bt_input_interface, after the N64
+    // output and Core 1 joybus listener are already answering the console.
+    bt_input_set_transport(&bt_transport_cyw43, 0);
     printf("[app:bt2n64] BT init deferred (will start after joybus ready)\n");
     printf("[app:bt2n64]   Routing: Bluetooth -> N64 (merge)\n");
     printf("[app:bt2n64]   Player slots: %d (single player)\n", MAX_PLAYER_SLOTS);
@@ -243,9 +247,6 @@ void app_init(void)
 // APP TASK (Called from main loop)
 // ============================================================================
 
-// Deferred BT initialization state
-static bool bt_initialized = false;
-
 void app_task(void)
 {
     // Check for bootloader command on CDC serial ('B' = reboot to bootloader)
@@ -254,21 +255,17 @@ void app_task(void)
         reset_usb_boot(0, 0);
     }
 
-    // Deferred BT init: runs once after joybus listener is active on Core 1
-    if (!bt_initialized) {
-        bt_initialized = true;
-        printf("[app:bt2n64] Initializing Bluetooth...\n");
-        bt_init(&bt_transport_cyw43);
-        printf("[app:bt2n64] Bluetooth initialized\n");
-    }
-
     // Forward rumble from N64 console to BT controllers
-    // Simple passthrough with heartbeat toggle every 2s to prevent
-    // Xbox BLE controllers from auto-stopping (5s internal timeout).
-    if (n64_output_interface.get_rumble) {
+    // Passthrough with heartbeat toggle every 2s to prevent Xbox BLE
+    // controllers from auto-stopping (5s internal timeout). Players are only
+    // touched when the shaped value or the player count changes.
+    {
+        static uint8_t rumble = 0;
         static uint32_t rumble_heartbeat = 0;
         static uint8_t toggle = 0;
-        uint8_t rumble = n64_output_interface.get_rumble();
+        static uint8_t sent_left = 0, sent_right = 0;
+        static int sent_players = 0;
+        feedback_console_take(0, &rumble, NULL);
         uint32_t now = platform_time_ms();
 
         if (rumble && (now - rumble_heartbeat > 2000)) {
@@ -282,17 +279,19 @@ void app_task(void)
 
         uint8_t left = rumble ? (50 + toggle) : 0;
         uint8_t right = rumble ? 15 : 0;
-        for (int i = 0; i < playersCount; i++) {
-            feedback_set_rumble(i, left, right);
+        if (left != sent_left || right != sent_right || playersCount != sent_players) {
+            sent_left = left;
+            sent_right = right;
+            sent_players = playersCount;
+            for (int i = 0; i < playersCount; i++) {
+                feedback_set_rumble(i, left, right);
+            }
         }
     }
 
     // Process button input
     button_task();
 
-    // Process Bluetooth transport
-    bt_task();
-
     // Periodic diagnostic (every ~2 seconds)
     static uint32_t diag_last = 0;
     uint32_t now = platform_time_ms();
@@ -106,13 +106,17 @@ static const profile_config_t app_profile_config = {
 // APP INPUT INTERFACES
 // ============================================================================
 
-// BT2NUON has no InputInterface - BT transport handles input internally
-// via bthid drivers that call router_submit_input()
+// Bluetooth input: bthid drivers call router_submit_input(); the interface
+// brings the transport up from the main loop and runs bt_task()
+
+static const InputInterface* input_interfaces[] = {
+    &bt_input_interface,
+};
 
 const InputInterface** app_get_input_interfaces(uint8_t* count)
 {
-    *count = 0;
-    return NULL;
+    *count = sizeof(input_interfaces) / sizeof(input_interfaces[0]);
+    return input_interfaces;
 }
 
 // ============================================================================
@@ -175,9 +179,9 @@ void app_init(void)
     const char* active_name = profile_get_name(OUTPUT_TARGET_NUON,
                                                 profile_get_active_index(OUTPUT_TARGET_NUON));
 
-    // Defer BT init to app_task — it takes ~1s and blocks console detection.
-    // Nuon output + Core 1 polyface listener must start before BT init so the
-    // console sees us during its boot probe window.
+    // BT comes up from the main loop via bt_input_interface, 10 seconds in
+    // so the polyface handshake completes with the radio still off.
+    bt_input_set_transport(&bt_transport_cyw43, 10000);
     printf("[app:bt2nuon] BT init deferred (will start after polyface ready)\n");
 
     printf("[app:bt2nuon] Initialization complete\n");
@@ -194,23 +198,10 @@ void app_init(void)
 // APP TASK (Called from main loop)
 // ============================================================================
 
-// Deferred BT initialization state
-static bool bt_initialized = false;
-
 void app_task(void)
 {
-    // Deferred BT init: wait 10 seconds for polyface handshake to complete
-    if (!bt_initialized) {
-        static uint32_t boot_time = 0;
-        if (boot_time == 0) boot_time = to_ms_since_boot(get_absolute_time());
-        if (to_ms_since_boot(get_absolute_time()) - boot_time > 10000) {
-            bt_initialized = true;
-            printf("[app:bt2nuon] Initializing Bluetooth...\n");
-            bt_init(&bt_transport_cyw43);
-            printf("[app:bt2nuon] Bluetooth initialized\n");
-        }
-        return;
-    }
+    // Nothing to do until bt_input_interface has brought the transport up
+    if (!bt_transport) return;
 
     // Check for bootloader command on UART ('B' = reboot to bootloader)
     int c = getchar_timeout_us(0);
@@ -221,8 +212,7 @@ void app_task(void)
     // Process button input (BOOTSEL reads are throttled in button_task)
     button_task();
 
-    // BT poll + LED
-    bt_task();
+    // LED
     leds_set_connected_devices(btstack_classic_get_connection_count());
     led_status_update();
 }
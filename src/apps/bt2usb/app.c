@@ -195,13 +195,17 @@ static void on_button_event(button_event_t event)
 // APP INPUT INTERFACES
 // ============================================================================
 
-// BT2USB has no InputInterface - BT transport handles input internally
-// via bthid drivers that call router_submit_input()
+// Bluetooth input: bthid drivers call router_submit_input(); the interface
+// brings the transport up from the main loop and runs bt_task()
+
+static const InputInterface* input_interfaces[] = {
+    &bt_input_interface,
+};
 
 const InputInterface** app_get_input_interfaces(uint8_t* count)
 {
-    *count = 0;
-    return NULL;
+    *count = sizeof(input_interfaces) / sizeof(input_interfaces[0]);
+    return input_interfaces;
 }
 
 // ============================================================================
@@ -411,15 +415,13 @@ void app_init(void)
     };
     players_init_with_config(&player_cfg);
 
-    // Initialize Bluetooth transport
-    // Must use bt_init() to set global transport pointer and register drivers
-    printf("[app:bt2usb] Initializing Bluetooth...\n");
+    // Bluetooth transport, brought up by bt_input_interface
 #ifdef BTSTACK_USE_ESP32
-    bt_init(&bt_transport_esp32);
+    bt_input_set_transport(&bt_transport_esp32, 0);
 #elif defined(BTSTACK_USE_NRF)
-    bt_init(&bt_transport_nrf);
+    bt_input_set_transport(&bt_transport_nrf, 0);
 #else
-    bt_init(&bt_transport_cyw43);
+    bt_input_set_transport(&bt_transport_cyw43, 0);
 #endif
 
     printf("[app:bt2usb] Initialization complete\n");
@@ -452,9 +454,6 @@ void app_task(void)
         last_led_mode = mode;
     }
 
-    // Process Bluetooth transport
-    bt_task();
-
     // Update LED status
     leds_set_connected_devices(btstack_classic_get_connection_count());
     led_status_update();
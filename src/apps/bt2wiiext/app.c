@@ -35,6 +35,7 @@ static bool bt_input_enabled = true;
 #endif
 
 static const InputInterface* input_interfaces[] = {
+    &bt_input_interface,
 #ifdef SENSOR_PAD
     &pad_input_interface,
 #endif
@@ -170,8 +171,15 @@ void app_init(void)
         }
     }
 
+    // CYW43 must always initialize (Pico W needs it), but scanning only
+    // starts if BT host is enabled. bt_input_interface brings it up.
+    if (!bt_input_enabled) {
+        btstack_host_suppress_scan(true);
+    }
+    bt_input_set_transport(&bt_transport_cyw43, 0);
+
     printf("[app:bt2wiiext] BT host: %s\n", bt_input_enabled ? "enabled" : "disabled");
-    printf("[app:bt2wiiext] BT init deferred to first task tick\n");
+    printf("[app:bt2wiiext] BT init deferred to main loop\n");
     printf("[app:bt2wiiext]   Routing: Bluetooth -> Wii extension (0x52)\n");
     printf("[app:bt2wiiext]   Click BOOTSEL for 60s BT scan\n");
     printf("[app:bt2wiiext]   Hold BOOTSEL to disconnect all + clear bonds\n");
@@ -188,20 +196,6 @@ void app_task(void)
     if (c == 'B') reset_usb_boot(0, 0);
     if (c == 'T') wii_ext_crypto_self_test();
 
-    // Deferred BT init runs once — CYW43 must always initialize (Pico W
-    // needs it), but scanning only starts if BT host is enabled.
-    static bool bt_initialized = false;
-    if (!bt_initialized) {
-        bt_initialized = true;
-        printf("[app:bt2wiiext] Initializing CYW43...\n");
-        if (!bt_input_enabled) {
-            btstack_host_suppress_scan(true);
-        }
-        bt_init(&bt_transport_cyw43);
-        printf("[app:bt2wiiext] BT host %s\n", bt_input_enabled ? "scanning" : "disabled");
-    }
-
     button_task();
-    bt_task();
     led_status_update();
 }
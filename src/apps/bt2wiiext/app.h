@@ -44,7 +44,6 @@
 #define CPU_OVERCLOCK_KHZ 0
 #define UART_DEBUG 1
 
-#define BT_MAX_CONNECTIONS 4
 #define BT_SCAN_ON_STARTUP 1
 
 void app_init(void);
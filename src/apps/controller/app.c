@@ -116,7 +116,7 @@ static void on_button_event(button_event_t event)
             break;
 
         case BUTTON_EVENT_DOUBLE_CLICK: {
-            // Cycle to next mode (usbd_set_mode flushes debug + saves to flash)
+            // Cycle to next mode (usbd_set_mode re-enumerates + saves to flash)
             usb_output_mode_t next = usbd_get_next_mode();
             printf("[app:controller] Double-click - switching USB mode → %s\n",
                    usbd_get_mode_name(next));
@@ -138,6 +138,13 @@ static void on_button_event(button_event_t event)
 // KONAMI CODE CALLBACK
 // ============================================================================
 
+// Victory melody (A5, C6, E6)
+static const speaker_note_t code_melody[] = {
+    { 880,  200, 100 },
+    { 1047, 200, 100 },
+    { 1319, 255, 200 },
+};
+
 static void on_code_detected(const char* code_name)
 {
     printf("[app:controller] Code detected: %s\n", code_name);
@@ -145,15 +152,9 @@ static void on_code_detected(const char* code_name)
     // Visual feedback - use profile indicator (flashes LEDs)
     neopixel_indicate_profile(3);  // Flash 4 times
 
-    // Audio feedback - play victory melody
+    // Audio feedback - play victory melody (plays from a timer, doesn't block)
     if (speaker_is_initialized()) {
-        speaker_tone(880, 200);    // A5
-        sleep_ms(100);
-        speaker_tone(1047, 200);   // C6
-        sleep_ms(100);
-        speaker_tone(1319, 255);   // E6
-        sleep_ms(200);
-        speaker_stop();
+        speaker_play(code_melody, sizeof(code_melody) / sizeof(code_melody[0]));
     }
 
     // Display feedback - show on marquee
@@ -177,7 +178,7 @@ static void uart_link_tap(output_target_t output, uint8_t player_index,
 
     // Don't resend inputs that came from UART (dev_addr 0xD0+ range)
     // This prevents infinite loops between linked controllers
-    if (event->dev_addr >= 0xD0) return;
+    if (event->dev_addr >= DEV_ADDR_UART_HOST_BASE) return;
 
     // Send local input to linked controller
     uart_device_queue_input(event, player_index);
@@ -488,7 +489,7 @@ void app_task(void)
         buttons = event->buttons;
 
         // Forward to linked controller via UART (if enabled)
-        if (uart_link_enabled && event->dev_addr < 0xD0) {
+        if (uart_link_enabled && event->dev_addr < DEV_ADDR_UART_HOST_BASE) {
             uart_device_queue_input(event, 0);
         }
     }
@@ -91,12 +91,5 @@ void app_task(void)
     // Forward rumble from Dreamcast (Puru Puru) to the GC controller's
     // built-in motor via the feedback system. gc_host reads this and drives
     // the rumble bit on the next poll command.
-    static uint8_t last_rumble = 0;
-    if (dreamcast_output_interface.get_rumble) {
-        uint8_t rumble = dreamcast_output_interface.get_rumble();
-        if (rumble != last_rumble) {
-            last_rumble = rumble;
-            feedback_set_rumble(0, rumble, rumble);
-        }
-    }
+    feedback_console_task(ROUTING_MODE == ROUTING_MODE_MERGE);
 }
@@ -20,6 +20,7 @@
 #include "core/input_interface.h"
 #include "core/output_interface.h"
 #include "native/host/gc/gc_host.h"
+#include "native/joybus_clock.h"
 #include "native/host/gc/joybus_bridge.h"
 #include "native/host/gc/gba_multiboot.h"
 #include "usb/usbd/usbd.h"
@@ -97,12 +98,12 @@ const OutputInterface** app_get_output_interfaces(uint8_t* count)
 
 void app_init(void)
 {
-    // Joybus PIO timing is calibrated for 130 MHz (see gc2usb, CLAUDE.md).
-    // At pico-sdk's default 125 MHz, joybus bit timing is off by ~4%,
-    // which is fine for STATUS/RESET handshake (the GBA chimes) but
-    // breaks the Kawasedo cipher + CRC step mid-upload. Must run BEFORE
-    // any UART init so the baud divider gets the new clock.
-    set_sys_clock_khz(130000, true);
+    // Joybus PIO needs a clock with a whole divider (see joybus_clock.h).
+    // At pico-sdk's default 125 MHz the divider jitters bit edges, which
+    // is fine for STATUS/RESET handshake (the GBA chimes) but breaks the
+    // Kawasedo cipher + CRC step mid-upload. Must run BEFORE any UART
+    // init so the baud divider gets the new clock.
+    joybus_clock_init();
     // Re-init stdio so UART baud divisor recomputes for the new sys_clk
     // (same fix gc2usb applies — without it stdio output garbles).
     stdio_init_all();
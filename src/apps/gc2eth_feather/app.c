@@ -15,6 +15,7 @@
 #include "core/input_interface.h"
 #include "core/output_interface.h"
 #include "native/host/gc/gc_host.h"
+#include "native/joybus_clock.h"
 #include "native/host/gc/joybus_bridge.h"
 #include "native/host/gc/gba_multiboot.h"
 #include "usb/usbd/usbd.h"
@@ -130,7 +131,7 @@ static int sock_recv_byte_nb(void) {
 // ============================================================================
 void app_init(void)
 {
-    set_sys_clock_khz(130000, true);  // joybus PIO timing
+    joybus_clock_init();               // joybus PIO timing
     stdio_init_all();                  // recompute baud divisors
 
     // dbg() writes go into TinyUSB's CDC TX buffer. They flush once the
@@ -160,6 +161,7 @@ void app_init(void)
     s_pins.pin_miso = W5500_PIN_MISO;
     s_pins.pin_cs   = W5500_PIN_CS;
     s_pins.pin_rst  = W5500_PIN_RST;
+    s_pins.pin_int  = W5500_PIN_INT;
     s_pins.spi_hz   = W5500_SPI_HZ;
 
     if (!w5500_init(&s_pins, s_mac, s_local_ip, s_subnet, s_gateway)) {
@@ -580,6 +582,9 @@ void app_task(void)
     int c = getchar_timeout_us(0);
     if (c == 'B') reset_usb_boot(0, 0);
 
+    // Pull new socket data, push sends the chip had no room for
+    w5500_task();
+
     // Drain anything Dolphin has sent us.
     while (process_dolphin_frame_one()) { /* loop */ }
 
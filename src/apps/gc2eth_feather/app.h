@@ -30,6 +30,7 @@
 #define W5500_PIN_MISO           8
 #define W5500_PIN_CS             10
 #define W5500_PIN_RST            0xFF   // RST not broken out to a dedicated Feather pin
+#define W5500_PIN_INT            0xFF   // INTn: set to the GP the IRQ jumper is bridged to
 #define W5500_SPI_HZ             20000000  // 20 MHz — 33 MHz hurt jitter on this PCB
 
 // Static network config. Tied to a specific en10 subnet — keep en10
@@ -10,11 +10,19 @@
 //   0x02 = socket 0 TX buffer
 //   0x03 = socket 0 RX buffer
 //
+// Socket data goes through local rings: w5500_task() (and a recv that finds
+// its ring empty) pulls whatever the chip has received, sends are queued and
+// pushed straight out. We are the only writer of Sn_RX_RD and Sn_TX_WR, so
+// both are cached after one burst read of the pointer block and never read
+// back; Sn_TX_FSR is re-read only when the cached free space runs short.
+// With INTn wired the chip is only touched when it has something to say.
+//
 // Reference: WizNet W5500 datasheet v1.0.2
 
 #include "w5500.h"
 #include "hardware/gpio.h"
 #include "hardware/spi.h"
+#include "hardware/dma.h"
 #include "pico/time.h"
 #include <stdio.h>
 #include <string.h>
@@ -55,6 +63,14 @@
 #define Sn_RX_RSR  0x0026
 #define Sn_RX_RD   0x0028
 #define Sn_RX_WR   0x002A
+#define Sn_IMR     0x002C
+
+// Sn_IR / Sn_IMR bits
+#define Sn_IR_CON      0x01
+#define Sn_IR_DISCON   0x02
+#define Sn_IR_RECV     0x04
+#define Sn_IR_TIMEOUT  0x08
+#define Sn_IR_SENDOK   0x10
 
 // Modes
 #define Sn_MR_TCP  0x01
@@ -97,16 +113,65 @@
 // ============================================================================
 static const w5500_pins_t* g_pins = NULL;
 
+// Payloads at least this long go over DMA; register accesses and the
+// 1-5 byte joybus frames are cheaper with the blocking FIFO loop
+#define W5500_DMA_MIN_LEN 16
+
+static int dma_tx = -1;
+static int dma_rx = -1;
+
 static inline void cs_low(void)  { gpio_put(g_pins->pin_cs, 0); }
 static inline void cs_high(void) { gpio_put(g_pins->pin_cs, 1); }
 
+static void spi_dma_init(void)
+{
+    dma_tx = dma_claim_unused_channel(false);
+    dma_rx = dma_claim_unused_channel(false);
+    if (dma_tx < 0 || dma_rx < 0) {
+        if (dma_tx >= 0) dma_channel_unclaim(dma_tx);
+        if (dma_rx >= 0) dma_channel_unclaim(dma_rx);
+        dma_tx = dma_rx = -1;
+        printf("[w5500] no free DMA channels, using blocking SPI\n");
+    }
+}
+
+// Full-duplex burst: tx=NULL clocks out zeros, rx=NULL discards
+static void spi_dma_xfer(const uint8_t* tx, uint8_t* rx, size_t len)
+{
+    static uint8_t dummy_tx = 0;
+    static uint8_t dummy_rx;
+    spi_inst_t* spi = g_pins->spi;
+
+    dma_channel_config c = dma_channel_get_default_config(dma_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_dreq(spi, true));
+    channel_config_set_read_increment(&c, tx != NULL);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(dma_tx, &c, &spi_get_hw(spi)->dr,
+                          tx ? tx : &dummy_tx, len, false);
+
+    c = dma_channel_get_default_config(dma_rx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_dreq(spi, false));
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, rx != NULL);
+    dma_channel_configure(dma_rx, &c, rx ? rx : &dummy_rx,
+                          &spi_get_hw(spi)->dr, len, false);
+
+    // RX finishing means every byte has been shifted out and back
+    dma_start_channel_mask((1u << dma_tx) | (1u << dma_rx));
+    dma_channel_wait_for_finish_blocking(dma_rx);
+}
+
 static void w5500_xfer(uint16_t addr, uint8_t bsb_rwb,
                        const uint8_t* tx, uint8_t* rx, size_t len)
 {
     uint8_t hdr[3] = { (uint8_t)(addr >> 8), (uint8_t)(addr & 0xFF), bsb_rwb };
     cs_low();
     spi_write_blocking(g_pins->spi, hdr, 3);
-    if (rx) {
+    if (len >= W5500_DMA_MIN_LEN && dma_tx >= 0) {
+        spi_dma_xfer(tx, rx, len);
+    } else if (rx) {
         // Read: send 0x00 dummies, capture rx
         if (tx) spi_write_read_blocking(g_pins->spi, tx, rx, len);
         else    spi_read_blocking(g_pins->spi, 0x00, rx, len);
@@ -138,19 +203,243 @@ static uint16_t w5500_read_u16(uint16_t addr, uint8_t bsb) {
     return ((uint16_t)buf[0] << 8) | buf[1];
 }
 
+// ============================================================================
+// Socket state
+// ============================================================================
+typedef struct {
+    uint8_t  reg_bsb, tx_bsb, rx_bsb;
+    uint8_t  sn_bit;            // Socket's bit in SIR/SIMR
+
+    // Received bytes not yet handed to the app
+    uint8_t  rx_ring[W5500_RING_SIZE];
+    uint16_t rx_head, rx_tail;
+    // Queued bytes not yet in the chip's TX buffer
+    uint8_t  tx_ring[W5500_RING_SIZE];
+    uint16_t tx_head, tx_tail;
+
+    // Cached chip pointers (valid from the first burst load after OPEN)
+    bool     ptrs_valid;
+    uint16_t rx_rd;             // Sn_RX_RD
+    uint16_t tx_wr;             // Sn_TX_WR
+    uint16_t tx_free;           // Sn_TX_FSR as of the last read, less what we wrote
+
+    bool     cmd_pending;       // Sn_CR written, not yet seen clear
+    bool     rx_ready;          // Chip may hold unread data
+    bool     sr_stale;          // Cached Sn_SR needs a re-read
+    uint8_t  sr;
+    uint32_t sr_read_ms;
+} w5500_sock_t;
+
+static w5500_sock_t socks[2] = {
+    { .reg_bsb = BSB_S0_REG, .tx_bsb = BSB_S0_TX, .rx_bsb = BSB_S0_RX, .sn_bit = 0x01 },
+    { .reg_bsb = BSB_S1_REG, .tx_bsb = BSB_S1_TX, .rx_bsb = BSB_S1_RX, .sn_bit = 0x02 },
+};
+
+// With INTn, re-read the cached Sn_SR at least this often anyway.
+// Without it the status is read on every call, as before.
+#define SR_REFRESH_MS 250
+
+static inline bool int_wired(void) { return g_pins && g_pins->pin_int != 0xFF; }
+
+#define RING_MASK (W5500_RING_SIZE - 1)
+static inline uint16_t ring_used(uint16_t head, uint16_t tail) {
+    return (uint16_t)((head - tail) & RING_MASK);
+}
+
 // Sn_CR is "issue command, hardware self-clears". Wait for it to clear so
 // we don't pipeline two commands before the chip has consumed the first.
-// BSB is the socket-N register block (e.g. BSB_S0_REG, BSB_S1_REG).
-static void sock_cmd_n(uint8_t bsb, uint8_t cmd) {
-    w5500_write_u8(Sn_CR, bsb, cmd);
+static void sock_cmd_wait(w5500_sock_t* s) {
+    if (!s->cmd_pending) return;
     absolute_time_t deadline = make_timeout_time_ms(100);
-    while (w5500_read_u8(Sn_CR, bsb) != 0) {
+    while (w5500_read_u8(Sn_CR, s->reg_bsb) != 0) {
         if (time_reached(deadline)) break;
         tight_loop_contents();
     }
+    s->cmd_pending = false;
+}
+
+// SEND/RECV: don't wait for the chip to take it, the next command will
+static void sock_cmd_async(w5500_sock_t* s, uint8_t cmd) {
+    sock_cmd_wait(s);
+    w5500_write_u8(Sn_CR, s->reg_bsb, cmd);
+    s->cmd_pending = true;
+}
+
+// Socket setup commands: wait for the chip before moving on
+static void sock_cmd(w5500_sock_t* s, uint8_t cmd) {
+    sock_cmd_async(s, cmd);
+    sock_cmd_wait(s);
+    s->sr_stale = true;
+}
+
+// Drop local state when the socket is closed or reopened
+static void sock_reset(w5500_sock_t* s) {
+    s->rx_head = s->rx_tail = 0;
+    s->tx_head = s->tx_tail = 0;
+    s->ptrs_valid = false;
+    s->rx_ready = true;
+    s->sr_stale = true;
+}
+
+// One burst over Sn_TX_FSR..Sn_RX_WR (12 bytes) instead of a transaction
+// per pointer
+static void sock_load_ptrs(w5500_sock_t* s) {
+    uint8_t p[12];
+    w5500_read(Sn_TX_FSR, s->reg_bsb, p, sizeof(p));
+    s->tx_free = ((uint16_t)p[0] << 8) | p[1];
+    s->tx_wr   = ((uint16_t)p[4] << 8) | p[5];
+    s->rx_rd   = ((uint16_t)p[8] << 8) | p[9];
+    s->ptrs_valid = true;
+}
+
+// Enable the socket's interrupts (CON/DISCON/RECV/TIMEOUT) when INTn is wired
+static void sock_enable_irq(w5500_sock_t* s) {
+    if (!int_wired()) return;
+    w5500_write_u8(Sn_IMR, s->reg_bsb, Sn_IR_CON | Sn_IR_DISCON | Sn_IR_RECV | Sn_IR_TIMEOUT);
+    w5500_write_u8(Sn_IR, s->reg_bsb, 0xFF);  // Clear stale flags
+}
+
+// INTn is active low and stays asserted until every flagged Sn_IR is cleared
+static void service_irq(void) {
+    if (!int_wired() || gpio_get(g_pins->pin_int)) return;
+
+    uint8_t sir = w5500_read_u8(SIR, BSB_COMMON);
+    for (int i = 0; i < 2; i++) {
+        w5500_sock_t* s = &socks[i];
+        if (!(sir & s->sn_bit)) continue;
+        uint8_t ir = w5500_read_u8(Sn_IR, s->reg_bsb);
+        w5500_write_u8(Sn_IR, s->reg_bsb, ir);
+        if (ir & Sn_IR_RECV) s->rx_ready = true;
+        if (ir & (Sn_IR_CON | Sn_IR_DISCON | Sn_IR_TIMEOUT)) {
+            s->sr_stale = true;
+            s->ptrs_valid = false;
+        }
+    }
+}
+
+// Chip RX buffer -> local ring: RSR read, payload burst(s), RX_RD, RECV
+static void sock_pull(w5500_sock_t* s) {
+    uint16_t space = RING_MASK - ring_used(s->rx_head, s->rx_tail);
+    if (space == 0) return;
+
+    uint16_t avail = w5500_read_u16(Sn_RX_RSR, s->reg_bsb);
+    if (avail == 0) {
+        s->rx_ready = false;
+        return;
+    }
+    // Data only arrives once ESTABLISHED, so the pointers are settled here
+    if (!s->ptrs_valid) sock_load_ptrs(s);
+    uint16_t n = (avail > space) ? space : avail;
+
+    // Local ring may wrap; the chip wraps its own buffer addressing
+    uint16_t first = W5500_RING_SIZE - s->rx_head;
+    if (first > n) first = n;
+    w5500_read(s->rx_rd, s->rx_bsb, &s->rx_ring[s->rx_head], first);
+    if (n > first) {
+        w5500_read((uint16_t)(s->rx_rd + first), s->rx_bsb, s->rx_ring, n - first);
+    }
+    s->rx_head = (uint16_t)((s->rx_head + n) & RING_MASK);
+
+    // Advance read pointer + tell chip we consumed
+    s->rx_rd = (uint16_t)(s->rx_rd + n);
+    w5500_write_u16(Sn_RX_RD, s->reg_bsb, s->rx_rd);
+    sock_cmd_async(s, Sn_CR_RECV);
+
+    // Ring filled before the chip ran dry: come back for the rest
+    s->rx_ready = (n < avail);
+}
+
+// Local ring -> chip TX buffer: payload burst(s), TX_WR, SEND
+static void sock_flush(w5500_sock_t* s) {
+    uint16_t len = ring_used(s->tx_head, s->tx_tail);
+    if (len == 0) return;
+
+    if (!s->ptrs_valid) sock_load_ptrs(s);
+    if (s->tx_free < len) {
+        s->tx_free = w5500_read_u16(Sn_TX_FSR, s->reg_bsb);
+    }
+    uint16_t n = (len > s->tx_free) ? s->tx_free : len;
+    if (n == 0) return;  // Chip still sending, try again next task
+
+    uint16_t first = W5500_RING_SIZE - s->tx_tail;
+    if (first > n) first = n;
+    w5500_write(s->tx_wr, s->tx_bsb, &s->tx_ring[s->tx_tail], first);
+    if (n > first) {
+        w5500_write((uint16_t)(s->tx_wr + first), s->tx_bsb, s->tx_ring, n - first);
+    }
+    s->tx_tail = (uint16_t)((s->tx_tail + n) & RING_MASK);
+
+    s->tx_wr = (uint16_t)(s->tx_wr + n);
+    s->tx_free -= n;
+    w5500_write_u16(Sn_TX_WR, s->reg_bsb, s->tx_wr);
+    sock_cmd_async(s, Sn_CR_SEND);
+}
+
+static size_t sock_recv(w5500_sock_t* s, uint8_t* dst, size_t max) {
+    if (s->rx_head == s->rx_tail) {
+        service_irq();
+        if (!int_wired() || s->rx_ready) sock_pull(s);
+    }
+
+    size_t n = ring_used(s->rx_head, s->rx_tail);
+    if (n > max) n = max;
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = s->rx_ring[s->rx_tail];
+        s->rx_tail = (uint16_t)((s->rx_tail + 1) & RING_MASK);
+    }
+    return n;
+}
+
+static size_t sock_send(w5500_sock_t* s, const uint8_t* src, size_t len) {
+    uint16_t space = RING_MASK - ring_used(s->tx_head, s->tx_tail);
+    if (len > space) {
+        printf("[w5500] send: TX ring full (free=%u, need=%u)\n",
+               space, (unsigned)len);
+        return 0;
+    }
+    for (size_t i = 0; i < len; i++) {
+        s->tx_ring[s->tx_head] = src[i];
+        s->tx_head = (uint16_t)((s->tx_head + 1) & RING_MASK);
+    }
+    sock_flush(s);
+    return len;
+}
+
+static uint8_t sock_status(w5500_sock_t* s) {
+    if (int_wired()) {
+        service_irq();
+        uint32_t now = to_ms_since_boot(get_absolute_time());
+        if (!s->sr_stale && now - s->sr_read_ms < SR_REFRESH_MS) return s->sr;
+        s->sr_read_ms = now;
+    }
+    s->sr = w5500_read_u8(Sn_SR, s->reg_bsb);
+    s->sr_stale = false;
+    return s->sr;
+}
+
+// Shared OPEN path for both sockets: TCP mode, local port, wait for SOCK_INIT
+static bool sock_open_tcp(w5500_sock_t* s, uint16_t port, const char* what) {
+    // Close anything that might be open
+    sock_cmd(s, Sn_CR_CLOSE);
+    sock_reset(s);
+
+    // TCP mode, port, 16KB TX/RX buffers (default)
+    w5500_write_u8(Sn_MR, s->reg_bsb, Sn_MR_TCP_NODELAY);
+    w5500_write_u16(Sn_PORT, s->reg_bsb, port);
+    sock_enable_irq(s);
+
+    sock_cmd(s, Sn_CR_OPEN);
+    absolute_time_t deadline = make_timeout_time_ms(100);
+    while (w5500_read_u8(Sn_SR, s->reg_bsb) != SOCK_INIT) {
+        if (time_reached(deadline)) {
+            printf("[w5500] %s OPEN timeout, sr=0x%02x\n",
+                   what, w5500_read_u8(Sn_SR, s->reg_bsb));
+            return false;
+        }
+        tight_loop_contents();
+    }
+    return true;
 }
-// Back-compat shim: existing socket-0 callsites unchanged.
-static inline void sock_cmd(uint8_t cmd) { sock_cmd_n(BSB_S0_REG, cmd); }
 
 // ============================================================================
 // Public API
@@ -168,12 +457,20 @@ bool w5500_init(const w5500_pins_t* pins,
     gpio_set_function(pins->pin_sck,  GPIO_FUNC_SPI);
     gpio_set_function(pins->pin_mosi, GPIO_FUNC_SPI);
     gpio_set_function(pins->pin_miso, GPIO_FUNC_SPI);
+    spi_dma_init();
 
     // CS as plain GPIO, idle high
     gpio_init(pins->pin_cs);
     gpio_put(pins->pin_cs, 1);
     gpio_set_dir(pins->pin_cs, GPIO_OUT);
 
+    // INTn: open-drain active low, if wired
+    if (pins->pin_int != 0xFF) {
+        gpio_init(pins->pin_int);
+        gpio_set_dir(pins->pin_int, GPIO_IN);
+        gpio_pull_up(pins->pin_int);
+    }
+
     // RST: pulse low if wired
     if (pins->pin_rst != 0xFF) {
         gpio_init(pins->pin_rst);
@@ -203,36 +500,39 @@ bool w5500_init(const w5500_pins_t* pins,
     w5500_write(SHAR, BSB_COMMON, mac,    6);
     w5500_write(SIPR, BSB_COMMON, ip,     4);
 
-    printf("[w5500] ready: ip=%u.%u.%u.%u mac=%02x:%02x:%02x:%02x:%02x:%02x\n",
+    // Socket 0/1 interrupts reach INTn (per-socket masks set on open)
+    if (pins->pin_int != 0xFF) {
+        w5500_write_u8(SIMR, BSB_COMMON, socks[0].sn_bit | socks[1].sn_bit);
+    }
+
+    printf("[w5500] ready: ip=%u.%u.%u.%u mac=%02x:%02x:%02x:%02x:%02x:%02x int=%s dma=%s\n",
            ip[0], ip[1], ip[2], ip[3],
-           mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+           mac[0], mac[1], mac[2], mac[3], mac[4], mac[5],
+           pins->pin_int != 0xFF ? "INTn" : "polled",
+           dma_tx >= 0 ? "on" : "off");
     return true;
 }
 
-bool w5500_sock0_listen_tcp(uint16_t port)
+void w5500_task(void)
 {
-    // Close anything that might be open
-    sock_cmd(Sn_CR_CLOSE);
-
-    // Configure socket 0: TCP mode, port, 16KB TX/RX buffers (default)
-    w5500_write_u8(Sn_MR, BSB_S0_REG, Sn_MR_TCP_NODELAY);
-    w5500_write_u16(Sn_PORT, BSB_S0_REG, port);
+    if (!g_pins) return;
 
-    sock_cmd(Sn_CR_OPEN);
-    // Wait for SOCK_INIT
-    absolute_time_t deadline = make_timeout_time_ms(100);
-    while (w5500_read_u8(Sn_SR, BSB_S0_REG) != SOCK_INIT) {
-        if (time_reached(deadline)) {
-            printf("[w5500] sock0 OPEN timeout, status=0x%02x\n",
-                   w5500_read_u8(Sn_SR, BSB_S0_REG));
-            return false;
-        }
-        tight_loop_contents();
+    service_irq();
+    for (int i = 0; i < 2; i++) {
+        w5500_sock_t* s = &socks[i];
+        if (!int_wired() || s->rx_ready) sock_pull(s);
+        sock_flush(s);
     }
+}
 
-    sock_cmd(Sn_CR_LISTEN);
+bool w5500_sock0_listen_tcp(uint16_t port)
+{
+    w5500_sock_t* s = &socks[0];
+    if (!sock_open_tcp(s, port, "sock0")) return false;
+
+    sock_cmd(s, Sn_CR_LISTEN);
     // Wait for SOCK_LISTEN
-    deadline = make_timeout_time_ms(100);
+    absolute_time_t deadline = make_timeout_time_ms(100);
     while (w5500_read_u8(Sn_SR, BSB_S0_REG) != SOCK_LISTEN) {
         if (time_reached(deadline)) {
             printf("[w5500] sock0 LISTEN timeout\n");
@@ -257,56 +557,27 @@ bool w5500_sock0_listen_tcp(uint16_t port)
 }
 
 uint8_t w5500_sock0_status(void) {
-    return w5500_read_u8(Sn_SR, BSB_S0_REG);
+    return sock_status(&socks[0]);
 }
 
 bool w5500_sock0_connected(void) {
     return w5500_sock0_status() == SOCK_ESTABLISHED;
 }
 
-size_t w5500_sock0_recv(uint8_t* dst, size_t max)
-{
-    uint16_t avail = w5500_read_u16(Sn_RX_RSR, BSB_S0_REG);
-    if (avail == 0) return 0;
-    if (avail > max) avail = (uint16_t)max;
-
-    // Read pointer wraps within the 16KB RX buffer; the chip handles the
-    // wrap automatically when we use the buffer-block BSB. We just give it
-    // the current read pointer as the address.
-    uint16_t rd = w5500_read_u16(Sn_RX_RD, BSB_S0_REG);
-    w5500_read(rd, BSB_S0_RX, dst, avail);
-
-    // Advance read pointer + tell chip we consumed
-    w5500_write_u16(Sn_RX_RD, BSB_S0_REG, rd + avail);
-    sock_cmd(Sn_CR_RECV);
-    return avail;
+size_t w5500_sock0_recv(uint8_t* dst, size_t max) {
+    return sock_recv(&socks[0], dst, max);
 }
 
-size_t w5500_sock0_send(const uint8_t* src, size_t len)
-{
-    // Wait for free space in TX buffer
-    uint16_t free_sz;
-    absolute_time_t deadline = make_timeout_time_ms(100);
-    do {
-        free_sz = w5500_read_u16(Sn_TX_FSR, BSB_S0_REG);
-        if (free_sz >= len) break;
-        if (time_reached(deadline)) {
-            printf("[w5500] send: TX buffer full (free=%u, need=%u)\n",
-                   free_sz, (unsigned)len);
-            return 0;
-        }
-        tight_loop_contents();
-    } while (1);
+size_t w5500_sock0_send(const uint8_t* src, size_t len) {
+    return sock_send(&socks[0], src, len);
+}
 
-    uint16_t wr = w5500_read_u16(Sn_TX_WR, BSB_S0_REG);
-    w5500_write(wr, BSB_S0_TX, src, len);
-    w5500_write_u16(Sn_TX_WR, BSB_S0_REG, (uint16_t)(wr + len));
-    sock_cmd(Sn_CR_SEND);
-    return len;
+size_t w5500_sock0_tx_pending(void) {
+    return ring_used(socks[0].tx_head, socks[0].tx_tail);
 }
 
 void w5500_sock0_reopen(uint16_t port) {
-    sock_cmd(Sn_CR_CLOSE);
+    sock_cmd(&socks[0], Sn_CR_CLOSE);
     sleep_ms(2);
     w5500_sock0_listen_tcp(port);
 }
@@ -314,28 +585,14 @@ void w5500_sock0_reopen(uint16_t port) {
 bool w5500_sock0_connect_tcp(const uint8_t dest_ip[4], uint16_t dest_port,
                              uint16_t local_port)
 {
-    // Tear down any prior socket state
-    sock_cmd(Sn_CR_CLOSE);
-
-    w5500_write_u8(Sn_MR, BSB_S0_REG, Sn_MR_TCP_NODELAY);
-    w5500_write_u16(Sn_PORT, BSB_S0_REG, local_port);
-
-    sock_cmd(Sn_CR_OPEN);
-    absolute_time_t deadline = make_timeout_time_ms(100);
-    while (w5500_read_u8(Sn_SR, BSB_S0_REG) != SOCK_INIT) {
-        if (time_reached(deadline)) {
-            printf("[w5500] connect: OPEN timeout, sr=0x%02x\n",
-                   w5500_read_u8(Sn_SR, BSB_S0_REG));
-            return false;
-        }
-        tight_loop_contents();
-    }
+    w5500_sock_t* s = &socks[0];
+    if (!sock_open_tcp(s, local_port, "connect:")) return false;
 
     // Set destination then issue CONNECT — the chip will ARP for the
     // dest MAC and complete the TCP three-way handshake on its own.
     w5500_write(Sn_DIPR, BSB_S0_REG, dest_ip, 4);
     w5500_write_u16(Sn_DPORT, BSB_S0_REG, dest_port);
-    sock_cmd(Sn_CR_CONNECT);
+    sock_cmd(s, Sn_CR_CONNECT);
 
     printf("[w5500] sock0 connecting to %u.%u.%u.%u:%u (src_port=%u)\n",
            dest_ip[0], dest_ip[1], dest_ip[2], dest_ip[3],
@@ -352,25 +609,12 @@ bool w5500_sock0_connect_tcp(const uint8_t dest_ip[4], uint16_t dest_port,
 bool w5500_sock1_connect_tcp(const uint8_t dest_ip[4], uint16_t dest_port,
                              uint16_t local_port)
 {
-    sock_cmd_n(BSB_S1_REG, Sn_CR_CLOSE);
-
-    w5500_write_u8(Sn_MR,   BSB_S1_REG, Sn_MR_TCP_NODELAY);
-    w5500_write_u16(Sn_PORT, BSB_S1_REG, local_port);
-
-    sock_cmd_n(BSB_S1_REG, Sn_CR_OPEN);
-    absolute_time_t deadline = make_timeout_time_ms(100);
-    while (w5500_read_u8(Sn_SR, BSB_S1_REG) != SOCK_INIT) {
-        if (time_reached(deadline)) {
-            printf("[w5500] sock1 OPEN timeout, sr=0x%02x\n",
-                   w5500_read_u8(Sn_SR, BSB_S1_REG));
-            return false;
-        }
-        tight_loop_contents();
-    }
+    w5500_sock_t* s = &socks[1];
+    if (!sock_open_tcp(s, local_port, "sock1")) return false;
 
     w5500_write(Sn_DIPR, BSB_S1_REG, dest_ip, 4);
     w5500_write_u16(Sn_DPORT, BSB_S1_REG, dest_port);
-    sock_cmd_n(BSB_S1_REG, Sn_CR_CONNECT);
+    sock_cmd(s, Sn_CR_CONNECT);
 
     printf("[w5500] sock1 connecting to %u.%u.%u.%u:%u (src_port=%u)\n",
            dest_ip[0], dest_ip[1], dest_ip[2], dest_ip[3],
@@ -379,27 +623,20 @@ bool w5500_sock1_connect_tcp(const uint8_t dest_ip[4], uint16_t dest_port,
 }
 
 uint8_t w5500_sock1_status(void) {
-    return w5500_read_u8(Sn_SR, BSB_S1_REG);
+    return sock_status(&socks[1]);
 }
 
 bool w5500_sock1_connected(void) {
     return w5500_sock1_status() == SOCK_ESTABLISHED;
 }
 
-size_t w5500_sock1_recv(uint8_t* dst, size_t max)
-{
-    uint16_t avail = w5500_read_u16(Sn_RX_RSR, BSB_S1_REG);
-    if (avail == 0) return 0;
-    if (avail > max) avail = (uint16_t)max;
-    uint16_t rd = w5500_read_u16(Sn_RX_RD, BSB_S1_REG);
-    w5500_read(rd, BSB_S1_RX, dst, avail);
-    w5500_write_u16(Sn_RX_RD, BSB_S1_REG, rd + avail);
-    sock_cmd_n(BSB_S1_REG, Sn_CR_RECV);
-    return avail;
+size_t w5500_sock1_recv(uint8_t* dst, size_t max) {
+    return sock_recv(&socks[1], dst, max);
 }
 
 void w5500_sock1_close(void) {
-    sock_cmd_n(BSB_S1_REG, Sn_CR_CLOSE);
+    sock_cmd(&socks[1], Sn_CR_CLOSE);
+    sock_reset(&socks[1]);
 }
 
 void w5500_get_diag(w5500_diag_t* out) {
@@ -16,6 +16,11 @@
 #include <stddef.h>
 #include "hardware/spi.h"
 
+// Per-socket local RX and TX rings (power of two)
+#ifndef W5500_RING_SIZE
+#define W5500_RING_SIZE 1024
+#endif
+
 // Caller supplies the SPI peripheral + pins.
 typedef struct {
     spi_inst_t* spi;
@@ -24,6 +29,7 @@ typedef struct {
     uint        pin_miso;
     uint        pin_cs;
     uint        pin_rst;        // optional, 0xFF if not wired
+    uint        pin_int;        // optional INTn, 0xFF if not wired (chip is polled)
     uint32_t    spi_hz;         // e.g. 30_000_000 — W5500 max is 33.3 MHz
 } w5500_pins_t;
 
@@ -35,6 +41,11 @@ bool w5500_init(const w5500_pins_t* pins,
                 const uint8_t subnet[4],
                 const uint8_t gateway[4]);
 
+// Service the chip: on INTn (or every call when INTn isn't wired) pull
+// received bytes into the local rings, and push out queued sends the chip
+// had no room for. Call every main loop.
+void w5500_task(void);
+
 // Open socket 0 as a TCP server listening on `port`. After this the
 // status will go LISTEN until a peer connects (then ESTABLISHED).
 bool w5500_sock0_listen_tcp(uint16_t port);
@@ -68,14 +79,20 @@ uint8_t w5500_sock0_status(void);
 // Convenience: true if a peer is currently connected.
 bool w5500_sock0_connected(void);
 
-// Drain any bytes from the RX buffer into `dst`. Returns bytes copied (0
-// if no data, max bytes requested). Non-blocking.
+// Copy received bytes into `dst`. Returns bytes copied (0 if no data, max
+// bytes requested). Served from the local ring; only touches the chip
+// when the ring is empty (and, with INTn wired, the chip flagged RECV).
+// Non-blocking.
 size_t w5500_sock0_recv(uint8_t* dst, size_t max);
 
-// Write `len` bytes to TX buffer and issue SEND. Blocks until SEND is
-// accepted by the chip (microseconds). Returns bytes sent.
+// Queue `len` bytes and push them to the chip + issue SEND right away if
+// it has room; otherwise w5500_task() sends them later. Never waits.
+// Returns bytes queued (0 if the local ring can't take all of them).
 size_t w5500_sock0_send(const uint8_t* src, size_t len);
 
+// Bytes queued by w5500_sock0_send() not yet handed to the chip
+size_t w5500_sock0_tx_pending(void);
+
 // Close + re-listen. Call after CLOSE_WAIT to accept a new connection.
 void w5500_sock0_reopen(uint16_t port);
 
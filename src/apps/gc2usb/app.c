@@ -14,6 +14,7 @@
 #include "core/output_interface.h"
 #include "usb/usbd/usbd.h"
 #include "native/host/gc/gc_host.h"
+#include "native/joybus_clock.h"
 #include "core/services/leds/leds.h"
 #include "core/services/storage/flash.h"
 #include "core/buttons.h"
@@ -79,16 +80,16 @@ const OutputInterface** app_get_output_interfaces(uint8_t* count)
 
 void app_init(void)
 {
-    // Overclock to 130MHz so the joybus PIO clock divider is exactly 13.0
-    // (clean integer, no jitter). At the default 125MHz the divider is 12.5
-    // which introduces fractional jitter that corrupts bits during the GBA
-    // multiboot upload. Reference: joybus-pio examples all run at 130MHz.
-    set_sys_clock_khz(130000, true);
+    // Run a clock that gives the joybus PIO a whole divider (13.0 at
+    // 130MHz). At the default 125MHz the divider is 12.5 which introduces
+    // fractional jitter that corrupts bits during the GBA multiboot upload.
+    uint32_t clk_khz = joybus_clock_init();
     // Re-init stdio so UART baud divisor recomputes for the new sys_clk
     // (otherwise serial output is garbled at the wrong baud rate).
     stdio_init_all();
 
-    printf("[app:gc2usb] Initializing GC2USB v%s (sys_clk=130MHz)\n", APP_VERSION);
+    printf("[app:gc2usb] Initializing GC2USB v%s (sys_clk=%luMHz)\n", APP_VERSION,
+           (unsigned long)(clk_khz / 1000));
 
     // Configure router for GC -> USB routing
     router_config_t router_cfg = {
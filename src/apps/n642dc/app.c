@@ -88,15 +88,7 @@ void app_init(void)
 
 void app_task(void)
 {
-    // Forward rumble from Dreamcast to feedback system
+    // Forward rumble from Dreamcast to feedback system (DC port 0 → player 0)
     // N64 host reads from feedback_get_state() in its task
-    static uint8_t last_rumble = 0;
-    if (dreamcast_output_interface.get_rumble) {
-        uint8_t rumble = dreamcast_output_interface.get_rumble();
-        if (rumble != last_rumble) {
-            last_rumble = rumble;
-            // Set feedback for player 0 (N64 port 0)
-            feedback_set_rumble(0, rumble, rumble);
-        }
-    }
+    feedback_console_task(ROUTING_MODE == ROUTING_MODE_MERGE);
 }
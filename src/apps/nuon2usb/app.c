@@ -193,7 +193,7 @@ static void __not_in_flash_func(host_core1)(void)
 
             input_event_t event;
             init_input_event(&event);
-            event.dev_addr = 0xD0;
+            event.dev_addr = DEV_ADDR_NUON_HOST;
             event.instance = 0;
             event.type = INPUT_TYPE_GAMEPAD;
             event.buttons = jp_buttons;
@@ -194,11 +194,6 @@ void app_task(void)
 {
     if (gc_config_mode) return;  // Config mode: nothing to do here
 
-    // Forward rumble from GameCube console to USB controllers
-    if (gamecube_output_interface.get_rumble) {
-        uint8_t rumble = gamecube_output_interface.get_rumble();
-        for (int i = 0; i < playersCount; i++) {
-            feedback_set_rumble(i, rumble, rumble);
-        }
-    }
+    // Forward rumble from GameCube console to USB controllers (on change only)
+    feedback_console_task(ROUTING_MODE == ROUTING_MODE_MERGE);
 }
@@ -108,11 +108,6 @@ void app_init(void)
 
 void app_task(void)
 {
-    // Forward rumble from N64 console to USB controllers
-    if (n64_output_interface.get_rumble) {
-        uint8_t rumble = n64_output_interface.get_rumble();
-        for (int i = 0; i < playersCount; i++) {
-            feedback_set_rumble(i, rumble, rumble);
-        }
-    }
+    // Forward rumble from N64 console to USB controllers (on change only)
+    feedback_console_task(ROUTING_MODE == ROUTING_MODE_MERGE);
 }
@@ -173,7 +173,7 @@ static void on_button_event(button_event_t event)
             break;
 
         case BUTTON_EVENT_DOUBLE_CLICK: {
-            // Cycle to next mode (usbd_set_mode flushes debug + saves to flash)
+            // Cycle to next mode (usbd_set_mode re-enumerates + saves to flash)
             usb_output_mode_t next = usbd_get_next_mode();
             printf("[app:usb2usb] Double-click - switching USB mode → %s\n",
                    usbd_get_mode_name(next));
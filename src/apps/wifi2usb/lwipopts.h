@@ -14,14 +14,25 @@
 #define LWIP_SOCKET                 0
 
 // Memory configuration (poll mode compatible)
+// MEM_SIZE is unused with MEM_LIBC_MALLOC (PBUF_RAM comes from the C heap)
 #define MEM_LIBC_MALLOC             1
 #define MEM_ALIGNMENT               4
 #define MEM_SIZE                    4000
 
+// Receive pool sizing. Every received frame lands in one PBUF_POOL buffer
+// (PBUF_POOL_BUFSIZE fits a full MSS, so a JOCP datagram is never chained and
+// is parsed in place). Size the pool for every controller the dongle tracks
+// (JOCP_MAX_CONTROLLERS in wifi/jocp/jocp.h) bursting between two
+// cyw43_arch_poll() calls, plus headroom for TCP control, DHCP and ARP.
+#define JOCP_RX_CONTROLLERS         4   // == JOCP_MAX_CONTROLLERS
+#define JOCP_RX_BURST               6   // Datagrams per controller per poll gap
+#define JOCP_RX_HEADROOM            8
+
 // TCP/UDP configuration
 #define MEMP_NUM_TCP_SEG            32
 #define MEMP_NUM_ARP_QUEUE          10
-#define PBUF_POOL_SIZE              24
+#define MEMP_NUM_TCP_PCB            (JOCP_RX_CONTROLLERS + 1)  // Control channels + spare
+#define PBUF_POOL_SIZE              (JOCP_RX_CONTROLLERS * JOCP_RX_BURST + JOCP_RX_HEADROOM)
 #define TCP_WND                     (8 * TCP_MSS)
 #define TCP_MSS                     1460
 #define TCP_SND_BUF                 (8 * TCP_MSS)
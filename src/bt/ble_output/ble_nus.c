@@ -6,6 +6,12 @@
 // enabling wireless configuration using the same command set as USB CDC.
 // RX: NUS write characteristic → cdc_protocol_rx_byte() → command dispatch
 // TX: cdc_protocol_send() → nordic_spp_service_server_send() (chunked by MTU)
+//
+// Throughput: on connect we ask for the 2M PHY; Data Length Extension is
+// negotiated by the controller (ENABLE_LE_DATA_LENGTH_EXTENSION), and the
+// central's MTU exchange can go up to the ACL payload size. Each can-send-now
+// then pushes as many notifications as the controller has buffers for, so
+// several go out per connection event.
 
 #include "ble_nus.h"
 #include "usb/usbd/cdc/cdc_protocol.h"
@@ -28,10 +34,25 @@ static cdc_protocol_t nus_protocol_ctx;
 static hci_con_handle_t nus_con_handle = HCI_CON_HANDLE_INVALID;
 static bool nus_connected = false;
 
-// TX queue: ring of packets, each sent in MTU-sized chunks
+// TX queue: ring of packets, each sent in MTU-sized chunks. Frames are only
+// ever queued or dropped whole — a frame that has started going out is always
+// finished, so the central never sees a torn frame.
 #define NUS_TX_BUF_SIZE CDC_MAX_PACKET
 #define NUS_TX_QUEUE_SIZE 4  // Number of queued packets
 
+// Slots kept free for command responses: streaming events are skipped
+// (not queued) once fewer than this many slots are left
+#define NUS_TX_RESERVED_SLOTS 2
+
+// Cap on notifications per can-send-now so HID reports sharing the link
+// still get a turn every connection event
+#ifndef NUS_TX_CHUNKS_PER_EVENT
+#define NUS_TX_CHUNKS_PER_EVENT 4
+#endif
+
+// HCI LE PHY bits (Core spec Vol 4, Part E, 7.8.49)
+#define NUS_LE_PHY_2M 0x02
+
 typedef struct {
     uint8_t data[NUS_TX_BUF_SIZE];
     uint16_t len;
@@ -55,62 +76,89 @@ static uint16_t nus_get_max_chunk(void)
     return mtu - 3;  // ATT notification overhead
 }
 
-static void nus_send_next_chunk(void *context)
+static uint8_t nus_tx_count(void)
 {
-    (void)context;
+    return (nus_tx_head + NUS_TX_QUEUE_SIZE - nus_tx_tail) % NUS_TX_QUEUE_SIZE;
+}
 
-    if (nus_tx_tail == nus_tx_head) {
-        // Queue empty
-        nus_tx_active = false;
-        nus_tx_offset = 0;
-        return;
-    }
+static void nus_send_chunks(void *context)
+{
+    (void)context;
 
-    nus_tx_entry_t *entry = &nus_tx_queue[nus_tx_tail];
+    uint16_t max_chunk = nus_get_max_chunk();
 
-    if (nus_tx_offset >= entry->len) {
-        // Current entry fully sent — advance to next
-        nus_tx_tail = (nus_tx_tail + 1) % NUS_TX_QUEUE_SIZE;
-        nus_tx_offset = 0;
+    for (uint8_t sent = 0; sent < NUS_TX_CHUNKS_PER_EVENT; sent++) {
         if (nus_tx_tail == nus_tx_head) {
-            // Queue now empty
+            // Queue empty
             nus_tx_active = false;
+            nus_tx_offset = 0;
             return;
         }
-        entry = &nus_tx_queue[nus_tx_tail];
-    }
 
-    uint16_t max_chunk = nus_get_max_chunk();
-    uint16_t remaining = entry->len - nus_tx_offset;
-    uint16_t chunk_len = remaining < max_chunk ? remaining : max_chunk;
+        nus_tx_entry_t *entry = &nus_tx_queue[nus_tx_tail];
+        uint16_t remaining = entry->len - nus_tx_offset;
+        uint16_t chunk_len = remaining < max_chunk ? remaining : max_chunk;
 
-    int result = nordic_spp_service_server_send(
-        nus_con_handle, &entry->data[nus_tx_offset], chunk_len);
+        int result = nordic_spp_service_server_send(
+            nus_con_handle, &entry->data[nus_tx_offset], chunk_len);
+        if (result != 0) {
+            // Controller buffers full — resume on next CAN_SEND_NOW
+            break;
+        }
 
-    if (result == 0) {
         nus_tx_offset += chunk_len;
-        // If more data in this entry or more entries in queue, keep going
         if (nus_tx_offset >= entry->len) {
+            // Current entry fully sent — advance to next
             nus_tx_tail = (nus_tx_tail + 1) % NUS_TX_QUEUE_SIZE;
             nus_tx_offset = 0;
-            if (nus_tx_tail == nus_tx_head) {
-                nus_tx_active = false;
-                return;
-            }
         }
-        nordic_spp_service_server_request_can_send_now(
-            &nus_send_request, nus_con_handle);
-    } else {
-        // Busy — request CAN_SEND_NOW to retry
-        nordic_spp_service_server_request_can_send_now(
-            &nus_send_request, nus_con_handle);
     }
+
+    if (nus_tx_tail == nus_tx_head) {
+        nus_tx_active = false;
+        return;
+    }
+    nordic_spp_service_server_request_can_send_now(
+        &nus_send_request, nus_con_handle);
+}
+
+// Make room for a response by dropping the oldest queued event that has not
+// started sending. Returns false if every queued frame must be kept.
+static bool nus_drop_queued_event(void)
+{
+    uint8_t first = nus_tx_tail;
+    if (nus_tx_active || nus_tx_offset > 0) {
+        first = (first + 1) % NUS_TX_QUEUE_SIZE;  // In flight — never torn
+    }
+
+    for (uint8_t i = first; i != nus_tx_head; i = (i + 1) % NUS_TX_QUEUE_SIZE) {
+        if (nus_tx_queue[i].data[3] != CDC_MSG_EVT) continue;
+
+        // Close the gap, keeping order
+        uint8_t j = i;
+        uint8_t next = (j + 1) % NUS_TX_QUEUE_SIZE;
+        while (next != nus_tx_head) {
+            nus_tx_queue[j] = nus_tx_queue[next];
+            j = next;
+            next = (next + 1) % NUS_TX_QUEUE_SIZE;
+        }
+        nus_tx_head = j;
+        return true;
+    }
+    return false;
 }
 
 // ============================================================================
 // NUS TRANSPORT WRITE
 // ============================================================================
 
+// Events are latest-state: skip them while the queue is short on room so
+// command responses never have to wait behind (or displace) a stream
+static bool nus_backlogged(void)
+{
+    return NUS_TX_QUEUE_SIZE - 1 - nus_tx_count() < NUS_TX_RESERVED_SLOTS;
+}
+
 static uint32_t nus_write(const uint8_t* data, uint16_t len)
 {
     if (!nus_connected || nus_con_handle == HCI_CON_HANDLE_INVALID) {
@@ -122,12 +170,13 @@ static uint32_t nus_write(const uint8_t* data, uint16_t len)
         return 0;
     }
 
-    // Check if queue is full
+    // Check if queue is full — whole frames only, the one in flight is kept
     uint8_t next_head = (nus_tx_head + 1) % NUS_TX_QUEUE_SIZE;
     if (next_head == nus_tx_tail) {
-        // Queue full — drop oldest entry (stream event) to make room
-        nus_tx_tail = (nus_tx_tail + 1) % NUS_TX_QUEUE_SIZE;
-        nus_tx_offset = 0;
+        if (data[3] == CDC_MSG_EVT || !nus_drop_queued_event()) {
+            return 0;
+        }
+        next_head = (nus_tx_head + 1) % NUS_TX_QUEUE_SIZE;
     }
 
     // Enqueue the packet
@@ -138,7 +187,7 @@ static uint32_t nus_write(const uint8_t* data, uint16_t len)
     // If not already sending, kick off transmission
     if (!nus_tx_active) {
         nus_tx_active = true;
-        nus_send_next_chunk(NULL);
+        nus_send_chunks(NULL);
     }
 
     return len;
@@ -175,6 +224,8 @@ static void nus_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *p
                            nus_con_handle, att_server_get_mtu(nus_con_handle));
                     // Request faster connection interval for streaming (7.5-15ms)
                     gap_request_connection_parameter_update(nus_con_handle, 6, 12, 0, 200);
+                    // Prefer the 2M PHY both ways (falls back to 1M if the central can't)
+                    gap_le_set_phy(nus_con_handle, 0, NUS_LE_PHY_2M, NUS_LE_PHY_2M, 0);
                     break;
 
                 case GATTSERVICE_SUBEVENT_SPP_SERVICE_DISCONNECTED:
@@ -206,10 +257,11 @@ void ble_nus_init(void)
     // Initialize protocol context with NUS transport
     cdc_protocol_init(&nus_protocol_ctx, cdc_commands_process);
     nus_protocol_ctx.write = nus_write;
+    nus_protocol_ctx.backlogged = nus_backlogged;
     nus_protocol_ctx.ble_transport = true;
 
     // Set up context callback for chunked TX flow control
-    nus_send_request.callback = &nus_send_next_chunk;
+    nus_send_request.callback = &nus_send_chunks;
 
     // Initialize Nordic SPP (NUS) service
     nordic_spp_service_server_init(&nus_packet_handler);
@@ -6,12 +6,13 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "bt/btstack/bt_limits.h"
 
 // ============================================================================
 // CONSTANTS
 // ============================================================================
 
-#define BTHID_MAX_DEVICES       4   // Max simultaneous BT HID devices
+#define BTHID_MAX_DEVICES       BT_MAX_CONTROLLERS  // Max simultaneous BT HID devices
 #define BTHID_MAX_NAME_LEN      48  // Max device name length
 
 // ============================================================================
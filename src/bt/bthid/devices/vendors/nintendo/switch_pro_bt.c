@@ -11,6 +11,7 @@
 #include "core/buttons.h"
 #include "core/services/players/manager.h"
 #include "core/services/players/feedback.h"
+#include "core/services/motion/imu.h"
 #include "platform/platform.h"
 #include <string.h>
 #include <stdio.h>
@@ -38,6 +39,15 @@
 // Init delay between subcommands (ms)
 #define SWITCH_INIT_DELAY_MS            200
 
+// IMU frames in full mode (0x30) reports: three frames, oldest first and
+// 5 ms apart, at bytes 13-48 (accel X/Y/Z then gyro X/Y/Z, int16 LE)
+#define SWITCH_IMU_OFFSET               13
+#define SWITCH_IMU_FRAME_SIZE           12
+#define SWITCH_IMU_FRAMES               3
+#define SWITCH_IMU_FRAME_US             5000
+#define SWITCH_IMU_ACCEL_RANGE          8000    // ±8 g (milli-g)
+#define SWITCH_IMU_GYRO_RANGE           2000    // ±2000 dps
+
 // ============================================================================
 // SWITCH PRO REPORT STRUCTURE
 // ============================================================================
@@ -128,6 +138,7 @@ typedef enum {
     SWITCH_STATE_WAIT_READY,        // Wait before sending first subcommand
     SWITCH_STATE_SET_INPUT_MODE,    // Send set input mode (0x03 → 0x30)
     SWITCH_STATE_ENABLE_VIBRATION,  // Send enable vibration (0x48 → 0x01)
+    SWITCH_STATE_ENABLE_IMU,        // Send enable IMU (0x40 → 0x01)
     SWITCH_STATE_SET_PLAYER_LED,    // Send player LED (0x30)
     SWITCH_STATE_ACTIVE,            // Init complete, monitor feedback
 } switch_init_state_t;
@@ -140,6 +151,7 @@ typedef struct {
     input_event_t event;
     bool initialized;
     bool full_report_mode;
+    bool imu_enabled;
     uint8_t output_seq;     // Sequence counter for output reports
     switch_init_state_t init_state;
     uint32_t init_time;     // Timestamp for init delays
@@ -172,6 +184,20 @@ static uint8_t scale_12bit_to_8bit(uint16_t val)
     return 1 + ((val * 254) / 4095);
 }
 
+// Decode one IMU frame into DS4 axis order (X right, Y up, Z toward the player)
+static void decode_imu_frame(const uint8_t* f, int16_t accel[3], int16_t gyro[3])
+{
+    int16_t ax = (int16_t)(f[0] | (f[1] << 8));
+    int16_t ay = (int16_t)(f[2] | (f[3] << 8));
+    int16_t az = (int16_t)(f[4] | (f[5] << 8));
+    int16_t gx = (int16_t)(f[6] | (f[7] << 8));
+    int16_t gy = (int16_t)(f[8] | (f[9] << 8));
+    int16_t gz = (int16_t)(f[10] | (f[11] << 8));
+
+    accel[0] = -ay; accel[1] = az; accel[2] = -ax;
+    gyro[0] = -gy;  gyro[1] = gz;  gyro[2] = -gx;
+}
+
 // Encode rumble intensity to Switch rumble format (from USB Switch Pro driver)
 // Each motor uses 4 bytes: [amplitude, HF_freq, amplitude/2, LF_freq]
 // Neutral state: [00 01 40 40]
@@ -275,6 +301,7 @@ static bool switch_init(bthid_device_t* device)
             init_input_event(&switch_data[i].event);
             switch_data[i].initialized = true;
             switch_data[i].full_report_mode = false;
+            switch_data[i].imu_enabled = false;
             switch_data[i].output_seq = 0;
             switch_data[i].rumble_left = 0;
             switch_data[i].rumble_right = 0;
@@ -288,6 +315,8 @@ static bool switch_init(bthid_device_t* device)
             switch_data[i].event.dev_addr = device->conn_index;
             switch_data[i].event.instance = 0;
             switch_data[i].event.button_count = 10;
+            switch_data[i].event.accel_range = SWITCH_IMU_ACCEL_RANGE;
+            switch_data[i].event.gyro_range = SWITCH_IMU_GYRO_RANGE;
 
             device->driver_data = &switch_data[i];
             return true;
@@ -358,6 +387,22 @@ static void switch_process_report(bthid_device_t* device, const uint8_t* data, u
         sw->event.battery_level = (bat_raw > 8) ? 100 : bat_raw * 12 + 5;
         sw->event.battery_charging = (rpt->battery_conn & 0x08) != 0;
 
+        // Motion: queue all three frames at their capture time, the event
+        // carries the newest one
+        if (sw->imu_enabled &&
+            len >= SWITCH_IMU_OFFSET + SWITCH_IMU_FRAME_SIZE * SWITCH_IMU_FRAMES) {
+            uint32_t now_us = platform_time_us();
+            for (int i = 0; i < SWITCH_IMU_FRAMES; i++) {
+                decode_imu_frame(&data[SWITCH_IMU_OFFSET + i * SWITCH_IMU_FRAME_SIZE],
+                                 sw->event.accel, sw->event.gyro);
+                imu_push(sw->event.dev_addr, sw->event.instance,
+                         sw->event.accel, sw->event.gyro,
+                         SWITCH_IMU_ACCEL_RANGE, SWITCH_IMU_GYRO_RANGE,
+                         now_us - (SWITCH_IMU_FRAMES - 1 - i) * SWITCH_IMU_FRAME_US);
+            }
+            sw->event.has_motion = true;
+        }
+
         router_submit_input(&sw->event);
 
     } else if (report_id == SWITCH_REPORT_INPUT_SIMPLE && len >= 12) {
@@ -428,6 +473,17 @@ static void switch_task(bthid_device_t* device)
             break;
 
         case SWITCH_STATE_ENABLE_VIBRATION:
+            if (now - sw->init_time >= SWITCH_INIT_DELAY_MS) {
+                printf("[SWITCH_BT] Sending enable IMU\n");
+                uint8_t enable = 0x01;
+                switch_send_subcommand(device, SWITCH_SUBCMD_ENABLE_IMU, &enable, 1);
+                sw->imu_enabled = true;
+                sw->init_state = SWITCH_STATE_ENABLE_IMU;
+                sw->init_time = now;
+            }
+            break;
+
+        case SWITCH_STATE_ENABLE_IMU:
             if (now - sw->init_time >= SWITCH_INIT_DELAY_MS) {
                 // Set player LED based on player index
                 int player_idx = find_player_index(sw->event.dev_addr, sw->event.instance);
@@ -0,0 +1,39 @@
+// bt_limits.h - Bluetooth host connection budget
+//
+// How many controllers the BT host serves at once, and what that costs in
+// each layer. The BTstack configs (all platforms), bthid's device table and
+// the transport conn_index space derive their sizes from here so they can't
+// drift apart again.
+
+#ifndef BT_LIMITS_H
+#define BT_LIMITS_H
+
+// Simultaneous controllers, Classic and BLE mixed
+#ifndef BT_MAX_CONTROLLERS
+#define BT_MAX_CONTROLLERS          4
+#endif
+
+// Either transport can fill every controller slot. conn_index space is
+// Classic 0..N-1 followed by BLE N..2N-1.
+#define BT_MAX_CLASSIC_LINKS        BT_MAX_CONTROLLERS
+#define BT_MAX_BLE_LINKS            BT_MAX_CONTROLLERS
+#define BT_MAX_CONN_INDEX           (BT_MAX_CLASSIC_LINKS + BT_MAX_BLE_LINKS)
+
+// ============================================================================
+// PER-CONNECTION BTSTACK BUDGET
+// ============================================================================
+
+// One ACL per controller, plus one so a pad past the limit can still be
+// paged in and turned away cleanly
+#define BT_BUDGET_HCI_CONNECTIONS   (BT_MAX_CONTROLLERS + 1)
+
+// Classic HID: Control + Interrupt per pad, plus SDP client and server
+#define BT_BUDGET_L2CAP_CHANNELS    (BT_MAX_CLASSIC_LINKS * 2 + 2)
+
+// BLE: one GATT client context (HIDS, BAS, listeners share it) per pad
+#define BT_BUDGET_GATT_CLIENTS      BT_MAX_BLE_LINKS
+
+// Bonds kept per transport (oldest is evicted past this)
+#define BT_BUDGET_BONDS             BT_MAX_CONTROLLERS
+
+#endif // BT_LIMITS_H
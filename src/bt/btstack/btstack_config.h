@@ -6,6 +6,8 @@
 #ifndef BTSTACK_CONFIG_H
 #define BTSTACK_CONFIG_H
 
+#include "bt_limits.h"
+
 // ============================================================================
 // PORT FEATURES
 // ============================================================================
@@ -42,6 +44,8 @@
 #define ENABLE_LE_CENTRAL
 #define ENABLE_LE_PERIPHERAL
 #define ENABLE_LE_SECURE_CONNECTIONS
+// Controller negotiates 251-byte LL payloads (NUS config / bulk notifications)
+#define ENABLE_LE_DATA_LENGTH_EXTENSION
 
 // Enable Classic Bluetooth
 // Use #ifndef to avoid redefinition when pico_btstack_classic is linked
@@ -83,30 +87,30 @@
 // ============================================================================
 
 // Number of HCI connections (Classic + BLE)
-#define MAX_NR_HCI_CONNECTIONS 2
+#define MAX_NR_HCI_CONNECTIONS BT_BUDGET_HCI_CONNECTIONS
 
-// Number of L2CAP channels (Classic HID needs Control + Interrupt + SDP per device)
-#define MAX_NR_L2CAP_CHANNELS 8
+// Number of L2CAP channels (Classic HID needs Control + Interrupt per device, plus SDP)
+#define MAX_NR_L2CAP_CHANNELS BT_BUDGET_L2CAP_CHANNELS
 
 // Number of L2CAP services
 #define MAX_NR_L2CAP_SERVICES 3
 
-// Number of GATT clients (for BLE devices)
-#define MAX_NR_GATT_CLIENTS 1
+// Number of GATT clients (one per BLE device)
+#define MAX_NR_GATT_CLIENTS BT_BUDGET_GATT_CLIENTS
 
 // Number of whitelist entries
-#define MAX_NR_WHITELIST_ENTRIES 2
+#define MAX_NR_WHITELIST_ENTRIES BT_MAX_BLE_LINKS
 
 // LE Device DB entries (for bonding storage)
-#define MAX_NR_LE_DEVICE_DB_ENTRIES 2
+#define MAX_NR_LE_DEVICE_DB_ENTRIES BT_BUDGET_BONDS
 
 // Link keys storage (Classic BT)
-#define NVM_NUM_LINK_KEYS 2
-#define MAX_NR_BTSTACK_LINK_KEY_DB_MEMORY_ENTRIES 4
+#define NVM_NUM_LINK_KEYS BT_BUDGET_BONDS
+#define MAX_NR_BTSTACK_LINK_KEY_DB_MEMORY_ENTRIES BT_BUDGET_BONDS
 
 // NVM storage for device DB (flash-based TLV storage)
 // Both USB dongle and CYW43 builds now use le_device_db_tlv.c for persistent storage
-#define NVM_NUM_DEVICE_DB_ENTRIES 4
+#define NVM_NUM_DEVICE_DB_ENTRIES BT_BUDGET_BONDS
 
 // ============================================================================
 // HID SUPPORT
@@ -116,13 +120,13 @@
 #define ENABLE_HID_HOST
 
 // Number of HID Host connections (Classic BT HID devices)
-#define MAX_NR_HID_HOST_CONNECTIONS 2
+#define MAX_NR_HID_HOST_CONNECTIONS BT_MAX_CLASSIC_LINKS
 
 // Number of HIDS clients (BLE HID Service clients)
-#define MAX_NR_HIDS_CLIENTS 1
+#define MAX_NR_HIDS_CLIENTS BT_MAX_BLE_LINKS
 
 // Number of Battery Service clients (BLE Battery Service)
-#define MAX_NR_BATTERY_SERVICE_CLIENTS 1
+#define MAX_NR_BATTERY_SERVICE_CLIENTS BT_MAX_BLE_LINKS
 
 // Number of HIDS Device instances (BLE HID peripheral output)
 #define MAX_NR_HIDS_DEVICES 1
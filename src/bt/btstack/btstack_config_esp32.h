@@ -6,6 +6,8 @@
 #ifndef BTSTACK_CONFIG_H
 #define BTSTACK_CONFIG_H
 
+#include "bt_limits.h"
+
 // ============================================================================
 // PORT FEATURES
 // ============================================================================
@@ -30,6 +32,8 @@
 #define ENABLE_LE_CENTRAL
 #define ENABLE_LE_PERIPHERAL
 #define ENABLE_LE_SECURE_CONNECTIONS
+// Controller negotiates 251-byte LL payloads (NUS config / bulk notifications)
+#define ENABLE_LE_DATA_LENGTH_EXTENSION
 
 // Classic BT enabled for compilation (drivers compile but are dead code)
 // The ESP32-S3 controller only supports BLE, so Classic connections
@@ -70,29 +74,29 @@
 // ============================================================================
 
 // Number of HCI connections
-#define MAX_NR_HCI_CONNECTIONS 2
+#define MAX_NR_HCI_CONNECTIONS BT_BUDGET_HCI_CONNECTIONS
 
-// L2CAP channels (Classic HID needs Control + Interrupt + SDP per device)
-#define MAX_NR_L2CAP_CHANNELS 8
+// L2CAP channels (Classic HID needs Control + Interrupt per device, plus SDP)
+#define MAX_NR_L2CAP_CHANNELS BT_BUDGET_L2CAP_CHANNELS
 
 // L2CAP services
 #define MAX_NR_L2CAP_SERVICES 3
 
-// GATT clients (for BLE devices)
-#define MAX_NR_GATT_CLIENTS 1
+// GATT clients (one per BLE device)
+#define MAX_NR_GATT_CLIENTS BT_BUDGET_GATT_CLIENTS
 
 // Whitelist entries
-#define MAX_NR_WHITELIST_ENTRIES 2
+#define MAX_NR_WHITELIST_ENTRIES BT_MAX_BLE_LINKS
 
 // LE Device DB entries (for bonding storage)
-#define MAX_NR_LE_DEVICE_DB_ENTRIES 4
+#define MAX_NR_LE_DEVICE_DB_ENTRIES BT_BUDGET_BONDS
 
 // Link keys storage (Classic BT - needed for compilation)
-#define NVM_NUM_LINK_KEYS 2
-#define MAX_NR_BTSTACK_LINK_KEY_DB_MEMORY_ENTRIES 4
+#define NVM_NUM_LINK_KEYS BT_BUDGET_BONDS
+#define MAX_NR_BTSTACK_LINK_KEY_DB_MEMORY_ENTRIES BT_BUDGET_BONDS
 
 // NVM storage for device DB
-#define NVM_NUM_DEVICE_DB_ENTRIES 4
+#define NVM_NUM_DEVICE_DB_ENTRIES BT_BUDGET_BONDS
 
 // ============================================================================
 // HID SUPPORT
@@ -102,12 +106,12 @@
 #define ENABLE_HID_HOST
 
 // Number of HID Host connections
-#define MAX_NR_HID_HOST_CONNECTIONS 2
+#define MAX_NR_HID_HOST_CONNECTIONS BT_MAX_CLASSIC_LINKS
 
 // Number of HIDS clients (BLE HID Service clients)
-#define MAX_NR_HIDS_CLIENTS 1
+#define MAX_NR_HIDS_CLIENTS BT_MAX_BLE_LINKS
 
 // Number of Battery Service clients (BLE Battery Service)
-#define MAX_NR_BATTERY_SERVICE_CLIENTS 1
+#define MAX_NR_BATTERY_SERVICE_CLIENTS BT_MAX_BLE_LINKS
 
 #endif // BTSTACK_CONFIG_H
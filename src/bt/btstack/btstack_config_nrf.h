@@ -6,6 +6,8 @@
 #ifndef BTSTACK_CONFIG_H
 #define BTSTACK_CONFIG_H
 
+#include "bt_limits.h"
+
 // ============================================================================
 // PORT FEATURES
 // ============================================================================
@@ -25,6 +27,8 @@
 #define ENABLE_LE_CENTRAL
 #define ENABLE_LE_PERIPHERAL
 #define ENABLE_LE_SECURE_CONNECTIONS
+// Controller negotiates 251-byte LL payloads (NUS config / bulk notifications)
+#define ENABLE_LE_DATA_LENGTH_EXTENSION
 
 // Classic BT enabled for compilation (drivers compile but are dead code)
 // The nRF52840 controller only supports BLE, so Classic connections
@@ -64,23 +68,23 @@
 // MEMORY POOLS
 // ============================================================================
 
-#define MAX_NR_HCI_CONNECTIONS 2
-#define MAX_NR_L2CAP_CHANNELS 8
+#define MAX_NR_HCI_CONNECTIONS BT_BUDGET_HCI_CONNECTIONS
+#define MAX_NR_L2CAP_CHANNELS BT_BUDGET_L2CAP_CHANNELS
 #define MAX_NR_L2CAP_SERVICES 3
-#define MAX_NR_GATT_CLIENTS 1
-#define MAX_NR_WHITELIST_ENTRIES 2
-#define MAX_NR_LE_DEVICE_DB_ENTRIES 4
-#define NVM_NUM_LINK_KEYS 2
-#define MAX_NR_BTSTACK_LINK_KEY_DB_MEMORY_ENTRIES 4
-#define NVM_NUM_DEVICE_DB_ENTRIES 4
+#define MAX_NR_GATT_CLIENTS BT_BUDGET_GATT_CLIENTS
+#define MAX_NR_WHITELIST_ENTRIES BT_MAX_BLE_LINKS
+#define MAX_NR_LE_DEVICE_DB_ENTRIES BT_BUDGET_BONDS
+#define NVM_NUM_LINK_KEYS BT_BUDGET_BONDS
+#define MAX_NR_BTSTACK_LINK_KEY_DB_MEMORY_ENTRIES BT_BUDGET_BONDS
+#define NVM_NUM_DEVICE_DB_ENTRIES BT_BUDGET_BONDS
 
 // ============================================================================
 // HID SUPPORT
 // ============================================================================
 
 #define ENABLE_HID_HOST
-#define MAX_NR_HID_HOST_CONNECTIONS 2
-#define MAX_NR_HIDS_CLIENTS 1
-#define MAX_NR_BATTERY_SERVICE_CLIENTS 1
+#define MAX_NR_HID_HOST_CONNECTIONS BT_MAX_CLASSIC_LINKS
+#define MAX_NR_HIDS_CLIENTS BT_MAX_BLE_LINKS
+#define MAX_NR_BATTERY_SERVICE_CLIENTS BT_MAX_BLE_LINKS
 
 #endif // BTSTACK_CONFIG_H
@@ -15,6 +15,7 @@ void btstack_host_enable_scan(void) {
 }
 #endif
 #include "btstack_config.h"
+#include "bt_limits.h"
 #include "bt_device_db.h"
 // Include specific BTstack headers instead of umbrella btstack.h
 // (btstack.h pulls in audio codecs which need sbc_encoder.h)
@@ -51,14 +52,16 @@ extern void btstack_memory_init(void);
 #include "classic/device_id_server.h"
 
 // Link key storage: TLV (flash) based for all builds
-// USB dongle uses pico_flash_bank_instance(), CYW43/ESP32 use their own TLV setup
-#if !defined(BTSTACK_USE_CYW43) && !defined(BTSTACK_USE_ESP32) && !defined(BTSTACK_USE_NRF)
+// RP2040 (USB dongle and CYW43) uses a flash bank on the flash scheduler,
+// ESP32/nRF use their own TLV setup
+#if !defined(BTSTACK_USE_ESP32) && !defined(BTSTACK_USE_NRF)
 #include "classic/btstack_link_key_db_tlv.h"
 #include "ble/le_device_db_tlv.h"
 #include "btstack_tlv_flash_bank.h"
+#include "hal_flash_bank.h"
 #include "pico/btstack_flash_bank.h"
-#include "pico/flash.h"
 #include "hardware/flash.h"
+#include "core/services/storage/flash_sched.h"
 #endif
 
 #include "btstack_tlv.h"
@@ -88,37 +91,102 @@ extern int find_player_index(int dev_addr, int instance);
 // ============================================================================
 // FLASH HELPERS (for TLV storage)
 // ============================================================================
-#if !defined(BTSTACK_USE_CYW43) && !defined(BTSTACK_USE_ESP32) && !defined(BTSTACK_USE_NRF)
-// Erase both BTstack flash banks (8KB total at end of flash)
-static void __no_inline_not_in_flash_func(flash_erase_banks_func)(void* p) {
-    (void)p;
-    uint32_t flash_offset = PICO_FLASH_SIZE_BYTES - (FLASH_SECTOR_SIZE * 2);
-    // Erase both 4KB sectors
-    flash_range_erase(flash_offset, FLASH_SECTOR_SIZE * 2);
+#if !defined(BTSTACK_USE_ESP32) && !defined(BTSTACK_USE_NRF)
+// Same banks as pico_flash_bank_instance(), but erases and programs are
+// queued on the flash scheduler so pairing mid-game doesn't stall console
+// output. Reads go through the queue, so BTstack sees its writes at once.
+#define TLV_BANK_SIZE (PICO_FLASH_BANK_TOTAL_SIZE / 2)
+
+static uint32_t tlv_bank_offset(int bank)
+{
+    return PICO_FLASH_BANK_STORAGE_OFFSET + (uint32_t)bank * TLV_BANK_SIZE;
 }
 
-// Erase BTstack flash banks using flash_safe_execute
-static void btstack_erase_flash_banks(void) {
-    printf("[BTSTACK_HOST] Erasing BTstack flash banks at 0x%lX...\n",
-           (unsigned long)(PICO_FLASH_SIZE_BYTES - (FLASH_SECTOR_SIZE * 2)));
-    int result = flash_safe_execute(flash_erase_banks_func, NULL, UINT32_MAX);
-    if (result == PICO_OK) {
-        printf("[BTSTACK_HOST] Flash banks erased successfully\n");
-    } else {
-        printf("[BTSTACK_HOST] Flash erase failed: %d\n", result);
+static uint32_t sched_bank_get_size(void* context)
+{
+    (void)context;
+    return TLV_BANK_SIZE;
+}
+
+static uint32_t sched_bank_get_alignment(void* context)
+{
+    (void)context;
+    return 1;
+}
+
+static void sched_bank_erase(void* context, int bank)
+{
+    (void)context;
+    for (uint32_t off = 0; off < TLV_BANK_SIZE; off += FLASH_SECTOR_SIZE) {
+        if (!flash_sched_erase(tlv_bank_offset(bank) + off)) {
+            printf("[BTSTACK_HOST] Flash queue full, TLV bank %d erase dropped\n", bank);
+        }
+    }
+}
+
+static void sched_bank_read(void* context, int bank, uint32_t offset,
+                            uint8_t* buffer, uint32_t size)
+{
+    (void)context;
+    if (offset > TLV_BANK_SIZE || size > TLV_BANK_SIZE - offset) return;
+    flash_sched_read(tlv_bank_offset(bank) + offset, buffer, size);
+}
+
+// Byte-granular write: read-modify-write each touched page
+static void sched_bank_write(void* context, int bank, uint32_t offset,
+                             const uint8_t* data, uint32_t size)
+{
+    (void)context;
+    if (offset > TLV_BANK_SIZE || size > TLV_BANK_SIZE - offset) return;
+
+    uint32_t addr = tlv_bank_offset(bank) + offset;
+    while (size > 0) {
+        uint32_t page = addr & ~(uint32_t)(FLASH_PAGE_SIZE - 1);
+        uint32_t in_page = addr - page;
+        uint32_t chunk = FLASH_PAGE_SIZE - in_page;
+        if (chunk > size) chunk = size;
+
+        uint8_t buf[FLASH_PAGE_SIZE];
+        flash_sched_read(page, buf, FLASH_PAGE_SIZE);
+        memcpy(buf + in_page, data, chunk);
+        if (!flash_sched_program(page, buf, FLASH_PAGE_SIZE)) {
+            printf("[BTSTACK_HOST] Flash queue full, TLV write at 0x%lX dropped\n",
+                   (unsigned long)page);
+        }
+
+        addr += chunk;
+        data += chunk;
+        size -= chunk;
     }
 }
+
+static const hal_flash_bank_t sched_flash_bank = {
+    .get_size      = sched_bank_get_size,
+    .get_alignment = sched_bank_get_alignment,
+    .erase         = sched_bank_erase,
+    .read          = sched_bank_read,
+    .write         = sched_bank_write,
+};
+
+// Erase both BTstack flash banks
+static void btstack_erase_flash_banks(void)
+{
+    printf("[BTSTACK_HOST] Erasing BTstack flash banks at 0x%lX...\n",
+           (unsigned long)tlv_bank_offset(0));
+    sched_bank_erase(NULL, 0);
+    sched_bank_erase(NULL, 1);
+}
 #endif
 
 // ============================================================================
 // BLE HID REPORT ROUTING
 // ============================================================================
 
-// Deferred processing to avoid stack overflow in BTstack callback
-static uint8_t pending_ble_report[64];  // 64 bytes for Switch 2 reports
-static uint16_t pending_ble_report_len = 0;
-static uint8_t pending_ble_conn_index = 0;
-static volatile bool ble_report_pending = false;
+// Reports from the direct notification listeners are parked per connection
+// (ble_connection_t.pending_report) and routed from btstack_host_process to
+// avoid stack overflow in the BTstack callback. Per connection so one pad's
+// report never overwrites another's before it's delivered.
+#define BLE_PENDING_REPORT_SIZE 64  // 64 bytes for Switch 2 reports
 
 // Forward declare the function to route BLE reports through bthid layer
 static void route_ble_hid_report(uint8_t conn_index, const uint8_t* data, uint16_t len);
@@ -131,7 +199,7 @@ static void switch2_handle_feedback(void);
 // CONFIGURATION
 // ============================================================================
 
-#define MAX_BLE_CONNECTIONS 2
+#define MAX_BLE_CONNECTIONS BT_MAX_BLE_LINKS
 #ifndef SCAN_INTERVAL
 #define SCAN_INTERVAL 0x00A0  // 100ms (default)
 #endif
@@ -139,6 +207,21 @@ static void switch2_handle_feedback(void);
 #define SCAN_WINDOW   0x0050  // 50ms (default)
 #endif
 
+// BLE link scheduling: every pad runs on one fixed connection interval, sized
+// for BT_MAX_BLE_LINKS so each possible link's connection event gets its own
+// slot plus one slot left over for scanning and Classic traffic. Links are
+// created at that interval and never re-planned, so a pad's report rate
+// doesn't change when other pads join or leave.
+#define BLE_LINK_SLOT_UNITS          2       // 2.5ms per link (1.25ms units)
+#define BLE_LINK_SHARED_UNITS        2       // 2.5ms for scan / Classic
+#define BLE_LINK_INTERVAL_MIN        6       // 7.5ms, spec minimum
+#define BLE_LINK_INTERVAL_SLOTS      (BT_MAX_BLE_LINKS * BLE_LINK_SLOT_UNITS + BLE_LINK_SHARED_UNITS)
+#define BLE_LINK_INTERVAL            (BLE_LINK_INTERVAL_SLOTS < BLE_LINK_INTERVAL_MIN ? \
+                                      BLE_LINK_INTERVAL_MIN : BLE_LINK_INTERVAL_SLOTS)
+#define BLE_LINK_SUPERVISION_TIMEOUT 200     // 2s (10ms units)
+#define BLE_CONNECT_SCAN_INTERVAL    0x0060  // 60ms while creating a connection
+#define BLE_CONNECT_SCAN_WINDOW      0x0030  // 30ms
+
 // ============================================================================
 // STATE
 // ============================================================================
@@ -173,6 +256,21 @@ typedef struct {
     // Connection index for bthid layer (offset by MAX_CLASSIC_CONNECTIONS)
     uint8_t conn_index;
     bool hid_ready;
+    uint16_t conn_interval;         // Current interval (1.25ms units)
+
+    // GATT service clients (one set per connection)
+    uint16_t hids_cid;
+    uint16_t bas_cid;
+    bool dis_pending;               // Waiting for the shared DIS client
+
+    // Direct notification listener (Xbox / Switch 2 fast paths)
+    gatt_client_notification_t hid_listener;
+    gatt_client_characteristic_t hid_characteristic;
+
+    // Report parked by the listener for btstack_host_process
+    uint8_t pending_report[BLE_PENDING_REPORT_SIZE];
+    uint16_t pending_report_len;
+    volatile bool report_pending;
 } ble_connection_t;
 
 // BLE conn_index offset (BLE devices use conn_index >= this value)
@@ -228,11 +326,9 @@ static struct {
     btstack_host_report_callback_t report_callback;
     btstack_host_connect_callback_t connect_callback;
 
-    // HIDS Client
-    uint16_t hids_cid;
-
-    // Battery Service Client
-    uint16_t bas_cid;
+    // Device Information client is a singleton, queries run one at a time
+    bool dis_active;
+    hci_con_handle_t dis_handle;
 
 } hid_state;
 
@@ -242,24 +338,18 @@ static uint8_t hid_descriptor_storage[512];
 static btstack_packet_callback_registration_t hci_event_callback_registration;
 static btstack_packet_callback_registration_t sm_event_callback_registration;
 
-// Direct notification listener for Xbox HID reports (bypasses HIDS client)
-static gatt_client_notification_t xbox_hid_notification_listener;
-static gatt_client_characteristic_t xbox_hid_characteristic;  // Fake characteristic for listener
-static void xbox_hid_notification_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size);
-
-// Direct notification listener for Switch 2 HID reports
-static gatt_client_notification_t switch2_hid_notification_listener;
-static gatt_client_characteristic_t switch2_hid_characteristic;
+// Direct notification listeners for Xbox / Switch 2 HID reports (bypass HIDS client)
+static void ble_hid_notification_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size);
 static void switch2_hid_notification_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size);
 
 // Forward declaration for BLE disconnect cleanup (defined in Switch 2 section)
-static void switch2_cleanup_on_disconnect(void);
+static void switch2_cleanup_on_disconnect(hci_con_handle_t handle);
 
 // ============================================================================
 // CLASSIC BT HID HOST STATE
 // ============================================================================
 
-#define MAX_CLASSIC_CONNECTIONS 4
+#define MAX_CLASSIC_CONNECTIONS BT_MAX_CLASSIC_LINKS
 #define INQUIRY_DURATION 5  // Inquiry duration in 1.28s units
 #define CLASSIC_CONNECT_TIMEOUT_MS 15000  // Max time to establish HID connection
 
@@ -337,7 +427,11 @@ typedef struct {
     bool hid_host_ready;  // True when HID Host is ready to send (after DESCRIPTOR_AVAILABLE)
 } wiimote_connection_t;
 
-static wiimote_connection_t wiimote_conn;
+// One per Classic slot, so any mix of Wiimotes, Wii U Pros and (on CYW43)
+// Sony pads can be connected at once
+#define MAX_WIIMOTE_CONNECTIONS MAX_CLASSIC_CONNECTIONS
+
+static wiimote_connection_t wiimote_conns[MAX_WIIMOTE_CONNECTIONS];
 
 // Forward declaration
 static void wiimote_l2cap_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size);
@@ -382,6 +476,89 @@ static classic_connection_t* find_free_classic_connection(void) {
     return NULL;
 }
 
+// All controller slots taken (Classic and BLE share BT_MAX_CONTROLLERS)
+static bool controller_slots_full(void) {
+    return btstack_classic_get_connection_count() >= BT_MAX_CONTROLLERS;
+}
+
+// ============================================================================
+// WIIMOTE CONNECTION HELPERS
+// ============================================================================
+
+static wiimote_connection_t* find_wiimote_by_addr(const bd_addr_t addr) {
+    for (int i = 0; i < MAX_WIIMOTE_CONNECTIONS; i++) {
+        if (wiimote_conns[i].active && memcmp(wiimote_conns[i].addr, addr, 6) == 0) {
+            return &wiimote_conns[i];
+        }
+    }
+    return NULL;
+}
+
+static wiimote_connection_t* find_wiimote_by_handle(hci_con_handle_t handle) {
+    for (int i = 0; i < MAX_WIIMOTE_CONNECTIONS; i++) {
+        if (wiimote_conns[i].active && wiimote_conns[i].acl_handle == handle) {
+            return &wiimote_conns[i];
+        }
+    }
+    return NULL;
+}
+
+// Find by local L2CAP CID (control or interrupt channel)
+static wiimote_connection_t* find_wiimote_by_cid(uint16_t cid) {
+    if (cid == 0) return NULL;
+    for (int i = 0; i < MAX_WIIMOTE_CONNECTIONS; i++) {
+        if (wiimote_conns[i].active &&
+            (wiimote_conns[i].control_cid == cid || wiimote_conns[i].interrupt_cid == cid)) {
+            return &wiimote_conns[i];
+        }
+    }
+    return NULL;
+}
+
+static wiimote_connection_t* find_wiimote_by_conn_index(int conn_index) {
+    if (conn_index < 0) return NULL;
+    for (int i = 0; i < MAX_WIIMOTE_CONNECTIONS; i++) {
+        if (wiimote_conns[i].active && wiimote_conns[i].conn_index == conn_index) {
+            return &wiimote_conns[i];
+        }
+    }
+    return NULL;
+}
+
+// Claim a cleared entry for addr (reusing a stale one for the same device)
+static wiimote_connection_t* alloc_wiimote_connection(const bd_addr_t addr) {
+    wiimote_connection_t* wm = find_wiimote_by_addr(addr);
+    for (int i = 0; !wm && i < MAX_WIIMOTE_CONNECTIONS; i++) {
+        if (!wiimote_conns[i].active) {
+            wm = &wiimote_conns[i];
+        }
+    }
+    if (!wm) {
+        printf("[BTSTACK_HOST] Wiimote: no free direct L2CAP slot\n");
+        return NULL;
+    }
+
+    memset(wm, 0, sizeof(*wm));
+    wm->active = true;
+    wm->state = WIIMOTE_STATE_IDLE;
+    wm->conn_index = -1;  // Not assigned yet
+    memcpy(wm->addr, addr, 6);
+    return wm;
+}
+
+// Direct L2CAP link is gone: notify bthid and free the classic slot it owns.
+// Slots opened through HID Host are freed on HID_SUBEVENT_CONNECTION_CLOSED.
+static void release_wiimote_connection(wiimote_connection_t* wm) {
+    if (wm->conn_index >= 0 && wm->conn_index < MAX_CLASSIC_CONNECTIONS) {
+        classic_connection_t* conn = &classic_state.connections[wm->conn_index];
+        if (conn->active && conn->hid_cid == 0xFFFF) {
+            bt_on_disconnect(wm->conn_index);
+            memset(conn, 0, sizeof(*conn));
+        }
+    }
+    memset(wm, 0, sizeof(*wm));
+}
+
 // ============================================================================
 // BLE CONNECTION HELPERS
 // ============================================================================
@@ -405,6 +582,63 @@ static int get_ble_conn_index_by_handle(hci_con_handle_t handle) {
     return -1;
 }
 
+// Find BLE connection by HIDS client CID
+static ble_connection_t* find_connection_by_hids_cid(uint16_t hids_cid) {
+    if (hids_cid == 0) return NULL;
+    for (int i = 0; i < MAX_BLE_CONNECTIONS; i++) {
+        if (hid_state.connections[i].handle != HCI_CON_HANDLE_INVALID &&
+            hid_state.connections[i].hids_cid == hids_cid) {
+            return &hid_state.connections[i];
+        }
+    }
+    return NULL;
+}
+
+// Find BLE connection by Battery Service client CID
+static ble_connection_t* find_connection_by_bas_cid(uint16_t bas_cid) {
+    if (bas_cid == 0) return NULL;
+    for (int i = 0; i < MAX_BLE_CONNECTIONS; i++) {
+        if (hid_state.connections[i].handle != HCI_CON_HANDLE_INVALID &&
+            hid_state.connections[i].bas_cid == bas_cid) {
+            return &hid_state.connections[i];
+        }
+    }
+    return NULL;
+}
+
+// Is this device already connected over BLE?
+static bool ble_addr_connected(const bd_addr_t addr) {
+    for (int i = 0; i < MAX_BLE_CONNECTIONS; i++) {
+        if (hid_state.connections[i].handle != HCI_CON_HANDLE_INVALID &&
+            memcmp(hid_state.connections[i].addr, addr, 6) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// BLE LINK SCHEDULING
+// ============================================================================
+
+// New links are created at BLE_LINK_INTERVAL, with connection events capped
+// to one slot each so links don't overlap
+static void ble_link_params_init(void) {
+    gap_set_connection_parameters(BLE_CONNECT_SCAN_INTERVAL, BLE_CONNECT_SCAN_WINDOW,
+                                  BLE_LINK_INTERVAL, BLE_LINK_INTERVAL, 0,
+                                  BLE_LINK_SUPERVISION_TIMEOUT, 0, BLE_LINK_SLOT_UNITS * 2);
+}
+
+// A peripheral can still come up on its own interval (or reconnect with one);
+// move just that link. Other links are left alone.
+static void ble_pin_link_interval(ble_connection_t* conn) {
+    if (conn->conn_interval == BLE_LINK_INTERVAL) return;
+    printf("[BTSTACK_HOST] BLE link 0x%04X: interval %u -> %u\n",
+           conn->handle, conn->conn_interval, BLE_LINK_INTERVAL);
+    gap_update_connection_parameters(conn->handle, BLE_LINK_INTERVAL, BLE_LINK_INTERVAL, 0,
+                                     BLE_LINK_SUPERVISION_TIMEOUT);
+}
+
 // Route BLE HID report through bthid layer
 static void route_ble_hid_report(uint8_t conn_index, const uint8_t* data, uint16_t len)
 {
@@ -429,6 +663,7 @@ static void hid_host_packet_handler(uint8_t packet_type, uint16_t channel, uint8
 static ble_connection_t* find_connection_by_handle(hci_con_handle_t handle);
 static ble_connection_t* find_free_connection(void);
 static void start_hids_client(ble_connection_t *conn);
+static void start_device_info_query(ble_connection_t *conn);
 static void register_ble_hid_listener(hci_con_handle_t con_handle);
 static void register_switch2_hid_listener(hci_con_handle_t con_handle);
 
@@ -464,6 +699,7 @@ static void setup_hid_handlers(void)
 
     printf("[BTSTACK_HOST] Init LE Device DB...\n");
     le_device_db_init();
+    ble_link_params_init();
 
     // Initialize classic BT HID Host
     printf("[BTSTACK_HOST] Init Classic HID Host...\n");
@@ -497,9 +733,7 @@ static void setup_hid_handlers(void)
     printf("[BTSTACK_HOST] HID handlers initialized (BLE + Classic)\n");
 }
 
-// btstack_host_init is only used for USB dongle transport
-// For CYW43/ESP32, use btstack_host_init_hid_handlers() after external BTstack init
-#if !defined(BTSTACK_USE_CYW43) && !defined(BTSTACK_USE_ESP32) && !defined(BTSTACK_USE_NRF)
+#if !defined(BTSTACK_USE_ESP32) && !defined(BTSTACK_USE_NRF)
 
 // TLV context for flash-based link key storage (must be static/persistent)
 static btstack_tlv_flash_bank_t btstack_tlv_flash_bank_context;
@@ -509,9 +743,7 @@ static void setup_tlv_storage(void) {
     printf("[BTSTACK_HOST] Setting up flash-based TLV storage...\n");
 
     // Check for corrupted flash banks and erase if needed
-    // Flash bank 0 starts at end of flash - 8KB
-    uint32_t bank0_offset = PICO_FLASH_SIZE_BYTES - (FLASH_SECTOR_SIZE * 2);
-    const uint8_t* bank0_ptr = (const uint8_t*)(XIP_BASE + bank0_offset);
+    const uint8_t* bank0_ptr = (const uint8_t*)(XIP_BASE + tlv_bank_offset(0));
 
     // BTstack TLV expects clean flash (0xFF) or valid header
     // If we see our debug pattern (0xDEADBEEF) or other garbage, erase
@@ -526,9 +758,8 @@ static void setup_tlv_storage(void) {
         btstack_erase_flash_banks();
     }
 
-    // Get the Pico SDK flash bank HAL instance
-    const hal_flash_bank_t *hal_flash_bank_impl = pico_flash_bank_instance();
-    printf("[BTSTACK_HOST] Flash bank instance: %p\n", hal_flash_bank_impl);
+    // Flash bank HAL on the flash scheduler (see FLASH HELPERS)
+    const hal_flash_bank_t *hal_flash_bank_impl = &sched_flash_bank;
 
     // Initialize BTstack TLV with flash bank
     const btstack_tlv_t *btstack_tlv_impl = btstack_tlv_flash_bank_init_instance(
@@ -567,6 +798,11 @@ static void setup_tlv_storage(void) {
            btstack_tlv_flash_bank_context.current_bank,
            (unsigned long)btstack_tlv_flash_bank_context.write_offset);
 }
+#endif
+
+// btstack_host_init is only used for USB dongle transport
+// For CYW43/ESP32, use btstack_host_init_hid_handlers() after external BTstack init
+#if !defined(BTSTACK_USE_CYW43) && !defined(BTSTACK_USE_ESP32) && !defined(BTSTACK_USE_NRF)
 
 void btstack_host_init(const void* transport)
 {
@@ -627,6 +863,12 @@ void btstack_host_init_hid_handlers(void)
     }
     // Note: hci_transport is not set here since BTstack was initialized externally
 
+#ifdef BTSTACK_USE_CYW43
+    // btstack_cyw43_init() wired TLV to the SDK flash bank, which writes
+    // flash immediately. Re-point it at the scheduled bank (same sectors).
+    setup_tlv_storage();
+#endif
+
     // Set up HID handlers (BTstack core already initialized by btstack_cyw43_init or similar)
     setup_hid_handlers();
     printf("[BTSTACK_HOST] HID handlers initialized OK\n");
@@ -836,7 +1078,8 @@ void btstack_host_connect_ble(bd_addr_t addr, bd_addr_type_t addr_type)
     hid_state.state = BLE_STATE_CONNECTING;
     hid_state.reconnect_attempt_time = btstack_run_loop_get_time_ms();
 
-    // Create connection
+    // Create connection. Links are re-planned once it completes, not here,
+    // so a failed or cancelled attempt never moves the existing links.
     uint8_t status = gap_connect(addr, addr_type);
     printf("[BTSTACK_HOST] gap_connect returned status=%d\n", status);
 }
@@ -880,10 +1123,25 @@ void btstack_host_process(void)
     }
 #endif
 
-    // Process any pending BLE HID report (deferred from BTstack callback to avoid stack overflow)
-    if (ble_report_pending) {
-        ble_report_pending = false;
-        route_ble_hid_report(pending_ble_conn_index, pending_ble_report, pending_ble_report_len);
+    // Process pending BLE HID reports (deferred from BTstack callback to avoid stack overflow)
+    for (int i = 0; i < MAX_BLE_CONNECTIONS; i++) {
+        ble_connection_t* conn = &hid_state.connections[i];
+        if (conn->report_pending) {
+            conn->report_pending = false;
+            route_ble_hid_report(BLE_CONN_INDEX_OFFSET + i, conn->pending_report, conn->pending_report_len);
+        }
+    }
+
+    // Device Information queries run one at a time, start the next one
+    if (!hid_state.dis_active) {
+        for (int i = 0; i < MAX_BLE_CONNECTIONS; i++) {
+            ble_connection_t* conn = &hid_state.connections[i];
+            if (conn->handle != HCI_CON_HANDLE_INVALID && conn->dis_pending) {
+                conn->dis_pending = false;
+                start_device_info_query(conn);
+                break;
+            }
+        }
     }
 
     // Retry Switch 2 init if stuck (no ACK received)
@@ -940,8 +1198,9 @@ void btstack_host_process(void)
             }
 
             // Clean up wiimote state if this was a direct L2CAP device
-            if (wiimote_conn.active && memcmp(wiimote_conn.addr, conn->addr, 6) == 0) {
-                memset(&wiimote_conn, 0, sizeof(wiimote_conn));
+            wiimote_connection_t* wm = find_wiimote_by_addr(conn->addr);
+            if (wm) {
+                memset(wm, 0, sizeof(*wm));
             }
 
             // Clean up connection slot
@@ -999,6 +1258,8 @@ void btstack_host_process(void)
     // alternate between scanning and reconnection attempts.
     if (hid_state.state == BLE_STATE_SCANNING &&
         hid_state.has_last_connected &&
+        !ble_addr_connected(hid_state.last_connected_addr) &&
+        !controller_slots_full() &&
         hid_state.scan_start_time != 0 &&
         (btstack_run_loop_get_time_ms() - hid_state.scan_start_time) >= BLE_RECONNECT_INTERVAL_MS) {
         printf("[BTSTACK_HOST] Periodic reconnection to bonded device '%s'\n",
@@ -1022,7 +1283,7 @@ static void sdp_query_vid_pid_callback(uint8_t packet_type, uint16_t channel, ui
     uint8_t event_type = hci_event_packet_get_type(packet);
 
     // Debug: log connection-related HCI events for Wiimote troubleshooting
-    if (wiimote_conn.active && event_type >= 0x01 && event_type <= 0x20) {
+    if (find_wiimote_by_addr(classic_state.pending_addr) && event_type >= 0x01 && event_type <= 0x20) {
         printf("[BTSTACK_HOST] HCI event: 0x%02X\n", event_type);
     }
 
@@ -1080,12 +1341,13 @@ static void sdp_query_vid_pid_callback(uint8_t packet_type, uint16_t channel, ui
                     }
                 }
 
-                // Also update wiimote_conn if active and address matches
-                if (wiimote_conn.active && memcmp(wiimote_conn.addr, classic_state.pending_addr, 6) == 0) {
-                    wiimote_conn.vendor_id = classic_state.pending_vid;
-                    wiimote_conn.product_id = classic_state.pending_pid;
+                // Also update the wiimote entry if address matches
+                wiimote_connection_t* wm = find_wiimote_by_addr(classic_state.pending_addr);
+                if (wm) {
+                    wm->vendor_id = classic_state.pending_vid;
+                    wm->product_id = classic_state.pending_pid;
                     printf("[BTSTACK_HOST] Updated wiimote VID/PID: 0x%04X/0x%04X\n",
-                           wiimote_conn.vendor_id, wiimote_conn.product_id);
+                           wm->vendor_id, wm->product_id);
                 }
             }
             break;
@@ -1339,9 +1601,11 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
 
             bool is_controller = is_known_controller || is_generic_ble_hid;
 
-            // Auto-connect to supported BLE controllers (skip classic-only devices)
+            // Auto-connect to supported BLE controllers (skip classic-only devices),
+            // as long as a controller slot is free
             if (hid_state.state == BLE_STATE_SCANNING && is_controller &&
-                (profile->ble != BT_BLE_NONE || is_generic_ble_hid)) {
+                (profile->ble != BT_BLE_NONE || is_generic_ble_hid) &&
+                !controller_slots_full() && find_free_connection()) {
                 printf("[BTSTACK_HOST] BLE controller: %02X:%02X:%02X:%02X:%02X:%02X name=\"%s\"\n",
                        addr[5], addr[4], addr[3], addr[2], addr[1], addr[0], name);
                 // Determine display name from profile and PID
@@ -1411,8 +1675,9 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                    addr[5], addr[4], addr[3], addr[2], addr[1], addr[0],
                    (unsigned)cod, type_str, name);
 
-            // Auto-connect to gamepads and Wiimotes
-            if ((is_gamepad || is_joystick || is_wiimote_family) && classic_state.inquiry_active) {
+            // Auto-connect to gamepads and Wiimotes while a controller slot is free
+            if ((is_gamepad || is_joystick || is_wiimote_family) && classic_state.inquiry_active &&
+                !controller_slots_full()) {
                 // Skip if we already have an active incoming connection to this device
                 // (the device connected to us before we found it in inquiry)
                 if (classic_state.pending_valid && !classic_state.pending_outgoing &&
@@ -1460,16 +1725,18 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                     classic_state.pending_hid_connect = true;
 
                     // Initialize direct L2CAP connection state
-                    memset(&wiimote_conn, 0, sizeof(wiimote_conn));
-                    wiimote_conn.active = true;
-                    wiimote_conn.state = WIIMOTE_STATE_IDLE;
-                    memcpy(wiimote_conn.addr, addr, 6);
-                    strncpy(wiimote_conn.name, name, sizeof(wiimote_conn.name) - 1);
-                    wiimote_conn.class_of_device[0] = cod & 0xFF;
-                    wiimote_conn.class_of_device[1] = (cod >> 8) & 0xFF;
-                    wiimote_conn.class_of_device[2] = (cod >> 16) & 0xFF;
-                    wiimote_conn.vendor_id = profile->default_vid;
-                    wiimote_conn.product_id = profile->default_pid;
+                    wiimote_connection_t* wm = alloc_wiimote_connection(addr);
+                    if (!wm) {
+                        classic_state.pending_valid = false;
+                        classic_state.pending_hid_connect = false;
+                        break;
+                    }
+                    strncpy(wm->name, name, sizeof(wm->name) - 1);
+                    wm->class_of_device[0] = cod & 0xFF;
+                    wm->class_of_device[1] = (cod >> 8) & 0xFF;
+                    wm->class_of_device[2] = (cod >> 16) & 0xFF;
+                    wm->vendor_id = profile->default_vid;
+                    wm->product_id = profile->default_pid;
 
                     // Allocate classic connection slot for bthid routing
                     classic_connection_t* conn = find_free_classic_connection();
@@ -1485,7 +1752,7 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                         conn->class_of_device[2] = (cod >> 16) & 0xFF;
                         conn->profile = profile;
                         conn->connect_time = btstack_run_loop_get_time_ms();
-                        wiimote_conn.conn_index = conn_index;
+                        wm->conn_index = conn_index;
                         printf("[BTSTACK_HOST] %s conn_index=%d\n", profile->name, conn_index);
                     }
 
@@ -1495,7 +1762,7 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                     uint8_t status = gap_connect(addr, BD_ADDR_TYPE_ACL);
                     if (status != ERROR_CODE_SUCCESS && status != ERROR_CODE_COMMAND_DISALLOWED) {
                         printf("[BTSTACK_HOST] gap_connect failed: 0x%02X\n", status);
-                        wiimote_conn.active = false;
+                        wm->active = false;
                         classic_state.pending_hid_connect = false;
                     }
                 } else {
@@ -1594,12 +1861,13 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                         printf("[BTSTACK_HOST] Outgoing ACL complete, COD=0x%06X\n", cod);
 
                         // For Wiimotes, store ACL handle and do L2CAP-specific setup
-                        if (classic_state.pending_hid_connect && wiimote_conn.active) {
-                            wiimote_conn.acl_handle = handle;
+                        wiimote_connection_t* wm = classic_state.pending_hid_connect ? find_wiimote_by_addr(addr) : NULL;
+                        if (wm) {
+                            wm->acl_handle = handle;
                             printf("[BTSTACK_HOST] Wiimote: stored ACL handle=0x%04X\n", handle);
 
                             // Request remote name if we don't have it from inquiry
-                            if (wiimote_conn.name[0] == '\0') {
+                            if (wm->name[0] == '\0') {
                                 gap_remote_name_request(addr, 0, 0);
                             }
 
@@ -1615,7 +1883,7 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                         // authentication when creating HID L2CAP channels after SDP.
                         // Requesting auth here concurrently with SDP causes CYW43 SPI
                         // bus failures on devices with large HID descriptors (DS4 clones).
-                        if (classic_state.pending_hid_connect && wiimote_conn.active) {
+                        if (wm) {
                             gap_request_security_level(handle, LEVEL_2);
                         }
                     } else {
@@ -1656,15 +1924,13 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                             printf("[BTSTACK_HOST] Wiimote: have_key=%d type=%d\n", have_key, have_key ? key_type : -1);
 
                             // Store info for when L2CAP events come in
-                            memset(&wiimote_conn, 0, sizeof(wiimote_conn));
-                            wiimote_conn.active = true;
-                            wiimote_conn.state = WIIMOTE_STATE_IDLE;
-                            wiimote_conn.conn_index = -1;  // Not assigned yet
-                            memcpy(wiimote_conn.addr, addr, 6);
-                            wiimote_conn.acl_handle = handle;
-                            memcpy(wiimote_conn.class_of_device, &cod, 3);
-                            if (classic_state.pending_name[0]) {
-                                strncpy(wiimote_conn.name, classic_state.pending_name, sizeof(wiimote_conn.name) - 1);
+                            wiimote_connection_t* wm = alloc_wiimote_connection(addr);
+                            if (wm) {
+                                wm->acl_handle = handle;
+                                memcpy(wm->class_of_device, &cod, 3);
+                                if (classic_state.pending_name[0]) {
+                                    strncpy(wm->name, classic_state.pending_name, sizeof(wm->name) - 1);
+                                }
                             }
 
                             // Request remote name for driver matching (need to distinguish Wii U Pro from Wiimote)
@@ -1726,10 +1992,10 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
             // For Wiimotes during reconnection, we create outgoing L2CAP channels ourselves.
             // If the Wiimote also tries to create incoming channels, decline them at L2CAP level
             // to force the Wiimote to use our outgoing channels.
-            if (wiimote_conn.active && wiimote_conn.acl_handle == handle &&
-                (psm == PSM_HID_CONTROL || psm == PSM_HID_INTERRUPT)) {
+            wiimote_connection_t* wm = find_wiimote_by_handle(handle);
+            if (wm && (psm == PSM_HID_CONTROL || psm == PSM_HID_INTERRUPT)) {
                 // If we're already creating outgoing channels (reconnection), decline incoming
-                if (wiimote_conn.state >= WIIMOTE_STATE_W4_CONTROL_CONNECTED) {
+                if (wm->state >= WIIMOTE_STATE_W4_CONTROL_CONNECTED) {
                     printf("[BTSTACK_HOST] Wiimote: declining incoming L2CAP PSM=0x%04X (using outgoing channels)\n", psm);
                     l2cap_decline_connection(cid);
                     break;
@@ -1738,12 +2004,12 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                 // HID Host will accept, but we need the CID to bypass hid_host_send_report
                 printf("[BTSTACK_HOST] Wiimote: L2CAP incoming PSM=0x%04X cid=0x%04X (HID Host will accept)\n", psm, cid);
                 if (psm == PSM_HID_CONTROL) {
-                    wiimote_conn.control_cid = cid;
-                    wiimote_conn.state = WIIMOTE_STATE_W4_CONTROL_CONNECTED;
+                    wm->control_cid = cid;
+                    wm->state = WIIMOTE_STATE_W4_CONTROL_CONNECTED;
                     printf("[BTSTACK_HOST] Wiimote: captured control CID=0x%04X from incoming\n", cid);
                 } else {
-                    wiimote_conn.interrupt_cid = cid;
-                    wiimote_conn.state = WIIMOTE_STATE_W4_INTERRUPT_CONNECTED;
+                    wm->interrupt_cid = cid;
+                    wm->state = WIIMOTE_STATE_W4_INTERRUPT_CONNECTED;
                     printf("[BTSTACK_HOST] Wiimote: captured interrupt CID=0x%04X from incoming\n", cid);
                 }
             }
@@ -1762,13 +2028,13 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
             // Capture L2CAP CIDs for Wiimote connections (for direct L2CAP sending)
             // HID Host handles receiving, but we need direct L2CAP CIDs for sending
             // Note: bt_on_hid_ready is called from HID_SUBEVENT_CONNECTION_OPENED
-            if (status == 0 && wiimote_conn.active &&
-                memcmp(l2cap_addr, wiimote_conn.addr, 6) == 0) {
+            wiimote_connection_t* wm = (status == 0) ? find_wiimote_by_addr(l2cap_addr) : NULL;
+            if (wm) {
                 if (psm == PSM_HID_CONTROL) {
-                    wiimote_conn.control_cid = cid;
+                    wm->control_cid = cid;
                     printf("[BTSTACK_HOST] Wiimote: captured control CID=0x%04X for direct sending\n", cid);
                 } else if (psm == PSM_HID_INTERRUPT) {
-                    wiimote_conn.interrupt_cid = cid;
+                    wm->interrupt_cid = cid;
                     printf("[BTSTACK_HOST] Wiimote: captured interrupt CID=0x%04X for direct sending\n", cid);
                 }
             }
@@ -1802,7 +2068,8 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                         hid_state.state = BLE_STATE_IDLE;
 
                         // If reconnection attempt failed, try again or resume scanning
-                        if (hid_state.has_last_connected && hid_state.reconnect_attempts < 5) {
+                        if (hid_state.has_last_connected && hid_state.reconnect_attempts < 5 &&
+                            !ble_addr_connected(hid_state.last_connected_addr)) {
                             hid_state.reconnect_attempts++;
                             printf("[BTSTACK_HOST] Retrying reconnection (attempt %d)...\n",
                                    hid_state.reconnect_attempts);
@@ -1818,12 +2085,19 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                     printf("[BTSTACK_HOST] Connected! handle=0x%04X\n", handle);
 
                     // Find or create connection entry
-                    ble_connection_t *conn = find_free_connection();
-                    if (conn) {
+                    ble_connection_t *conn = controller_slots_full() ? NULL : find_free_connection();
+                    if (!conn) {
+                        printf("[BTSTACK_HOST] No free controller slot, disconnecting handle=0x%04X\n", handle);
+                        gap_disconnect(handle);
+                        hid_state.state = BLE_STATE_IDLE;
+                        break;
+                    } else {
+                        memset(conn, 0, sizeof(*conn));
                         memcpy(conn->addr, hid_state.pending_addr, 6);
                         conn->addr_type = hid_state.pending_addr_type;
                         conn->handle = handle;
                         conn->state = BLE_STATE_CONNECTED;
+                        conn->conn_interval = hci_subevent_le_connection_complete_get_conn_interval(packet);
                         // Copy the name from pending connection
                         strncpy(conn->name, hid_state.pending_name, sizeof(conn->name) - 1);
                         conn->name[sizeof(conn->name) - 1] = '\0';
@@ -1835,6 +2109,9 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                                conn->name, conn->profile ? conn->profile->name : "default",
                                conn->vid, conn->pid);
 
+                        // Link is up: make sure it runs on the fixed interval
+                        ble_pin_link_interval(conn);
+
                         // Route based on BLE strategy
                         if (conn->profile && conn->profile->ble == BT_BLE_CUSTOM) {
                             printf("[BTSTACK_HOST] %s: Skipping SM pairing, using direct ATT setup\n",
@@ -1851,9 +2128,17 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                     break;
                 }
 
-                case HCI_SUBEVENT_LE_CONNECTION_UPDATE_COMPLETE:
-                    printf("[BTSTACK_HOST] Connection update complete\n");
+                case HCI_SUBEVENT_LE_CONNECTION_UPDATE_COMPLETE: {
+                    hci_con_handle_t handle = hci_subevent_le_connection_update_complete_get_connection_handle(packet);
+                    uint16_t interval = hci_subevent_le_connection_update_complete_get_conn_interval(packet);
+                    ble_connection_t *conn = find_connection_by_handle(handle);
+                    if (conn) {
+                        conn->conn_interval = interval;
+                    }
+                    printf("[BTSTACK_HOST] Connection update complete: handle=0x%04X interval=%u\n",
+                           handle, interval);
                     break;
+                }
             }
             break;
         }
@@ -1879,15 +2164,16 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                     // CYW43: if pending profile is Sony, use direct L2CAP to skip SDP
                     if (classic_state.pending_profile && classic_state.pending_profile->default_vid == 0x054C) {
                         printf("[BTSTACK_HOST] CYW43: forcing direct L2CAP for Sony (skip SDP)\n");
-                        memset(&wiimote_conn, 0, sizeof(wiimote_conn));
-                        wiimote_conn.active = true;
-                        wiimote_conn.state = WIIMOTE_STATE_IDLE;
-                        memcpy(wiimote_conn.addr, name_addr, 6);
-                        wiimote_conn.class_of_device[0] = classic_state.pending_cod & 0xFF;
-                        wiimote_conn.class_of_device[1] = (classic_state.pending_cod >> 8) & 0xFF;
-                        wiimote_conn.class_of_device[2] = (classic_state.pending_cod >> 16) & 0xFF;
-                        wiimote_conn.vendor_id = classic_state.pending_profile->default_vid;
-                        wiimote_conn.product_id = classic_state.pending_profile->default_pid;
+                        wiimote_connection_t* wm = alloc_wiimote_connection(name_addr);
+                        if (!wm) {
+                            classic_state.pending_hid_connect = false;
+                            break;
+                        }
+                        wm->class_of_device[0] = classic_state.pending_cod & 0xFF;
+                        wm->class_of_device[1] = (classic_state.pending_cod >> 8) & 0xFF;
+                        wm->class_of_device[2] = (classic_state.pending_cod >> 16) & 0xFF;
+                        wm->vendor_id = classic_state.pending_profile->default_vid;
+                        wm->product_id = classic_state.pending_profile->default_pid;
 
                         classic_connection_t* conn = find_free_classic_connection();
                         if (conn) {
@@ -1901,13 +2187,13 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                             conn->class_of_device[2] = (classic_state.pending_cod >> 16) & 0xFF;
                             conn->profile = classic_state.pending_profile;
                             conn->connect_time = btstack_run_loop_get_time_ms();
-                            wiimote_conn.conn_index = conn_index;
+                            wm->conn_index = conn_index;
                         }
 
                         uint8_t status = gap_connect(name_addr, BD_ADDR_TYPE_ACL);
                         if (status != ERROR_CODE_SUCCESS && status != ERROR_CODE_COMMAND_DISALLOWED) {
                             printf("[BTSTACK_HOST] gap_connect failed: 0x%02X\n", status);
-                            wiimote_conn.active = false;
+                            wm->active = false;
                         }
                         classic_state.pending_hid_connect = false;
                         break;
@@ -1985,17 +2271,16 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                     }
                 }
 
-                // Also update wiimote_conn if active
-                if (wiimote_conn.active && memcmp(wiimote_conn.addr, name_addr, 6) == 0) {
-                    if (wiimote_conn.name[0] == '\0') {
-                        strncpy(wiimote_conn.name, name, sizeof(wiimote_conn.name) - 1);
-                        wiimote_conn.name[sizeof(wiimote_conn.name) - 1] = '\0';
-                        printf("[BTSTACK_HOST] Updated wiimote name: %s\n", wiimote_conn.name);
-                    }
+                // Also update the wiimote entry for this address
+                wiimote_connection_t* named_wm = find_wiimote_by_addr(name_addr);
+                if (named_wm && named_wm->name[0] == '\0') {
+                    strncpy(named_wm->name, name, sizeof(named_wm->name) - 1);
+                    named_wm->name[sizeof(named_wm->name) - 1] = '\0';
+                    printf("[BTSTACK_HOST] Updated wiimote name: %s\n", named_wm->name);
                 }
 
                 // Late direct-L2CAP device detection for incoming reconnections: if the name
-                // resolves to a direct-L2CAP device and wiimote_conn wasn't set up at
+                // resolves to a direct-L2CAP device and no wiimote entry was set up at
                 // CONNECTION_COMPLETE (because name was unknown), set it up now so
                 // ENCRYPTION_CHANGE can create outgoing L2CAP channels.
                 const bt_device_profile_t* late_profile = bt_device_lookup_by_name(name);
@@ -2017,24 +2302,21 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                     btstack_host_stop_scan();
                 }
 #endif
-                if (!wiimote_conn.active &&
+                if (!named_wm &&
                     late_direct_l2cap &&
                     classic_state.pending_valid &&
                     !classic_state.pending_outgoing &&
                     memcmp(name_addr, classic_state.pending_addr, 6) == 0) {
                     printf("[BTSTACK_HOST] Late %s detection from name resolution (incoming reconnection)\n",
                            late_profile->name);
-                    memset(&wiimote_conn, 0, sizeof(wiimote_conn));
-                    wiimote_conn.active = true;
-                    wiimote_conn.state = WIIMOTE_STATE_IDLE;
-                    wiimote_conn.conn_index = -1;
-                    memcpy(wiimote_conn.addr, name_addr, 6);
-                    wiimote_conn.acl_handle = classic_state.pending_acl_handle;
-                    memcpy(wiimote_conn.class_of_device, &classic_state.pending_cod, 3);
-                    strncpy(wiimote_conn.name, name, sizeof(wiimote_conn.name) - 1);
-                    wiimote_conn.name[sizeof(wiimote_conn.name) - 1] = '\0';
-                    wiimote_conn.vendor_id = late_profile->default_vid;
-                    wiimote_conn.product_id = classic_state.pending_pid ? classic_state.pending_pid : late_profile->default_pid;
+                    wiimote_connection_t* wm = alloc_wiimote_connection(name_addr);
+                    if (!wm) break;
+                    wm->acl_handle = classic_state.pending_acl_handle;
+                    memcpy(wm->class_of_device, &classic_state.pending_cod, 3);
+                    strncpy(wm->name, name, sizeof(wm->name) - 1);
+                    wm->name[sizeof(wm->name) - 1] = '\0';
+                    wm->vendor_id = late_profile->default_vid;
+                    wm->product_id = classic_state.pending_pid ? classic_state.pending_pid : late_profile->default_pid;
 
                     // Stop scanning — we have an incoming connection to handle
                     btstack_host_stop_scan();
@@ -2076,16 +2358,18 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                                deferred_profile->name);
                         classic_state.pending_hid_connect = true;
 
-                        memset(&wiimote_conn, 0, sizeof(wiimote_conn));
-                        wiimote_conn.active = true;
-                        wiimote_conn.state = WIIMOTE_STATE_IDLE;
-                        memcpy(wiimote_conn.addr, name_addr, 6);
-                        strncpy(wiimote_conn.name, name, sizeof(wiimote_conn.name) - 1);
-                        wiimote_conn.class_of_device[0] = classic_state.pending_cod & 0xFF;
-                        wiimote_conn.class_of_device[1] = (classic_state.pending_cod >> 8) & 0xFF;
-                        wiimote_conn.class_of_device[2] = (classic_state.pending_cod >> 16) & 0xFF;
-                        wiimote_conn.vendor_id = deferred_profile->default_vid;
-                        wiimote_conn.product_id = deferred_profile->default_pid;
+                        wiimote_connection_t* wm = alloc_wiimote_connection(name_addr);
+                        if (!wm) {
+                            classic_state.pending_valid = false;
+                            classic_state.pending_hid_connect = false;
+                            break;
+                        }
+                        strncpy(wm->name, name, sizeof(wm->name) - 1);
+                        wm->class_of_device[0] = classic_state.pending_cod & 0xFF;
+                        wm->class_of_device[1] = (classic_state.pending_cod >> 8) & 0xFF;
+                        wm->class_of_device[2] = (classic_state.pending_cod >> 16) & 0xFF;
+                        wm->vendor_id = deferred_profile->default_vid;
+                        wm->product_id = deferred_profile->default_pid;
 
                         classic_connection_t* conn = find_free_classic_connection();
                         if (conn) {
@@ -2100,13 +2384,13 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                             conn->class_of_device[2] = (classic_state.pending_cod >> 16) & 0xFF;
                             conn->profile = deferred_profile;
                             conn->connect_time = btstack_run_loop_get_time_ms();
-                            wiimote_conn.conn_index = conn_index;
+                            wm->conn_index = conn_index;
                         }
 
                         uint8_t status = gap_connect(name_addr, BD_ADDR_TYPE_ACL);
                         if (status != ERROR_CODE_SUCCESS && status != ERROR_CODE_COMMAND_DISALLOWED) {
                             printf("[BTSTACK_HOST] gap_connect failed: 0x%02X\n", status);
-                            wiimote_conn.active = false;
+                            wm->active = false;
                             classic_state.pending_hid_connect = false;
                         }
                     } else {
@@ -2149,38 +2433,46 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
             printf("[BTSTACK_HOST] Disconnected: handle=0x%04X reason=0x%02X\n", handle, reason);
 
             ble_connection_t *conn = find_connection_by_handle(handle);
-            if (conn && conn->conn_index > 0) {
-                // Notify bthid layer before clearing connection
+            if (conn) {
+                // Notify bthid layer before clearing connection (conn_index is
+                // only assigned once the device got far enough to be announced)
                 // conn_index for BLE uses BLE_CONN_INDEX_OFFSET to distinguish from Classic
-                printf("[BTSTACK_HOST] BLE disconnect: notifying bthid (conn_index=%d)\n", conn->conn_index);
-                bt_on_disconnect(conn->conn_index);
-                memset(conn, 0, sizeof(*conn));
-                conn->handle = HCI_CON_HANDLE_INVALID;
+                if (conn->conn_index != 0) {
+                    printf("[BTSTACK_HOST] BLE disconnect: notifying bthid (conn_index=%d)\n", conn->conn_index);
+                    bt_on_disconnect(conn->conn_index);
+                }
 
                 // Clean up GATT/HIDS client state for this connection
-                if (hid_state.hids_cid != 0) {
-                    hids_client_disconnect(hid_state.hids_cid);
-                    hid_state.hids_cid = 0;
+                if (conn->hids_cid != 0) {
+                    hids_client_disconnect(conn->hids_cid);
                 }
-                if (hid_state.bas_cid != 0) {
-                    battery_service_client_disconnect(hid_state.bas_cid);
-                    hid_state.bas_cid = 0;
+                if (conn->bas_cid != 0) {
+                    battery_service_client_disconnect(conn->bas_cid);
+                }
+                if (hid_state.dis_active && hid_state.dis_handle == handle) {
+                    hid_state.dis_active = false;
+                }
+                if (hid_state.gatt_handle == handle) {
+                    hid_state.gatt_state = GATT_IDLE;
+                    hid_state.gatt_handle = 0;
                 }
-                hid_state.gatt_state = GATT_IDLE;
-                hid_state.gatt_handle = 0;
 
-                // Unregister GATT notification listeners
-                gatt_client_stop_listening_for_characteristic_value_updates(&xbox_hid_notification_listener);
-                gatt_client_stop_listening_for_characteristic_value_updates(&switch2_hid_notification_listener);
+                // Unregister this link's GATT notification listener (before the
+                // memset, BTstack keeps it in a linked list)
+                gatt_client_stop_listening_for_characteristic_value_updates(&conn->hid_listener);
 
                 // Clean up Switch 2 state (ACK listener, init state machine)
-                switch2_cleanup_on_disconnect();
+                switch2_cleanup_on_disconnect(handle);
+
+                memset(conn, 0, sizeof(*conn));
+                conn->handle = HCI_CON_HANDLE_INVALID;
 
                 // BLE disconnect — manage BLE state and reconnection
                 hid_state.state = BLE_STATE_IDLE;
 
                 // Try to reconnect to last connected device if we have one stored
-                if (hid_state.has_last_connected && hid_state.reconnect_attempts < 5) {
+                if (hid_state.has_last_connected && hid_state.reconnect_attempts < 5 &&
+                    !ble_addr_connected(hid_state.last_connected_addr)) {
                     hid_state.reconnect_attempts++;
                     printf("[BTSTACK_HOST] Attempting BLE reconnection to stored device (attempt %d)...\n",
                            hid_state.reconnect_attempts);
@@ -2204,6 +2496,12 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                 // reconnection, don't restart scanning here.
                 printf("[BTSTACK_HOST] Classic disconnect: handle=0x%04X (BLE state unchanged)\n", handle);
 
+                // Direct L2CAP devices: their channels are gone with the ACL
+                wiimote_connection_t* wm = find_wiimote_by_handle(handle);
+                if (wm) {
+                    release_wiimote_connection(wm);
+                }
+
                 // Clear pending connection state if this was the pending device.
                 // Handles cases where ACL drops before HID opens (e.g., auth failure).
                 if (classic_state.pending_valid) {
@@ -2253,9 +2551,8 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                     needs_bdaddr_pin = true;
                 }
             }
-            // Also check wiimote_conn state (may have been set up during inquiry)
-            if (!needs_bdaddr_pin && wiimote_conn.active &&
-                memcmp(pin_addr, wiimote_conn.addr, 6) == 0) {
+            // Also check wiimote state (may have been set up during inquiry)
+            if (!needs_bdaddr_pin && find_wiimote_by_addr(pin_addr)) {
                 needs_bdaddr_pin = true;
             }
 
@@ -2309,8 +2606,9 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
                 gap_drop_link_key_for_bd_addr(classic_state.pending_addr);
 
                 // Clean up wiimote state if auth failed before L2CAP channels were created
-                if (wiimote_conn.active && wiimote_conn.acl_handle == handle) {
-                    memset(&wiimote_conn, 0, sizeof(wiimote_conn));
+                wiimote_connection_t* wm = find_wiimote_by_handle(handle);
+                if (wm) {
+                    memset(wm, 0, sizeof(*wm));
                 }
                 classic_state.pending_hid_connect = false;
 
@@ -2329,11 +2627,11 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
 
             // For Wiimotes, create L2CAP control channel after encryption is enabled
             // This handles both initial pairing (state=IDLE) and reconnection (state=W4_CONTROL_CONNECTED)
-            if (status == 0 && enabled && wiimote_conn.active &&
-                wiimote_conn.acl_handle == handle &&
-                (wiimote_conn.state == WIIMOTE_STATE_IDLE ||
-                 wiimote_conn.state == WIIMOTE_STATE_W4_CONTROL_CONNECTED) &&
-                wiimote_conn.control_cid == 0) {
+            wiimote_connection_t* wm = (status == 0 && enabled) ? find_wiimote_by_handle(handle) : NULL;
+            if (wm &&
+                (wm->state == WIIMOTE_STATE_IDLE ||
+                 wm->state == WIIMOTE_STATE_W4_CONTROL_CONNECTED) &&
+                wm->control_cid == 0) {
 
                 // For incoming reconnections, don't create outgoing L2CAP channels.
                 // The controller will initiate its own channels via HID Host.
@@ -2347,17 +2645,17 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packe
 
                 uint16_t control_cid;
                 uint8_t l2cap_status = l2cap_create_channel(wiimote_l2cap_packet_handler,
-                                                            wiimote_conn.addr,
+                                                            wm->addr,
                                                             PSM_HID_CONTROL,
                                                             0xFFFF,  // MTU
                                                             &control_cid);
                 if (l2cap_status == ERROR_CODE_SUCCESS) {
-                    wiimote_conn.control_cid = control_cid;
-                    wiimote_conn.state = WIIMOTE_STATE_W4_CONTROL_CONNECTED;
+                    wm->control_cid = control_cid;
+                    wm->state = WIIMOTE_STATE_W4_CONTROL_CONNECTED;
                     printf("[BTSTACK_HOST] Wiimote: L2CAP control channel request sent, cid=0x%04X\n", control_cid);
                 } else {
                     printf("[BTSTACK_HOST] Wiimote: l2cap_create_channel failed: 0x%02X\n", l2cap_status);
-                    wiimote_conn.active = false;
+                    wm->active = false;
                     classic_state.pending_hid_connect = false;
                 }
             }
@@ -2643,17 +2941,15 @@ static void ble_hid_notification_handler(uint8_t packet_type, uint16_t channel,
     }
 
     // Accept HID report notifications - filter by reasonable gamepad report length
-    if (value_length < 10 || value_length > sizeof(pending_ble_report)) return;
+    if (value_length < 10 || value_length > BLE_PENDING_REPORT_SIZE) return;
 
-    // Get conn_index for this BLE connection
-    int conn_index = get_ble_conn_index_by_handle(con_handle);
-    if (conn_index < 0) return;
+    ble_connection_t* conn = find_connection_by_handle(con_handle);
+    if (!conn) return;
 
     // Defer processing to main loop to avoid stack overflow
-    memcpy(pending_ble_report, value, value_length);
-    pending_ble_report_len = value_length;
-    pending_ble_conn_index = (uint8_t)conn_index;
-    ble_report_pending = true;
+    memcpy(conn->pending_report, value, value_length);
+    conn->pending_report_len = value_length;
+    conn->report_pending = true;
 }
 
 // Register direct listener for BLE HID notifications and notify bthid layer
@@ -2683,16 +2979,16 @@ static void register_ble_hid_listener(hci_con_handle_t con_handle)
 
     // Set up a fake characteristic structure with just the value_handle
     // Xbox BLE HID Report characteristic value handle is 0x001E
-    memset(&xbox_hid_characteristic, 0, sizeof(xbox_hid_characteristic));
-    xbox_hid_characteristic.value_handle = 0x001E;
-    xbox_hid_characteristic.end_handle = 0x001F;  // Approximate
+    memset(&conn->hid_characteristic, 0, sizeof(conn->hid_characteristic));
+    conn->hid_characteristic.value_handle = 0x001E;
+    conn->hid_characteristic.end_handle = 0x001F;  // Approximate
 
     // Register to listen for notifications on the HID report characteristic
     gatt_client_listen_for_characteristic_value_updates(
-        &xbox_hid_notification_listener,
+        &conn->hid_listener,
         ble_hid_notification_handler,
         con_handle,
-        &xbox_hid_characteristic);
+        &conn->hid_characteristic);
 
     printf("[BTSTACK_HOST] BLE HID listener registered, conn_index=%d\n", conn->conn_index);
 
@@ -2770,17 +3066,15 @@ static void switch2_hid_notification_handler(uint8_t packet_type, uint16_t chann
 
     // Switch 2 input reports are 64 bytes on handle 0x000A
     if (value_handle != SW2_INPUT_REPORT_HANDLE) return;
-    if (value_length < 16 || value_length > sizeof(pending_ble_report)) return;
+    if (value_length < 16 || value_length > BLE_PENDING_REPORT_SIZE) return;
 
-    // Get conn_index for this BLE connection
-    int conn_index = get_ble_conn_index_by_handle(con_handle);
-    if (conn_index < 0) return;
+    ble_connection_t* conn = find_connection_by_handle(con_handle);
+    if (!conn) return;
 
     // Defer processing to main loop to avoid stack overflow
-    memcpy(pending_ble_report, value, value_length);
-    pending_ble_report_len = value_length;
-    pending_ble_conn_index = (uint8_t)conn_index;
-    ble_report_pending = true;
+    memcpy(conn->pending_report, value, value_length);
+    conn->pending_report_len = value_length;
+    conn->report_pending = true;
 }
 
 // Forward declarations for Switch 2
@@ -2858,7 +3152,8 @@ static gatt_client_notification_t switch2_ack_notification_listener;
 static gatt_client_characteristic_t switch2_ack_characteristic;
 
 // Cleanup Switch 2 state on BLE disconnect (called from disconnect handler)
-static void switch2_cleanup_on_disconnect(void) {
+static void switch2_cleanup_on_disconnect(hci_con_handle_t handle) {
+    if (sw2_init_handle != handle) return;
     gatt_client_stop_listening_for_characteristic_value_updates(&switch2_ack_notification_listener);
     sw2_init_state = SW2_INIT_IDLE;
     sw2_init_handle = 0;
@@ -3300,6 +3595,13 @@ static void register_switch2_hid_listener(hci_con_handle_t con_handle)
         return;
     }
 
+    // Init state machine, ACK listener and feedback are single-instance
+    if (sw2_init_handle != 0 && sw2_init_handle != con_handle) {
+        printf("[SW2_BLE] Only one Switch 2 controller supported at a time\n");
+        gap_disconnect(con_handle);
+        return;
+    }
+
     // Assign conn_index if not already set
     int ble_index = -1;
     for (int i = 0; i < MAX_BLE_CONNECTIONS; i++) {
@@ -3330,15 +3632,15 @@ static void register_switch2_hid_listener(hci_con_handle_t con_handle)
         &switch2_ack_characteristic);
 
     // Set up input report notification listener (handle 0x000A)
-    memset(&switch2_hid_characteristic, 0, sizeof(switch2_hid_characteristic));
-    switch2_hid_characteristic.value_handle = SW2_INPUT_REPORT_HANDLE;
-    switch2_hid_characteristic.end_handle = SW2_INPUT_REPORT_HANDLE + 1;
+    memset(&conn->hid_characteristic, 0, sizeof(conn->hid_characteristic));
+    conn->hid_characteristic.value_handle = SW2_INPUT_REPORT_HANDLE;
+    conn->hid_characteristic.end_handle = SW2_INPUT_REPORT_HANDLE + 1;
 
     gatt_client_listen_for_characteristic_value_updates(
-        &switch2_hid_notification_listener,
+        &conn->hid_listener,
         switch2_hid_notification_handler,
         con_handle,
-        &switch2_hid_characteristic);
+        &conn->hid_characteristic);
 
     printf("[SW2_BLE] Notification listeners registered\n");
 
@@ -3357,10 +3659,10 @@ static void start_hids_client(ble_connection_t *conn)
     hid_state.gatt_handle = conn->handle;
 
     uint8_t status = hids_client_connect(conn->handle, hids_client_handler,
-                                         HID_PROTOCOL_MODE_REPORT, &hid_state.hids_cid);
+                                         HID_PROTOCOL_MODE_REPORT, &conn->hids_cid);
 
     printf("[BTSTACK_HOST] hids_client_connect returned %d, cid=0x%04X\n",
-           status, hid_state.hids_cid);
+           status, conn->hids_cid);
 }
 
 // ============================================================================
@@ -3384,15 +3686,15 @@ static void bas_client_handler(uint8_t packet_type, uint16_t channel, uint8_t *p
         }
 
         case GATTSERVICE_SUBEVENT_BATTERY_SERVICE_LEVEL: {
+            uint16_t bas_cid = gattservice_subevent_battery_service_level_get_battery_service_cid(packet);
             uint8_t att_status = gattservice_subevent_battery_service_level_get_att_status(packet);
             uint8_t level = gattservice_subevent_battery_service_level_get_level(packet);
 
             if (att_status != ATT_ERROR_SUCCESS) break;
 
-            // Find conn_index for the current BLE connection
-            int conn_index = get_ble_conn_index_by_handle(hid_state.gatt_handle);
-            if (conn_index >= 0) {
-                bthid_set_battery_level((uint8_t)conn_index, level);
+            ble_connection_t *conn = find_connection_by_bas_cid(bas_cid);
+            if (conn) {
+                bthid_set_battery_level(conn->conn_index, level);
             }
             break;
         }
@@ -3404,11 +3706,14 @@ static void bas_client_handler(uint8_t packet_type, uint16_t channel, uint8_t *p
 
 static void start_battery_service_client(hci_con_handle_t handle)
 {
-    uint8_t status = battery_service_client_connect(handle, bas_client_handler, 60000, &hid_state.bas_cid);
+    ble_connection_t *conn = find_connection_by_handle(handle);
+    if (!conn) return;
+
+    uint8_t status = battery_service_client_connect(handle, bas_client_handler, 60000, &conn->bas_cid);
     if (status != ERROR_CODE_SUCCESS) {
         printf("[BTSTACK_HOST] BAS connect failed: status=%d\n", status);
     } else {
-        printf("[BTSTACK_HOST] BAS connect started: cid=0x%04X\n", hid_state.bas_cid);
+        printf("[BTSTACK_HOST] BAS connect started: cid=0x%04X\n", conn->bas_cid);
     }
 }
 
@@ -3448,6 +3753,9 @@ static void dis_client_handler(uint8_t packet_type, uint16_t channel, uint8_t *p
             hci_con_handle_t handle = gattservice_subevent_device_information_done_get_con_handle(packet);
             uint8_t att_status = gattservice_subevent_device_information_done_get_att_status(packet);
             printf("[BTSTACK_HOST] DIS query done: handle=0x%04X status=0x%02X\n", handle, att_status);
+            if (hid_state.dis_handle == handle) {
+                hid_state.dis_active = false;
+            }
             // Start Battery Service client after DIS completes (avoids GATT procedure contention)
             start_battery_service_client(handle);
             break;
@@ -3458,6 +3766,25 @@ static void dis_client_handler(uint8_t packet_type, uint16_t channel, uint8_t *p
     }
 }
 
+// Query Device Information Service for PnP ID (VID/PID). The DIS client
+// serves one connection at a time, so a busy client queues the query for
+// btstack_host_process instead of skipping it.
+static void start_device_info_query(ble_connection_t *conn)
+{
+    uint8_t status = device_information_service_client_query(conn->handle, dis_client_handler);
+    if (status == ERROR_CODE_SUCCESS) {
+        hid_state.dis_active = true;
+        hid_state.dis_handle = conn->handle;
+    } else if (status == ERROR_CODE_COMMAND_DISALLOWED) {
+        printf("[BTSTACK_HOST] DIS busy, queued query for handle=0x%04X\n", conn->handle);
+        conn->dis_pending = true;
+    } else {
+        printf("[BTSTACK_HOST] DIS query failed to start: status=%d\n", status);
+        // DIS unavailable — start BAS directly as fallback
+        start_battery_service_client(conn->handle);
+    }
+}
+
 static void hids_client_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size)
 {
     UNUSED(packet_type);  // hids_client passes HCI_EVENT_GATTSERVICE_META, not HCI_EVENT_PACKET
@@ -3471,10 +3798,11 @@ static void hids_client_handler(uint8_t packet_type, uint16_t channel, uint8_t *
         case GATTSERVICE_SUBEVENT_HID_SERVICE_CONNECTED: {
             uint8_t status = gattservice_subevent_hid_service_connected_get_status(packet);
             uint8_t num_instances = gattservice_subevent_hid_service_connected_get_num_instances(packet);
+            uint16_t hids_cid = gattservice_subevent_hid_service_connected_get_hids_cid(packet);
             printf("[BTSTACK_HOST] HIDS connected! status=%d instances=%d\n", status, num_instances);
 
             if (status == ERROR_CODE_SUCCESS) {
-                ble_connection_t *conn = find_connection_by_handle(hid_state.gatt_handle);
+                ble_connection_t *conn = find_connection_by_hids_cid(hids_cid);
                 if (conn) {
                     conn->state = BLE_STATE_READY;
                     conn->hid_ready = true;
@@ -3495,8 +3823,8 @@ static void hids_client_handler(uint8_t packet_type, uint16_t channel, uint8_t *
                     bt_on_hid_ready(conn->conn_index);
 
                     // Pass HID descriptor to bthid for generic gamepad parsing
-                    const uint8_t* hid_desc = hids_client_descriptor_storage_get_descriptor_data(hid_state.hids_cid, 0);
-                    uint16_t hid_desc_len = hids_client_descriptor_storage_get_descriptor_len(hid_state.hids_cid, 0);
+                    const uint8_t* hid_desc = hids_client_descriptor_storage_get_descriptor_data(hids_cid, 0);
+                    uint16_t hid_desc_len = hids_client_descriptor_storage_get_descriptor_len(hids_cid, 0);
                     if (hid_desc && hid_desc_len > 0) {
                         printf("[BTSTACK_HOST] BLE HID descriptor: %d bytes\n", hid_desc_len);
                         bthid_set_hid_descriptor(conn->conn_index, hid_desc, hid_desc_len);
@@ -3504,17 +3832,12 @@ static void hids_client_handler(uint8_t packet_type, uint16_t channel, uint8_t *
 
                     // Query Device Information Service for PnP ID (VID/PID)
                     // This enables re-matching drivers by VID after initial name-based match
-                    uint8_t dis_status = device_information_service_client_query(conn->handle, dis_client_handler);
-                    if (dis_status != ERROR_CODE_SUCCESS) {
-                        printf("[BTSTACK_HOST] DIS query failed to start: status=%d (singleton busy)\n", dis_status);
-                        // DIS unavailable — start BAS directly as fallback
-                        start_battery_service_client(conn->handle);
-                    }
+                    start_device_info_query(conn);
                 }
 
                 // Explicitly enable notifications
                 printf("[BTSTACK_HOST] Enabling HID notifications...\n");
-                uint8_t result = hids_client_enable_notifications(hid_state.hids_cid);
+                uint8_t result = hids_client_enable_notifications(hids_cid);
                 printf("[BTSTACK_HOST] enable_notifications returned %d\n", result);
             }
             break;
@@ -3528,18 +3851,19 @@ static void hids_client_handler(uint8_t packet_type, uint16_t channel, uint8_t *
         }
 
         case GATTSERVICE_SUBEVENT_HID_REPORT: {
+            uint16_t hids_cid = gattservice_subevent_hid_report_get_hids_cid(packet);
             uint16_t report_len = gattservice_subevent_hid_report_get_report_len(packet);
             const uint8_t *report = gattservice_subevent_hid_report_get_report(packet);
 
+            ble_connection_t *conn = find_connection_by_hids_cid(hids_cid);
+            if (!conn) break;
+
             // Route BLE HID report through bthid layer
-            int conn_index = get_ble_conn_index_by_handle(hid_state.gatt_handle);
-            if (conn_index >= 0) {
-                route_ble_hid_report(conn_index, report, report_len);
-            }
+            route_ble_hid_report(conn->conn_index, report, report_len);
 
             // Forward to callback if set
             if (hid_state.report_callback) {
-                hid_state.report_callback(hid_state.gatt_handle, report, report_len);
+                hid_state.report_callback(conn->handle, report, report_len);
             }
             break;
         }
@@ -3620,10 +3944,11 @@ static void hid_host_packet_handler(uint8_t packet_type, uint16_t channel, uint8
             hid_subevent_incoming_connection_get_address(packet, incoming_addr);
 
             // For Wiimotes/Wii U Pro: accept HID Host connection for reconnection
-            if (wiimote_conn.active && memcmp(incoming_addr, wiimote_conn.addr, 6) == 0) {
+            wiimote_connection_t* wm = find_wiimote_by_addr(incoming_addr);
+            if (wm) {
                 printf("[BTSTACK_HOST] Wiimote HID incoming - accepting\n");
-                wiimote_conn.using_hid_host = true;
-                wiimote_conn.hid_host_cid = hid_cid;
+                wm->using_hid_host = true;
+                wm->hid_host_cid = hid_cid;
                 hid_host_accept_connection(hid_cid, HID_PROTOCOL_MODE_REPORT);
 
                 // Allocate classic_connection slot for HID_SUBEVENT_CONNECTION_OPENED to find
@@ -3632,15 +3957,15 @@ static void hid_host_packet_handler(uint8_t packet_type, uint16_t channel, uint8
                     memset(conn, 0, sizeof(*conn));
                     conn->active = true;
                     conn->hid_cid = hid_cid;
-                    memcpy(conn->addr, wiimote_conn.addr, 6);
-                    memcpy(conn->class_of_device, wiimote_conn.class_of_device, 3);
-                    strncpy(conn->name, wiimote_conn.name, sizeof(conn->name) - 1);
+                    memcpy(conn->addr, wm->addr, 6);
+                    memcpy(conn->class_of_device, wm->class_of_device, 3);
+                    strncpy(conn->name, wm->name, sizeof(conn->name) - 1);
                     conn->vendor_id = 0x057E;  // Nintendo
                     conn->connect_time = btstack_run_loop_get_time_ms();
-                    // Get index for wiimote_conn
+                    // Get index for the wiimote entry
                     for (int i = 0; i < MAX_CLASSIC_CONNECTIONS; i++) {
                         if (&classic_state.connections[i] == conn) {
-                            wiimote_conn.conn_index = i;
+                            wm->conn_index = i;
                             printf("[BTSTACK_HOST] Wiimote: allocated conn_index=%d for HID Host\n", i);
                             break;
                         }
@@ -3649,6 +3974,16 @@ static void hid_host_packet_handler(uint8_t packet_type, uint16_t channel, uint8
                 break;
             }
 
+            // Every controller slot taken: turn the pad away instead of
+            // accepting a connection nothing will service
+            if (!find_classic_connection_by_cid(hid_cid) &&
+                (controller_slots_full() || !find_free_classic_connection())) {
+                printf("[BTSTACK_HOST] HID incoming connection, cid=0x%04X - declining (all %d slots in use)\n",
+                       hid_cid, BT_MAX_CONTROLLERS);
+                hid_host_decline_connection(hid_cid);
+                break;
+            }
+
             // Determine protocol mode from device profile (if name is available)
             hid_protocol_mode_t accept_mode = HID_PROTOCOL_MODE_REPORT_WITH_FALLBACK_TO_BOOT;
             if (classic_state.pending_valid && classic_state.pending_name[0]) {
@@ -3761,9 +4096,9 @@ static void hid_host_packet_handler(uint8_t packet_type, uint16_t channel, uint8
                         conn->profile = conn_profile;
                     }
                 }
-                // Also check wiimote_conn state (may have been set up during inquiry)
-                if (!is_direct_l2cap && wiimote_conn.active &&
-                    memcmp(conn->addr, wiimote_conn.addr, 6) == 0) {
+                // Also check wiimote state (may have been set up during inquiry)
+                wiimote_connection_t* wm = find_wiimote_by_addr(conn->addr);
+                if (!is_direct_l2cap && wm) {
                     is_direct_l2cap = true;
                 }
 
@@ -3785,25 +4120,25 @@ static void hid_host_packet_handler(uint8_t packet_type, uint16_t channel, uint8
                         }
                     }
 
-                    // Initialize wiimote_conn if not already active (e.g., incoming
+                    // Initialize wiimote entry if not already active (e.g., incoming
                     // reconnection where name wasn't available at CONNECTION_COMPLETE)
-                    if (!wiimote_conn.active) {
-                        memset(&wiimote_conn, 0, sizeof(wiimote_conn));
-                        wiimote_conn.active = true;
-                        wiimote_conn.state = WIIMOTE_STATE_IDLE;
-                        memcpy(wiimote_conn.addr, conn->addr, 6);
-                        memcpy(wiimote_conn.class_of_device, conn->class_of_device, 3);
-                        wiimote_conn.using_hid_host = true;
-                        wiimote_conn.hid_host_cid = hid_cid;
+                    if (!wm) {
+                        wm = alloc_wiimote_connection(conn->addr);
+                        if (wm) {
+                            memcpy(wm->class_of_device, conn->class_of_device, 3);
+                            wm->using_hid_host = true;
+                            wm->hid_host_cid = hid_cid;
+                        }
                     }
 
-                    // Link wiimote_conn to this classic_connection slot for routing
+                    // Link wiimote entry to this classic_connection slot for routing
                     int conn_index = get_classic_conn_index(hid_cid);
-                    if (conn_index >= 0) {
-                        wiimote_conn.conn_index = conn_index;
-                        wiimote_conn.vendor_id = conn->vendor_id;
-                        wiimote_conn.product_id = conn->product_id;
-                        strncpy(wiimote_conn.name, conn->name, sizeof(wiimote_conn.name) - 1);
+                    if (wm && conn_index >= 0) {
+                        wm->acl_handle = hid_subevent_connection_opened_get_con_handle(packet);
+                        wm->conn_index = conn_index;
+                        wm->vendor_id = conn->vendor_id;
+                        wm->product_id = conn->product_id;
+                        strncpy(wm->name, conn->name, sizeof(wm->name) - 1);
 
                         bthid_update_device_info(conn_index, conn->name,
                                                  conn->vendor_id, conn->product_id);
@@ -3815,21 +4150,21 @@ static void hid_host_packet_handler(uint8_t packet_type, uint16_t channel, uint8
                         // If Wiimote HID Host mode has issues, consider re-adding the patch.
 
                         printf("[BTSTACK_HOST] Wiimote: conn_index=%d control_cid=0x%04X interrupt_cid=0x%04X using_hid_host=%d\n",
-                               conn_index, wiimote_conn.control_cid, wiimote_conn.interrupt_cid, wiimote_conn.using_hid_host);
+                               conn_index, wm->control_cid, wm->interrupt_cid, wm->using_hid_host);
 
-                        if (wiimote_conn.using_hid_host) {
+                        if (wm->using_hid_host) {
                             // Using HID Host — set up state but defer bt_on_hid_ready
                             // to DESCRIPTOR_AVAILABLE. BTstack's HID Host immediately
                             // starts SDP after CONNECTION_OPENED (state → W2_SEND_SDP_QUERY),
                             // and hid_host_send_report() fails with COMMAND_DISALLOWED
                             // until SDP + SET_PROTOCOL complete. Deferring ensures the
                             // driver's init subcommands (SET_INPUT_MODE etc.) succeed.
-                            wiimote_conn.hid_host_ready = true;
-                            wiimote_conn.state = WIIMOTE_STATE_CONNECTED;
+                            wm->hid_host_ready = true;
+                            wm->state = WIIMOTE_STATE_CONNECTED;
                             btstack_host_stop_scan();
                             scan_timeout_end = 0;
                             printf("[BTSTACK_HOST] Wiimote: HID Host ready, deferring bt_on_hid_ready to DESCRIPTOR_AVAILABLE\n");
-                        } else if (wiimote_conn.control_cid != 0 && wiimote_conn.interrupt_cid != 0) {
+                        } else if (wm->control_cid != 0 && wm->interrupt_cid != 0) {
                             printf("[BTSTACK_HOST] Wiimote: calling bt_on_hid_ready(%d) via direct L2CAP\n", conn_index);
                             bt_on_hid_ready(conn_index);
                         } else {
@@ -3926,6 +4261,12 @@ static void hid_host_packet_handler(uint8_t packet_type, uint16_t channel, uint8
             int conn_index = get_classic_conn_index(hid_cid);
             if (conn_index >= 0) {
                 bt_on_disconnect(conn_index);
+
+                // Wiimote entry routed through this slot is stale now
+                wiimote_connection_t* wm = find_wiimote_by_conn_index(conn_index);
+                if (wm) {
+                    memset(wm, 0, sizeof(*wm));
+                }
             }
 
             // Free connection slot
@@ -3963,8 +4304,6 @@ static void hid_host_packet_handler(uint8_t packet_type, uint16_t channel, uint8
 
 static void wiimote_l2cap_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size)
 {
-    UNUSED(channel);
-
     switch (packet_type) {
         case HCI_EVENT_PACKET: {
             uint8_t event_type = hci_event_packet_get_type(packet);
@@ -3977,6 +4316,12 @@ static void wiimote_l2cap_packet_handler(uint8_t packet_type, uint16_t channel,
                 printf("[BTSTACK_HOST] Wiimote L2CAP opened: status=%d PSM=0x%04X cid=0x%04X\n",
                        status, psm, local_cid);
 
+                wiimote_connection_t* wm = find_wiimote_by_cid(local_cid);
+                if (!wm) {
+                    printf("[BTSTACK_HOST] Wiimote: no entry for cid=0x%04X\n", local_cid);
+                    return;
+                }
+
                 if (status != 0) {
                     printf("[BTSTACK_HOST] Wiimote: L2CAP channel failed: 0x%02X\n", status);
                     // Don't deactivate - wait for HID Host to handle via HID_SUBEVENT_INCOMING_CONNECTION
@@ -3985,30 +4330,30 @@ static void wiimote_l2cap_packet_handler(uint8_t packet_type, uint16_t channel,
                     return;
                 }
 
-                if (psm == PSM_HID_CONTROL && wiimote_conn.state == WIIMOTE_STATE_W4_CONTROL_CONNECTED) {
+                if (psm == PSM_HID_CONTROL && wm->state == WIIMOTE_STATE_W4_CONTROL_CONNECTED) {
                     // Control channel opened, now create interrupt channel
                     printf("[BTSTACK_HOST] Wiimote: Control channel connected, creating Interrupt channel (PSM 0x13)...\n");
 
                     uint16_t interrupt_cid;
                     uint8_t l2cap_status = l2cap_create_channel(wiimote_l2cap_packet_handler,
-                                                                wiimote_conn.addr,
+                                                                wm->addr,
                                                                 PSM_HID_INTERRUPT,
                                                                 0xFFFF,
                                                                 &interrupt_cid);
                     if (l2cap_status == ERROR_CODE_SUCCESS) {
-                        wiimote_conn.interrupt_cid = interrupt_cid;
-                        wiimote_conn.state = WIIMOTE_STATE_W4_INTERRUPT_CONNECTED;
+                        wm->interrupt_cid = interrupt_cid;
+                        wm->state = WIIMOTE_STATE_W4_INTERRUPT_CONNECTED;
                         printf("[BTSTACK_HOST] Wiimote: L2CAP interrupt channel request sent, cid=0x%04X\n", interrupt_cid);
                     } else {
                         printf("[BTSTACK_HOST] Wiimote: l2cap_create_channel (interrupt) failed: 0x%02X\n", l2cap_status);
-                        wiimote_conn.active = false;
+                        wm->active = false;
                         classic_state.pending_hid_connect = false;
                     }
 
-                } else if (psm == PSM_HID_INTERRUPT && wiimote_conn.state == WIIMOTE_STATE_W4_INTERRUPT_CONNECTED) {
+                } else if (psm == PSM_HID_INTERRUPT && wm->state == WIIMOTE_STATE_W4_INTERRUPT_CONNECTED) {
                     // Interrupt channel opened - connection complete!
                     printf("[BTSTACK_HOST] Wiimote: Interrupt channel connected - HID READY!\n");
-                    wiimote_conn.state = WIIMOTE_STATE_CONNECTED;
+                    wm->state = WIIMOTE_STATE_CONNECTED;
                     classic_state.pending_hid_connect = false;
 
                     // Stop scanning now that we have a connected device
@@ -4016,24 +4361,24 @@ static void wiimote_l2cap_packet_handler(uint8_t packet_type, uint16_t channel,
                     scan_timeout_end = 0;
 
                     // Allocate classic connection slot if not already allocated (reconnection case)
-                    if (wiimote_conn.conn_index < 0) {
+                    if (wm->conn_index < 0) {
                         classic_connection_t* conn = find_free_classic_connection();
                         if (conn) {
                             memset(conn, 0, sizeof(*conn));
                             conn->active = true;
                             conn->hid_cid = 0xFFFF;  // Mark as Wiimote (no HID Host CID)
-                            memcpy(conn->addr, wiimote_conn.addr, 6);
-                            strncpy(conn->name, wiimote_conn.name, sizeof(conn->name) - 1);
+                            memcpy(conn->addr, wm->addr, 6);
+                            strncpy(conn->name, wm->name, sizeof(conn->name) - 1);
                             conn->vendor_id = 0x057E;  // Nintendo
-                            conn->product_id = bt_device_wiimote_pid_from_name(wiimote_conn.name);
+                            conn->product_id = bt_device_wiimote_pid_from_name(wm->name);
                             conn->hid_ready = true;
 
                             // Get index
                             for (int i = 0; i < MAX_CLASSIC_CONNECTIONS; i++) {
                                 if (&classic_state.connections[i] == conn) {
-                                    wiimote_conn.conn_index = i;
-                                    wiimote_conn.vendor_id = conn->vendor_id;
-                                    wiimote_conn.product_id = conn->product_id;
+                                    wm->conn_index = i;
+                                    wm->vendor_id = conn->vendor_id;
+                                    wm->product_id = conn->product_id;
                                     printf("[BTSTACK_HOST] Wiimote: allocated conn_index=%d\n", i);
                                     break;
                                 }
@@ -4042,21 +4387,21 @@ static void wiimote_l2cap_packet_handler(uint8_t packet_type, uint16_t channel,
                     }
 
                     // Update the classic connection slot
-                    if (wiimote_conn.conn_index >= 0 && wiimote_conn.conn_index < MAX_CLASSIC_CONNECTIONS) {
-                        classic_connection_t* conn = &classic_state.connections[wiimote_conn.conn_index];
+                    if (wm->conn_index >= 0 && wm->conn_index < MAX_CLASSIC_CONNECTIONS) {
+                        classic_connection_t* conn = &classic_state.connections[wm->conn_index];
                         conn->hid_ready = true;
 
                         // Update bthid with device info
                         // Use SDP VID/PID if available, otherwise default to Nintendo (0x057E)
-                        uint16_t vid = wiimote_conn.vendor_id ? wiimote_conn.vendor_id : 0x057E;
-                        uint16_t pid = wiimote_conn.product_id;
+                        uint16_t vid = wm->vendor_id ? wm->vendor_id : 0x057E;
+                        uint16_t pid = wm->product_id;
                         printf("[BTSTACK_HOST] Wiimote: updating bthid with name='%s' VID=0x%04X PID=0x%04X\n",
-                               wiimote_conn.name, vid, pid);
-                        bthid_update_device_info(wiimote_conn.conn_index, wiimote_conn.name, vid, pid);
+                               wm->name, vid, pid);
+                        bthid_update_device_info(wm->conn_index, wm->name, vid, pid);
 
                         // Notify bthid layer
-                        printf("[BTSTACK_HOST] Wiimote: calling bt_on_hid_ready(%d)\n", wiimote_conn.conn_index);
-                        bt_on_hid_ready(wiimote_conn.conn_index);
+                        printf("[BTSTACK_HOST] Wiimote: calling bt_on_hid_ready(%d)\n", wm->conn_index);
+                        bt_on_hid_ready(wm->conn_index);
                     }
                 }
 
@@ -4064,17 +4409,17 @@ static void wiimote_l2cap_packet_handler(uint8_t packet_type, uint16_t channel,
                 uint16_t local_cid = l2cap_event_channel_closed_get_local_cid(packet);
                 printf("[BTSTACK_HOST] Wiimote L2CAP closed: cid=0x%04X\n", local_cid);
 
-                if (wiimote_conn.active &&
-                    (local_cid == wiimote_conn.control_cid || local_cid == wiimote_conn.interrupt_cid)) {
+                wiimote_connection_t* wm = find_wiimote_by_cid(local_cid);
+                if (wm) {
                     // Notify disconnect
-                    if (wiimote_conn.conn_index >= 0) {
-                        bt_on_disconnect(wiimote_conn.conn_index);
+                    if (wm->conn_index >= 0) {
+                        bt_on_disconnect(wm->conn_index);
                         // Clear connection slot
-                        if (wiimote_conn.conn_index < MAX_CLASSIC_CONNECTIONS) {
-                            memset(&classic_state.connections[wiimote_conn.conn_index], 0, sizeof(classic_connection_t));
+                        if (wm->conn_index < MAX_CLASSIC_CONNECTIONS) {
+                            memset(&classic_state.connections[wm->conn_index], 0, sizeof(classic_connection_t));
                         }
                     }
-                    memset(&wiimote_conn, 0, sizeof(wiimote_conn));
+                    memset(wm, 0, sizeof(*wm));
                 }
             }
             break;
@@ -4083,14 +4428,15 @@ static void wiimote_l2cap_packet_handler(uint8_t packet_type, uint16_t channel,
         case L2CAP_DATA_PACKET: {
             // HID data from Wiimote interrupt channel
             // Data already includes HID header (0xA1 for DATA|INPUT)
-            if (wiimote_conn.active && wiimote_conn.state == WIIMOTE_STATE_CONNECTED) {
+            wiimote_connection_t* wm = find_wiimote_by_cid(channel);
+            if (wm && wm->state == WIIMOTE_STATE_CONNECTED) {
                 // Route to bthid layer
-                if (wiimote_conn.conn_index >= 0 && size > 0) {
-                    bt_on_hid_report(wiimote_conn.conn_index, packet, size);
+                if (wm->conn_index >= 0 && size > 0) {
+                    bt_on_hid_report(wm->conn_index, packet, size);
                 }
             } else {
-                printf("[BTSTACK_HOST] Wiimote data dropped: active=%d state=%d\n",
-                       wiimote_conn.active, wiimote_conn.state);
+                printf("[BTSTACK_HOST] Wiimote data dropped: cid=0x%04X state=%d\n",
+                       channel, wm ? wm->state : -1);
             }
             break;
         }
@@ -4115,9 +4461,8 @@ bool btstack_classic_send_set_report_type(uint8_t conn_index, uint8_t report_typ
     if (!conn->active || !conn->hid_ready) return false;
 
     // Check if this is a Wiimote/direct L2CAP connection (marked with hid_cid = 0xFFFF)
-    if (conn->hid_cid == 0xFFFF && wiimote_conn.active &&
-        wiimote_conn.conn_index == conn_index &&
-        wiimote_conn.state == WIIMOTE_STATE_CONNECTED) {
+    wiimote_connection_t* wm = (conn->hid_cid == 0xFFFF) ? find_wiimote_by_conn_index(conn_index) : NULL;
+    if (wm && wm->state == WIIMOTE_STATE_CONNECTED) {
         // Send SET_REPORT on control channel via raw L2CAP
         // HID transaction format: [SET_REPORT | report_type] [report_id] [data...]
         static uint8_t wiimote_setreport_buf[80];
@@ -4126,7 +4471,7 @@ bool btstack_classic_send_set_report_type(uint8_t conn_index, uint8_t report_typ
         wiimote_setreport_buf[0] = 0x50 | (report_type & 0x03);  // SET_REPORT | type
         wiimote_setreport_buf[1] = report_id;
         if (len > 0) memcpy(wiimote_setreport_buf + 2, data, len);
-        uint8_t status = l2cap_send(wiimote_conn.control_cid, wiimote_setreport_buf, total);
+        uint8_t status = l2cap_send(wm->control_cid, wiimote_setreport_buf, total);
         if (status != ERROR_CODE_SUCCESS) {
             printf("[BTSTACK_HOST] wiimote send_set_report failed: type=%d id=0x%02X status=%d\n",
                    report_type, report_id, status);
@@ -4174,8 +4519,8 @@ bool btstack_classic_send_report(uint8_t conn_index, uint8_t report_id,
         if (ble_index >= MAX_BLE_CONNECTIONS) return false;
         ble_connection_t* conn = &hid_state.connections[ble_index];
         if (conn->handle == HCI_CON_HANDLE_INVALID || !conn->hid_ready) return false;
-        if (hid_state.hids_cid == 0) return false;
-        uint8_t status = hids_client_send_write_report(hid_state.hids_cid, report_id,
+        if (conn->hids_cid == 0) return false;
+        uint8_t status = hids_client_send_write_report(conn->hids_cid, report_id,
                                                         HID_REPORT_TYPE_OUTPUT,
                                                         data, len);
         if (status != ERROR_CODE_SUCCESS) {
@@ -4191,9 +4536,8 @@ bool btstack_classic_send_report(uint8_t conn_index, uint8_t report_id,
     if (!conn->active || !conn->hid_ready) return false;
 
     // Check if this is a Wiimote (direct L2CAP, marked with hid_cid = 0xFFFF)
-    if (conn->hid_cid == 0xFFFF && wiimote_conn.active &&
-        wiimote_conn.conn_index == conn_index &&
-        wiimote_conn.state == WIIMOTE_STATE_CONNECTED) {
+    wiimote_connection_t* wm = (conn->hid_cid == 0xFFFF) ? find_wiimote_by_conn_index(conn_index) : NULL;
+    if (wm && wm->state == WIIMOTE_STATE_CONNECTED) {
         // Build HID packet: 0xA2 (DATA|OUTPUT) + report_id + data
         // Buffer must fit DS5 BT output (79 bytes: 0xA2 + 78-byte report with CRC)
         static uint8_t wiimote_send_buf[80];
@@ -4201,7 +4545,7 @@ bool btstack_classic_send_report(uint8_t conn_index, uint8_t report_id,
         wiimote_send_buf[0] = 0xA2;  // DATA | OUTPUT
         wiimote_send_buf[1] = report_id;
         memcpy(wiimote_send_buf + 2, data, len);
-        return l2cap_send(wiimote_conn.interrupt_cid, wiimote_send_buf, len + 2) == ERROR_CODE_SUCCESS;
+        return l2cap_send(wm->interrupt_cid, wiimote_send_buf, len + 2) == ERROR_CODE_SUCCESS;
     }
 
     // hid_host_send_report stores a pointer to the data and sends asynchronously.
@@ -4220,23 +4564,24 @@ bool btstack_wiimote_is_connection(uint8_t conn_index)
     classic_connection_t* conn = &classic_state.connections[conn_index];
     // Wiimote connections are marked with hid_cid = 0xFFFF
     return conn->active && conn->hid_cid == 0xFFFF &&
-           wiimote_conn.active && wiimote_conn.conn_index == conn_index;
+           find_wiimote_by_conn_index(conn_index) != NULL;
 }
 
 // Check if we can send on Wiimote L2CAP channel
 bool btstack_wiimote_can_send(uint8_t conn_index)
 {
-    if (!wiimote_conn.active) {
+    wiimote_connection_t* wm = find_wiimote_by_conn_index(conn_index);
+    if (!wm) {
         return false;
     }
 
     // Prefer direct L2CAP when we have the interrupt CID
-    if (wiimote_conn.interrupt_cid != 0) {
-        return l2cap_can_send_packet_now(wiimote_conn.interrupt_cid) != 0;
+    if (wm->interrupt_cid != 0) {
+        return l2cap_can_send_packet_now(wm->interrupt_cid) != 0;
     }
 
     // Fallback to HID Host path
-    if (wiimote_conn.using_hid_host && wiimote_conn.hid_host_ready) {
+    if (wm->using_hid_host && wm->hid_host_ready) {
         return true;  // HID Host handles flow control internally
     }
 
@@ -4246,10 +4591,11 @@ bool btstack_wiimote_can_send(uint8_t conn_index)
 // Send raw L2CAP data to Wiimote on INTERRUPT channel
 bool btstack_wiimote_send_raw(uint8_t conn_index, const uint8_t* data, uint16_t len)
 {
-    printf("[BTSTACK_HOST] wiimote_send_raw: active=%d using_hid=%d hid_ready=%d int_cid=0x%04X\n",
-           wiimote_conn.active, wiimote_conn.using_hid_host, wiimote_conn.hid_host_ready, wiimote_conn.interrupt_cid);
+    wiimote_connection_t* wm = find_wiimote_by_conn_index(conn_index);
+    printf("[BTSTACK_HOST] wiimote_send_raw: idx=%d active=%d using_hid=%d hid_ready=%d int_cid=0x%04X\n",
+           conn_index, wm != NULL, wm && wm->using_hid_host, wm && wm->hid_host_ready, wm ? wm->interrupt_cid : 0);
 
-    if (!wiimote_conn.active) {
+    if (!wm) {
         printf("[BTSTACK_HOST] wiimote_send_raw: no active connection\n");
         return false;
     }
@@ -4260,24 +4606,24 @@ bool btstack_wiimote_send_raw(uint8_t conn_index, const uint8_t* data, uint16_t
 
     // Prefer direct L2CAP when we have the interrupt CID (works even with HID Host)
     // This bypasses hid_host_send_report which can fail with 0x0C if HID Host state isn't ready
-    if (wiimote_conn.interrupt_cid != 0) {
-        if (!l2cap_can_send_packet_now(wiimote_conn.interrupt_cid)) {
+    if (wm->interrupt_cid != 0) {
+        if (!l2cap_can_send_packet_now(wm->interrupt_cid)) {
             printf("[BTSTACK_HOST] wiimote_send_raw: L2CAP not ready to send\n");
             return false;
         }
 
-        uint8_t status = l2cap_send(wiimote_conn.interrupt_cid, data, len);
+        uint8_t status = l2cap_send(wm->interrupt_cid, data, len);
         if (status != ERROR_CODE_SUCCESS) {
             printf("[BTSTACK_HOST] wiimote_send_raw: l2cap_send failed status=0x%02X\n", status);
         } else {
             printf("[BTSTACK_HOST] wiimote_send_raw: sent %d bytes on INTR cid=0x%04X (0x%02X 0x%02X...)\n",
-                   len, wiimote_conn.interrupt_cid, data[0], len > 1 ? data[1] : 0);
+                   len, wm->interrupt_cid, data[0], len > 1 ? data[1] : 0);
         }
         return status == ERROR_CODE_SUCCESS;
     }
 
     // Fallback to HID Host when using_hid_host but no direct CID (shouldn't happen normally)
-    if (wiimote_conn.using_hid_host && wiimote_conn.hid_host_ready) {
+    if (wm->using_hid_host && wm->hid_host_ready) {
         // Data format: first byte is 0xA2, second is report ID, rest is data
         if (len < 2) return false;
         uint8_t report_id = data[1];
@@ -4287,8 +4633,8 @@ bool btstack_wiimote_send_raw(uint8_t conn_index, const uint8_t* data, uint16_t
         if (payload_len > sizeof(wiimote_hid_report_buf)) return false;
         if (payload_len > 0) memcpy(wiimote_hid_report_buf, &data[2], payload_len);
         printf("[BTSTACK_HOST] wiimote_send_raw via HID Host: cid=0x%04X report=0x%02X len=%d\n",
-               wiimote_conn.hid_host_cid, report_id, payload_len);
-        uint8_t status = hid_host_send_report(wiimote_conn.hid_host_cid, report_id, wiimote_hid_report_buf, payload_len);
+               wm->hid_host_cid, report_id, payload_len);
+        uint8_t status = hid_host_send_report(wm->hid_host_cid, report_id, wiimote_hid_report_buf, payload_len);
         if (status == ERROR_CODE_SUCCESS) {
             printf("[BTSTACK_HOST] wiimote_send_raw: sent %d bytes via HID Host\n", len);
         } else {
@@ -4304,10 +4650,11 @@ bool btstack_wiimote_send_raw(uint8_t conn_index, const uint8_t* data, uint16_t
 // Send raw L2CAP data to Wiimote on CONTROL channel
 bool btstack_wiimote_send_control(uint8_t conn_index, const uint8_t* data, uint16_t len)
 {
+    wiimote_connection_t* wm = find_wiimote_by_conn_index(conn_index);
     printf("[BTSTACK_HOST] wiimote_send_control: idx=%d len=%d control_cid=0x%04X using_hid_host=%d\n",
-           conn_index, len, wiimote_conn.control_cid, wiimote_conn.using_hid_host);
+           conn_index, len, wm ? wm->control_cid : 0, wm && wm->using_hid_host);
 
-    if (!wiimote_conn.active) {
+    if (!wm) {
         printf("[BTSTACK_HOST] wiimote_send_control: no active connection\n");
         return false;
     }
@@ -4317,8 +4664,8 @@ bool btstack_wiimote_send_control(uint8_t conn_index, const uint8_t* data, uint1
     }
 
     // Prefer direct L2CAP when we have the control CID (works even with HID Host)
-    if (wiimote_conn.control_cid != 0) {
-        if (!l2cap_can_send_packet_now(wiimote_conn.control_cid)) {
+    if (wm->control_cid != 0) {
+        if (!l2cap_can_send_packet_now(wm->control_cid)) {
             printf("[BTSTACK_HOST] wiimote_send_control: L2CAP not ready to send\n");
             return false;
         }
@@ -4332,8 +4679,8 @@ bool btstack_wiimote_send_control(uint8_t conn_index, const uint8_t* data, uint1
         }
 
         printf("[BTSTACK_HOST] wiimote_send_control via L2CAP: cid=0x%04X len=%d hdr=0x%02X\n",
-               wiimote_conn.control_cid, len, send_buf[0]);
-        uint8_t status = l2cap_send(wiimote_conn.control_cid, send_buf, len);
+               wm->control_cid, len, send_buf[0]);
+        uint8_t status = l2cap_send(wm->control_cid, send_buf, len);
         if (status != ERROR_CODE_SUCCESS) {
             printf("[BTSTACK_HOST] wiimote_send_control: l2cap_send failed status=0x%02X\n", status);
         }
@@ -4341,7 +4688,7 @@ bool btstack_wiimote_send_control(uint8_t conn_index, const uint8_t* data, uint1
     }
 
     // Fallback to HID Host when using_hid_host but no direct CID
-    if (wiimote_conn.using_hid_host && wiimote_conn.hid_host_ready) {
+    if (wm->using_hid_host && wm->hid_host_ready) {
         // Data format: first byte is 0x52 (SET_REPORT), second is report type+ID
         if (len < 2) return false;
         uint8_t report_id = data[1];
@@ -4350,7 +4697,7 @@ bool btstack_wiimote_send_control(uint8_t conn_index, const uint8_t* data, uint1
         static uint8_t wiimote_hid_setreport_buf[80];
         if (payload_len > sizeof(wiimote_hid_setreport_buf)) return false;
         if (payload_len > 0) memcpy(wiimote_hid_setreport_buf, &data[2], payload_len);
-        uint8_t status = hid_host_send_set_report(wiimote_conn.hid_host_cid, HID_REPORT_TYPE_OUTPUT,
+        uint8_t status = hid_host_send_set_report(wm->hid_host_cid, HID_REPORT_TYPE_OUTPUT,
                                                    report_id, wiimote_hid_setreport_buf, payload_len);
         if (status == ERROR_CODE_SUCCESS) {
             printf("[BTSTACK_HOST] wiimote_send_control: sent %d bytes via HID Host\n", len);
@@ -4476,9 +4823,8 @@ void btstack_host_delete_all_bonds(void)
     btstack_erase_flash_banks();
 
     // Re-initialize the TLV context to pick up the erased banks
-    const hal_flash_bank_t *flash_bank = pico_flash_bank_instance();
     btstack_tlv_flash_bank_init_instance(&btstack_tlv_flash_bank_context,
-                                          flash_bank, NULL);
+                                          &sched_flash_bank, NULL);
     printf("[BTSTACK_HOST] TLV re-initialized with clean flash banks\n");
 #else
     // For CYW43/ESP32, use BTstack's standard APIs
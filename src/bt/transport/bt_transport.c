@@ -2,6 +2,7 @@
 // Manages the active transport and provides weak callback defaults
 
 #include "bt_transport.h"
+#include "platform/platform.h"
 #include <stdio.h>
 
 // Weak so peripheral-only builds (no bthid) don't need the symbol
@@ -33,6 +34,70 @@ void bt_init(const bt_transport_t* transport)
     }
 }
 
+// ============================================================================
+// INPUT INTERFACE
+// ============================================================================
+
+// How long bring-up pumps the transport before reporting ready anyway.
+// bt_task() keeps running afterwards, so a late radio still comes up.
+#ifndef BT_INPUT_READY_TIMEOUT_MS
+#define BT_INPUT_READY_TIMEOUT_MS 3000
+#endif
+
+static const bt_transport_t* bt_input_transport = NULL;
+static uint32_t bt_input_start_delay_ms = 0;
+static uint32_t bt_input_stage_ms = 0;
+
+void bt_input_set_transport(const bt_transport_t* transport, uint32_t start_delay_ms)
+{
+    bt_input_transport = transport;
+    bt_input_start_delay_ms = start_delay_ms;
+    bt_input_stage_ms = platform_time_ms();
+}
+
+static void bt_input_init(void)
+{
+    bt_init(bt_input_transport);
+}
+
+// Stage 0 holds off for the start delay and then runs the transport init
+// (the CYW43 firmware load is a single SDK call), stage 1 pumps the
+// transport until the controller reports powered on.
+static input_init_result_t bt_input_init_stage(uint8_t stage)
+{
+    uint32_t now = platform_time_ms();
+
+    switch (stage) {
+        case 0:
+            if (now - bt_input_stage_ms < bt_input_start_delay_ms) return INPUT_INIT_WAIT;
+            bt_input_init();
+            bt_input_stage_ms = platform_time_ms();
+            return INPUT_INIT_NEXT;
+
+        case 1:
+            bt_task();
+            if (bt_is_ready()) return INPUT_INIT_DONE;
+            if (now - bt_input_stage_ms < BT_INPUT_READY_TIMEOUT_MS) return INPUT_INIT_WAIT;
+            printf("[BT] Transport not ready after %dms, continuing\n", BT_INPUT_READY_TIMEOUT_MS);
+            return INPUT_INIT_DONE;
+
+        default:
+            return INPUT_INIT_DONE;
+    }
+}
+
+static bool bt_input_is_connected(void) { return bt_get_connection_count() > 0; }
+
+const InputInterface bt_input_interface = {
+    .name = "Bluetooth",
+    .source = INPUT_SOURCE_BLE_CENTRAL,
+    .init = bt_input_init,
+    .task = bt_task,
+    .init_stage = bt_input_init_stage,
+    .is_connected = bt_input_is_connected,
+    .get_device_count = bt_get_connection_count,
+};
+
 // ============================================================================
 // WEAK CALLBACK IMPLEMENTATIONS
 // Override in BTHID layer
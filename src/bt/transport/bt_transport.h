@@ -7,16 +7,16 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include "bt/btstack/bt_limits.h"
+#include "core/input_interface.h"
 
 // ============================================================================
 // CONSTANTS
 // ============================================================================
 
-// 4 Classic + 2 BLE connections (BLE uses conn_index 4-5)
-// Apps can override this by defining BT_MAX_CONNECTIONS in app.h before including this header
-#ifndef BT_MAX_CONNECTIONS
-#define BT_MAX_CONNECTIONS      6
-#endif
+// Size of the conn_index space: Classic slots first, then BLE (see bt_limits.h).
+// At most BT_MAX_CONTROLLERS of them are in use at once.
+#define BT_MAX_CONNECTIONS      BT_MAX_CONN_INDEX
 #define BT_MAX_NAME_LEN         48
 
 // ============================================================================
@@ -134,6 +134,17 @@ static inline bool bt_is_pairing_mode(void) {
            ? bt_transport->is_pairing_mode() : false;
 }
 
+// ============================================================================
+// INPUT INTERFACE (BT-only apps)
+// ============================================================================
+
+// Brings the transport up from the main loop and runs bt_task() once it's
+// ready. Apps pick the transport in app_init(); start_delay_ms (counted from
+// this call) holds bring-up off for consoles that handshake slowly.
+void bt_input_set_transport(const bt_transport_t* transport, uint32_t start_delay_ms);
+
+extern const InputInterface bt_input_interface;
+
 // ============================================================================
 // TRANSPORT CALLBACKS (implemented by BTHID layer)
 // ============================================================================
@@ -8,6 +8,7 @@ static const InputInterface* const* s_inputs = NULL;
 static uint8_t s_input_count = 0;
 static const OutputInterface* const* s_outputs = NULL;
 static uint8_t s_output_count = 0;
+static input_bringup_t s_input_bringup[MAX_INPUT_INTERFACES];
 
 void app_registry_set(const InputInterface* const* inputs, uint8_t input_count,
                       const OutputInterface* const* outputs, uint8_t output_count)
@@ -30,6 +31,12 @@ const OutputInterface* const* app_registry_outputs(uint8_t* count)
     return s_outputs;
 }
 
+input_bringup_t* app_registry_input_bringup(uint8_t index)
+{
+    if (index >= MAX_INPUT_INTERFACES) return NULL;
+    return &s_input_bringup[index];
+}
+
 const char* app_registry_input_source_name(input_source_t source)
 {
     switch (source) {
@@ -25,6 +25,18 @@ const InputInterface* const* app_registry_inputs(uint8_t* count);
 // Retrieve registered outputs. *count = 0 and returns NULL if not set.
 const OutputInterface* const* app_registry_outputs(uint8_t* count);
 
+// Bring-up of one registered input, filled in by main.c as the main loop
+// initializes it. Times are ms since boot, 0 = not yet.
+typedef struct {
+    bool ready;                 // Init finished, task() is running
+    uint8_t stage;              // Current init stage (init_stage inputs)
+    uint32_t ready_ms;          // When init finished
+    uint32_t first_input_ms;    // First event the input submitted to the router
+} input_bringup_t;
+
+// Bring-up record for inputs[index], NULL if index is out of range.
+input_bringup_t* app_registry_input_bringup(uint8_t index);
+
 // Stable string names for router enums (for web/JSON consumers).
 // Returns a static lower-case identifier; never NULL.
 const char* app_registry_input_source_name(input_source_t source);
@@ -0,0 +1,64 @@
+// button_encoder.h - Table-driven JP_BUTTON_* → output format encoder
+//
+// Output encoders translate the JP_BUTTON_* bitmap into a console or USB
+// report layout. Instead of one branch per button per report, the mapping is
+// compiled once into nibble lookup tables: encoding is then six table loads
+// and ORs, independent of how many buttons the format has.
+//
+// Usage:
+//   static const button_encoder_map_t map[] = {
+//       { JP_BUTTON_B1, FMT_BTN_A },
+//       { JP_BUTTON_B2, FMT_BTN_B },
+//   };
+//   static button_encoder_t enc;
+//   button_encoder_build(&enc, map, count);        // at init
+//   uint32_t bits = button_encoder_encode(&enc, buttons);  // per report
+//
+// A map entry's `buttons` may hold several JP_BUTTON_* bits: any of them sets
+// `bits` (same as `if (buttons & MASK) out |= BITS`). Active-low formats XOR
+// the result with their idle mask.
+
+#ifndef BUTTON_ENCODER_H
+#define BUTTON_ENCODER_H
+
+#include <stdint.h>
+
+// JP_BUTTON_* occupy bits 0-23 (see buttons.h)
+#define BUTTON_ENCODER_NIBBLES 6
+
+typedef struct {
+    uint32_t buttons;   // JP_BUTTON_* mask (any bit triggers)
+    uint32_t bits;      // Output bits to set
+} button_encoder_map_t;
+
+typedef struct {
+    uint32_t lut[BUTTON_ENCODER_NIBBLES][16];
+} button_encoder_t;
+
+static inline void button_encoder_build(button_encoder_t* enc,
+                                        const button_encoder_map_t* map,
+                                        uint8_t count)
+{
+    for (uint8_t n = 0; n < BUTTON_ENCODER_NIBBLES; n++) {
+        for (uint8_t v = 0; v < 16; v++) {
+            uint32_t in = (uint32_t)v << (n * 4);
+            uint32_t out = 0;
+            for (uint8_t i = 0; i < count; i++) {
+                if (in & map[i].buttons) out |= map[i].bits;
+            }
+            enc->lut[n][v] = out;
+        }
+    }
+}
+
+static inline uint32_t button_encoder_encode(const button_encoder_t* enc, uint32_t buttons)
+{
+    return enc->lut[0][buttons & 0xF]
+         | enc->lut[1][(buttons >> 4) & 0xF]
+         | enc->lut[2][(buttons >> 8) & 0xF]
+         | enc->lut[3][(buttons >> 12) & 0xF]
+         | enc->lut[4][(buttons >> 16) & 0xF]
+         | enc->lut[5][(buttons >> 20) & 0xF];
+}
+
+#endif // BUTTON_ENCODER_H
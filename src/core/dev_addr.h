@@ -0,0 +1,39 @@
+// dev_addr.h - input_event_t.dev_addr ranges for non-USB sources
+//
+// USB inputs use their TinyUSB address (1-127) and Bluetooth its conn_index.
+// Every other source takes a 16-address range above 127 and adds its port or
+// slot, so router slotting, remove_players_by_address() and the link loop
+// filters can tell sources apart. Sources that share a range must not be
+// built into the same app.
+
+#ifndef DEV_ADDR_H
+#define DEV_ADDR_H
+
+#define DEV_ADDR_RANGE_SIZE         16
+
+// 0xB0: synthetic input (loadgen virtual controllers, 0xB0-0xB7)
+#define DEV_ADDR_LOADGEN_BASE       0xB0
+
+// 0xC0: UART peer link, Wii extension
+#define DEV_ADDR_UART_PEER_BASE     0xC0
+#define DEV_ADDR_WII_EXT_BASE       0xC0
+
+// 0xD0: GameCube host ports, UART host players, Nuon host
+#define DEV_ADDR_GC_BASE            0xD0
+#define DEV_ADDR_UART_HOST_BASE     0xD0
+#define DEV_ADDR_NUON_HOST          0xD0
+
+// 0xE0: N64 and 3DO host ports, 3DO extension pads, PSX, I2C peer,
+// WiFi (JOCP) slots, standalone JoyWing
+#define DEV_ADDR_N64_BASE           0xE0
+#define DEV_ADDR_3DO_BASE           0xE0
+#define DEV_ADDR_PSX                0xE1
+#define DEV_ADDR_I2C_PEER_BASE      0xE0
+#define DEV_ADDR_WIFI_BASE          0xE0
+#define DEV_ADDR_JOYWING            0xE0
+
+// 0xF0: SNES/NES/LodgeNet/arcade/JVS ports, pad GPIO, JoyWing merged into pad
+#define DEV_ADDR_NATIVE_BASE        0xF0
+#define DEV_ADDR_PAD_BASE           0xF0
+
+#endif // DEV_ADDR_H
@@ -8,6 +8,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include "core/dev_addr.h"
 
 // ============================================================================
 // Device Type Classification
@@ -120,7 +121,7 @@ typedef enum {
 
 typedef struct {
     // Device identification
-    uint8_t dev_addr;           // Device address (USB: 1-127, BT: conn_index, Native: port)
+    uint8_t dev_addr;           // Device address (USB: 1-127, BT: conn_index, other: see dev_addr.h)
     int8_t instance;            // Instance number (for multi-controller devices)
     input_device_type_t type;   // Device type classification
     input_transport_t transport; // Connection type (USB, BT, native)
@@ -10,13 +10,27 @@
 #include <stdbool.h>
 #include "core/router/router.h"
 
+// Result of one staged init call
+typedef enum {
+    INPUT_INIT_DONE = 0,                 // Ready, task() starts running
+    INPUT_INIT_NEXT,                     // Stage finished, call again with stage + 1
+    INPUT_INIT_WAIT,                     // Stage still in progress, call again with the same stage
+} input_init_result_t;
+
 // Input interface - abstracts different input sources
+//
+// Inputs are brought up from the main loop, one init call per input per loop
+// iteration, so an input starts running its task as soon as it is ready
+// rather than after every other input has initialized. Inputs whose bring-up
+// has slow parts provide init_stage instead of init and split the work into
+// stages; init is treated as a single stage.
 typedef struct {
     const char* name;                    // Input name (e.g., "USB Host", "SNES", "BLE")
     input_source_t source;               // Router source type for routing table
 
     void (*init)(void);                  // Initialize input hardware/protocol
     void (*task)(void);                  // Core 0 polling task (NULL if not needed)
+    input_init_result_t (*init_stage)(uint8_t stage);  // Staged init (optional, replaces init)
 
     // Status (optional)
     bool (*is_connected)(void);          // Any device connected? (NULL = always true)
@@ -221,9 +221,21 @@ static const char* get_device_name(const input_event_t* event) {
 // OUTPUT STATE (replaces players[] array)
 // ============================================================================
 
-// Output state per output type (GameCube, PCEngine, 3DO, etc.)
-// Each output has up to MAX_PLAYERS_PER_OUTPUT player slots
-static output_state_t router_outputs[MAX_OUTPUTS][MAX_PLAYERS_PER_OUTPUT];
+// Per-player state lives in app-sized pools instead of a full
+// [MAX_OUTPUTS][MAX_PLAYERS_PER_OUTPUT] matrix. Only outputs the app
+// registers (max_players_per_output > 0, or a route/active-output entry)
+// get slots, and only as many as their real player count. Apps use one or
+// two outputs, so this keeps ~15 outputs x 8 players of ~110-byte events
+// out of SRAM on RP2040 and the 64KB CH32V307.
+//
+// output_slot_base/output_slot_count remap output_target_t → first slot in
+// the pools below, keeping router_get_output() an O(1) lookup on core 1.
+static output_state_t router_outputs[ROUTER_MAX_PLAYER_SLOTS];
+static uint8_t output_slot_base[MAX_OUTPUTS];
+static uint8_t output_slot_count[MAX_OUTPUTS];   // 0 = output not registered
+static uint8_t output_blend_row[MAX_OUTPUTS];    // row in blend_devices[]
+static uint8_t router_slots_used = 0;
+static uint8_t router_outputs_used = 0;
 
 // Router configuration (set at init)
 static router_config_t router_config;
@@ -248,11 +260,11 @@ static uint8_t active_output_count = 0;
 // TRANSFORMATION STATE (Phase 5)
 // ============================================================================
 
-// Mouse-to-analog accumulators (per output, per player)
-static mouse_accumulator_t mouse_accumulators[MAX_OUTPUTS][MAX_PLAYERS_PER_OUTPUT];
+// Mouse-to-analog accumulators (per player slot, same indexing as router_outputs)
+static mouse_accumulator_t mouse_accumulators[ROUTER_MAX_PLAYER_SLOTS];
 
-// Instance merging state (per output, per player)
-static instance_merge_t instance_merges[MAX_OUTPUTS][MAX_PLAYERS_PER_OUTPUT];
+// Instance merging state (per player slot)
+static instance_merge_t instance_merges[ROUTER_MAX_PLAYER_SLOTS];
 
 // ============================================================================
 // MERGE_BLEND STATE - Per-device input tracking for proper blending
@@ -269,8 +281,83 @@ typedef struct {
     input_event_t state;
 } blend_device_state_t;
 
-// Per-output blend state (tracks each device's contribution)
-static blend_device_state_t blend_devices[MAX_OUTPUTS][MAX_BLEND_DEVICES];
+// Per-output blend state (tracks each device's contribution), one row per
+// registered output
+static blend_device_state_t blend_devices[ROUTER_MAX_ACTIVE_OUTPUTS][MAX_BLEND_DEVICES];
+
+// Slot index for output+player, or -1 if the output isn't registered or the
+// player is beyond its allocated slots
+static inline int output_slot_index(output_target_t output, int player) {
+    if (output < 0 || output >= MAX_OUTPUTS) return -1;
+    if (player < 0 || player >= output_slot_count[output]) return -1;
+    return output_slot_base[output] + player;
+}
+
+static inline output_state_t* output_slot(output_target_t output, int player) {
+    int slot = output_slot_index(output, player);
+    return slot >= 0 ? &router_outputs[slot] : NULL;
+}
+
+// Blend row for an output (NULL if not registered)
+static inline blend_device_state_t* output_blend(output_target_t output) {
+    if (output < 0 || output >= MAX_OUTPUTS || !output_slot_count[output]) return NULL;
+    return blend_devices[output_blend_row[output]];
+}
+
+static void reset_blend_row(blend_device_state_t* row) {
+    for (uint8_t i = 0; i < MAX_BLEND_DEVICES; i++) {
+        row[i].active = false;
+        row[i].dev_addr = 0;
+        row[i].instance = -1;
+        init_input_event(&row[i].state);
+    }
+}
+
+// Allocate pool slots for an output. Outputs keep their first allocation;
+// a route to an output without max_players_per_output gets one slot so
+// MERGE mode (always player 0) still has somewhere to write.
+static bool router_register_output(output_target_t output, uint8_t players) {
+    if (output < 0 || output >= MAX_OUTPUTS) return false;
+    if (output_slot_count[output]) return true;
+
+    if (players == 0) players = 1;
+    if (players > MAX_PLAYERS_PER_OUTPUT) players = MAX_PLAYERS_PER_OUTPUT;
+
+    if (router_outputs_used >= ROUTER_MAX_ACTIVE_OUTPUTS ||
+        router_slots_used + players > ROUTER_MAX_PLAYER_SLOTS) {
+        printf(LOG_TAG "ERROR: No router state left for output %d (%d players)\n",
+               output, players);
+        return false;
+    }
+
+    output_slot_base[output] = router_slots_used;
+    output_slot_count[output] = players;
+    output_blend_row[output] = router_outputs_used;
+
+    for (uint8_t player = 0; player < players; player++) {
+        uint8_t slot = router_slots_used + player;
+        init_input_event(&router_outputs[slot].current_state);
+        router_outputs[slot].updated = false;
+        router_outputs[slot].player_id = player;
+        router_outputs[slot].source = INPUT_SOURCE_USB_HOST;  // Default
+
+        // Initialize transformation state
+        mouse_accumulators[slot].accum_x = 0;
+        mouse_accumulators[slot].accum_y = 0;
+        mouse_accumulators[slot].drain_rate = router_config.mouse_drain_rate;
+        mouse_accumulators[slot].target_x = router_config.mouse_target_x;
+        mouse_accumulators[slot].target_y = router_config.mouse_target_y;
+
+        instance_merges[slot].active = false;
+        instance_merges[slot].instance_count = 0;
+        instance_merges[slot].root_instance = 0;
+    }
+    reset_blend_row(blend_devices[router_outputs_used]);
+
+    router_slots_used += players;
+    router_outputs_used++;
+    return true;
+}
 
 // ============================================================================
 // ROUTING TABLE (Phase 6)
@@ -313,34 +400,19 @@ void router_init(const router_config_t* config) {
         printf(LOG_TAG "  Merge all inputs: %s\n", config->merge_all_inputs ? "YES" : "NO");
     }
 
-    // Initialize output states
+    // Allocate output state for the outputs this app actually uses
     for (uint8_t output = 0; output < MAX_OUTPUTS; output++) {
-        for (uint8_t player = 0; player < MAX_PLAYERS_PER_OUTPUT; player++) {
-            init_input_event(&router_outputs[output][player].current_state);
-            router_outputs[output][player].updated = false;
-            router_outputs[output][player].player_id = player;
-            router_outputs[output][player].source = INPUT_SOURCE_USB_HOST;  // Default
-
-            // Initialize transformation state
-            mouse_accumulators[output][player].accum_x = 0;
-            mouse_accumulators[output][player].accum_y = 0;
-            mouse_accumulators[output][player].drain_rate = config->mouse_drain_rate;
-            mouse_accumulators[output][player].target_x = config->mouse_target_x;
-            mouse_accumulators[output][player].target_y = config->mouse_target_y;
-
-            instance_merges[output][player].active = false;
-            instance_merges[output][player].instance_count = 0;
-            instance_merges[output][player].root_instance = 0;
-        }
-
-        // Initialize blend device tracking
-        for (uint8_t i = 0; i < MAX_BLEND_DEVICES; i++) {
-            blend_devices[output][i].active = false;
-            blend_devices[output][i].dev_addr = 0;
-            blend_devices[output][i].instance = -1;
-            init_input_event(&blend_devices[output][i].state);
+        output_slot_count[output] = 0;
+    }
+    router_slots_used = 0;
+    router_outputs_used = 0;
+    for (uint8_t output = 0; output < MAX_OUTPUTS; output++) {
+        if (config->max_players_per_output[output]) {
+            router_register_output((output_target_t)output, config->max_players_per_output[output]);
         }
     }
+    printf(LOG_TAG "  State: %d outputs, %d/%d player slots\n",
+           router_outputs_used, router_slots_used, ROUTER_MAX_PLAYER_SLOTS);
 
     // Initialize routing table
     router_clear_routes();
@@ -370,9 +442,10 @@ void router_init(const router_config_t* config) {
 // - drain_rate=0: hold position until input returns to center (no auto-drain)
 static void transform_mouse_to_analog(input_event_t* event, output_target_t output, int player_index) {
     if (event->type != INPUT_TYPE_MOUSE) return;
-    if (player_index < 0 || player_index >= MAX_PLAYERS_PER_OUTPUT) return;
+    int slot = output_slot_index(output, player_index);
+    if (slot < 0) return;
 
-    mouse_accumulator_t* accum = &mouse_accumulators[output][player_index];
+    mouse_accumulator_t* accum = &mouse_accumulators[slot];
 
     // Accumulate X-axis if enabled
     if (accum->target_x != MOUSE_AXIS_DISABLED) {
@@ -432,7 +505,7 @@ static void transform_mouse_to_analog(input_event_t* event, output_target_t outp
 // Instance merging: Merge multi-instance devices (Joy-Con Grip, etc.)
 // TODO Phase 5: Implement Joy-Con Grip merging
 static void transform_merge_instances(input_event_t* event, output_target_t output, int player_index) {
-    if (player_index < 0 || player_index >= MAX_PLAYERS_PER_OUTPUT) return;
+    if (output_slot_index(output, player_index) < 0) return;
 
     // TODO: Detect multi-instance devices (instance == -1 flag from device driver)
     // TODO: Merge button states and analog inputs from both instances
@@ -465,10 +538,18 @@ static void apply_transformations(input_event_t* event, output_target_t output,
 
 // Add simple route (input → output)
 bool router_add_route(input_source_t input, output_target_t output, uint8_t priority) {
+    if (output < 0 || output >= MAX_OUTPUTS) {
+        printf(LOG_TAG "ERROR: Invalid output %d\n", output);
+        return false;
+    }
     if (route_count >= MAX_ROUTES) {
         printf(LOG_TAG "ERROR: Routing table full (%d routes)\n", MAX_ROUTES);
         return false;
     }
+    if (!router_register_output(output, router_config.max_players_per_output[output])) {
+        printf(LOG_TAG "ERROR: Cannot route to output %d\n", output);
+        return false;
+    }
 
     routing_table[route_count].input = input;
     routing_table[route_count].output = output;
@@ -498,6 +579,14 @@ bool router_add_route_filtered(const route_entry_t* route) {
         printf(LOG_TAG "ERROR: Cannot add filtered route\n");
         return false;
     }
+    if (route->output < 0 || route->output >= MAX_OUTPUTS) {
+        printf(LOG_TAG "ERROR: Invalid output %d\n", route->output);
+        return false;
+    }
+    if (!router_register_output(route->output, router_config.max_players_per_output[route->output])) {
+        printf(LOG_TAG "ERROR: Cannot route to output %d\n", route->output);
+        return false;
+    }
 
     routing_table[route_count] = *route;
     routing_table[route_count].active = true;
@@ -619,10 +708,11 @@ static inline void router_simple_mode(const input_event_t* event, output_target_
         }
 
         // Store to output slot (skip when tap-exclusive — tap delivers directly)
-        if (!output_tap_exclusive[output]) {
-            router_outputs[output][player_index].current_state = *final_event;
-            router_outputs[output][player_index].updated = true;
-            router_outputs[output][player_index].source = INPUT_SOURCE_USB_HOST;
+        output_state_t* state = output_slot(output, player_index);
+        if (state && !output_tap_exclusive[output]) {
+            state->current_state = *final_event;
+            state->updated = true;
+            state->source = INPUT_SOURCE_USB_HOST;
         }
 
         // Notify tap if registered (for push-based outputs like UART)
@@ -655,6 +745,11 @@ static inline void router_merge_mode(const input_event_t* event, output_target_t
     // Only process if player is registered
     if (player_index < 0) return;
 
+    // All merged inputs land in player 0's slot
+    output_state_t* out = output_slot(output, 0);
+    blend_device_state_t* blend = output_blend(output);
+    if (!out) return;
+
     // Avoid struct copy when no transformations are active
     const input_event_t* final_event;
     input_event_t transformed;
@@ -670,7 +765,7 @@ static inline void router_merge_mode(const input_event_t* event, output_target_t
     switch (router_config.merge_mode) {
         case MERGE_ALL:
             // Latest active input wins (overwrites previous state)
-            router_outputs[output][0].current_state = *final_event;
+            out->current_state = *final_event;
             break;
 
         case MERGE_BLEND: {
@@ -681,9 +776,9 @@ static inline void router_merge_mode(const input_event_t* event, output_target_t
             // Find or create slot for this device
             int slot = -1;
             for (int i = 0; i < MAX_BLEND_DEVICES; i++) {
-                if (blend_devices[output][i].active &&
-                    blend_devices[output][i].dev_addr == final_event->dev_addr &&
-                    blend_devices[output][i].instance == final_event->instance) {
+                if (blend[i].active &&
+                    blend[i].dev_addr == final_event->dev_addr &&
+                    blend[i].instance == final_event->instance) {
                     slot = i;
                     break;
                 }
@@ -691,11 +786,11 @@ static inline void router_merge_mode(const input_event_t* event, output_target_t
             if (slot < 0) {
                 // Find empty slot
                 for (int i = 0; i < MAX_BLEND_DEVICES; i++) {
-                    if (!blend_devices[output][i].active) {
+                    if (!blend[i].active) {
                         slot = i;
-                        blend_devices[output][i].active = true;
-                        blend_devices[output][i].dev_addr = final_event->dev_addr;
-                        blend_devices[output][i].instance = final_event->instance;
+                        blend[i].active = true;
+                        blend[i].dev_addr = final_event->dev_addr;
+                        blend[i].instance = final_event->instance;
                         break;
                     }
                 }
@@ -703,10 +798,9 @@ static inline void router_merge_mode(const input_event_t* event, output_target_t
 
             if (slot >= 0) {
                 // Update this device's state
-                blend_devices[output][slot].state = *final_event;
+                blend[slot].state = *final_event;
 
                 // Now re-blend ALL active devices
-                output_state_t* out = &router_outputs[output][0];
 
                 // Start with neutral state (all buttons released)
                 // Note: deltas are cleared here but accumulated fresh from blend devices
@@ -716,9 +810,9 @@ static inline void router_merge_mode(const input_event_t* event, output_target_t
                 // Blend all active devices
                 bool first = true;
                 for (int i = 0; i < MAX_BLEND_DEVICES; i++) {
-                    if (!blend_devices[output][i].active) continue;
+                    if (!blend[i].active) continue;
 
-                    input_event_t* dev = &blend_devices[output][i].state;
+                    input_event_t* dev = &blend[i].state;
 
                     // Buttons: OR together (active-high, 1 = pressed)
                     x_current_state.buttons |= dev->buttons;
@@ -799,21 +893,21 @@ static inline void router_merge_mode(const input_event_t* event, output_target_t
             // High priority input wins, low priority fallback
             // Used by Super3D0USB (USB priority, SNES fallback)
             // Check if this source has higher priority than current
-            if (router_outputs[output][0].source <= INPUT_SOURCE_USB_HOST) {
+            if (out->source <= INPUT_SOURCE_USB_HOST) {
                 // USB has highest priority (0), always wins
-                router_outputs[output][0].current_state = *final_event;
+                out->current_state = *final_event;
             }
             // Lower priority sources only update if no USB input active
             // TODO: Track activity timeout for priority fallback
             break;
     }
 
-    router_outputs[output][0].updated = true;
-    router_outputs[output][0].source = INPUT_SOURCE_USB_HOST;
+    out->updated = true;
+    out->source = INPUT_SOURCE_USB_HOST;
 
     // Notify tap if registered (for push-based outputs like UART)
     if (output_taps[output]) {
-        output_taps[output](output, 0, &router_outputs[output][0].current_state);
+        output_taps[output](output, 0, &out->current_state);
     }
 }
 
@@ -830,8 +924,16 @@ uint32_t router_get_inject_buttons(void) {
     return s_inject_buttons;
 }
 
+// Events submitted since boot (main loop uses it for time-to-first-input)
+static uint32_t submit_count = 0;
+
+uint32_t router_get_submit_count(void) {
+    return submit_count;
+}
+
 void router_submit_input(const input_event_t* event) {
     if (!event) return;
+    submit_count++;
     if (route_count == 0) return;
 
     // Stream input to CDC for web config (only when a host is actively
@@ -1229,10 +1331,11 @@ void router_submit_input(const input_event_t* event) {
                                 final_event = event;
                             }
 
-                            if (!output_tap_exclusive[target]) {
-                                router_outputs[target][target_player].current_state = *final_event;
-                                router_outputs[target][target_player].updated = true;
-                                router_outputs[target][target_player].source = INPUT_SOURCE_USB_HOST;
+                            output_state_t* state = output_slot(target, target_player);
+                            if (state && !output_tap_exclusive[target]) {
+                                state->current_state = *final_event;
+                                state->updated = true;
+                                state->source = INPUT_SOURCE_USB_HOST;
                             }
 
                             if (output_taps[target]) {
@@ -1253,24 +1356,26 @@ void router_submit_input(const input_event_t* event) {
 // ============================================================================
 
 // Static buffer for returning copies (so we can clear original deltas)
-static input_event_t router_output_copy[MAX_OUTPUTS][MAX_PLAYERS_PER_OUTPUT];
+static input_event_t router_output_copy[ROUTER_MAX_PLAYER_SLOTS];
 
 const input_event_t* __not_in_flash_func(router_get_output)(output_target_t output, uint8_t player_id) {
-    if (output >= MAX_OUTPUTS || player_id >= MAX_PLAYERS_PER_OUTPUT) {
+    int slot = output_slot_index(output, player_id);
+    if (slot < 0) {
         return NULL;
     }
 
-    if (router_outputs[output][player_id].updated) {
-        router_outputs[output][player_id].updated = false;  // Mark as read
-        
+    output_state_t* state = &router_outputs[slot];
+    if (state->updated) {
+        state->updated = false;  // Mark as read
+
         // Copy to static buffer so caller gets the deltas
-        router_output_copy[output][player_id] = router_outputs[output][player_id].current_state;
-        
+        router_output_copy[slot] = state->current_state;
+
         // Clear deltas from original (they've been consumed)
-        router_outputs[output][player_id].current_state.delta_x = 0;
-        router_outputs[output][player_id].current_state.delta_y = 0;
-        
-        return &router_output_copy[output][player_id];
+        state->current_state.delta_x = 0;
+        state->current_state.delta_y = 0;
+
+        return &router_output_copy[slot];
     }
 
     // No update - return NULL (don't re-process same deltas)
@@ -1278,10 +1383,10 @@ const input_event_t* __not_in_flash_func(router_get_output)(output_target_t outp
 }
 
 bool router_has_updates(output_target_t output) {
-    if (output >= MAX_OUTPUTS) return false;
+    if (output < 0 || output >= MAX_OUTPUTS) return false;
 
-    for (uint8_t player = 0; player < MAX_PLAYERS_PER_OUTPUT; player++) {
-        if (router_outputs[output][player].updated) {
+    for (uint8_t player = 0; player < output_slot_count[output]; player++) {
+        if (router_outputs[output_slot_base[output] + player].updated) {
             return true;
         }
     }
@@ -1314,6 +1419,16 @@ void router_set_merge_mode(output_target_t output, merge_mode_t mode) {
 
 void router_set_active_outputs(output_target_t* outputs, uint8_t count) {
     if (!outputs || count > MAX_OUTPUTS) return;
+    for (uint8_t i = 0; i < count; i++) {
+        if (outputs[i] < 0 || outputs[i] >= MAX_OUTPUTS) {
+            printf(LOG_TAG "ERROR: Invalid output %d\n", outputs[i]);
+            return;
+        }
+        if (!router_register_output(outputs[i], router_config.max_players_per_output[outputs[i]])) {
+            printf(LOG_TAG "ERROR: Cannot route to output %d\n", outputs[i]);
+            return;
+        }
+    }
 
     active_output_count = count;
     for (uint8_t i = 0; i < count; i++) {
@@ -1366,8 +1481,7 @@ void router_set_tap_exclusive(output_target_t output, router_tap_callback_t call
 // ============================================================================
 
 output_state_t* router_get_state_ptr(output_target_t output) {
-    if (output >= MAX_OUTPUTS) return NULL;
-    return router_outputs[output];
+    return output_slot(output, 0);
 }
 
 // Reset all output states to neutral (call when all controllers disconnect)
@@ -1375,19 +1489,14 @@ void router_reset_outputs(void) {
     printf(LOG_TAG "Resetting all outputs to neutral\n");
 
     // Reset all output states
-    for (uint8_t output = 0; output < MAX_OUTPUTS; output++) {
-        for (uint8_t player = 0; player < MAX_PLAYERS_PER_OUTPUT; player++) {
-            init_input_event(&router_outputs[output][player].current_state);
-            router_outputs[output][player].updated = true;  // Signal that state changed
-        }
+    for (uint8_t slot = 0; slot < router_slots_used; slot++) {
+        init_input_event(&router_outputs[slot].current_state);
+        router_outputs[slot].updated = true;  // Signal that state changed
+    }
 
-        // Clear blend device tracking
-        for (uint8_t i = 0; i < MAX_BLEND_DEVICES; i++) {
-            blend_devices[output][i].active = false;
-            blend_devices[output][i].dev_addr = 0;
-            blend_devices[output][i].instance = -1;
-            init_input_event(&blend_devices[output][i].state);
-        }
+    // Clear blend device tracking
+    for (uint8_t row = 0; row < router_outputs_used; row++) {
+        reset_blend_row(blend_devices[row]);
     }
 }
 
@@ -1408,31 +1517,32 @@ void router_device_disconnected(uint8_t dev_addr, int8_t instance) {
     }
 
     // Clear blend device tracking for this device (MERGE_BLEND mode)
-    for (uint8_t out = 0; out < MAX_OUTPUTS; out++) {
+    for (uint8_t row = 0; row < router_outputs_used; row++) {
         for (uint8_t i = 0; i < MAX_BLEND_DEVICES; i++) {
-            if (blend_devices[out][i].active &&
-                blend_devices[out][i].dev_addr == dev_addr &&
-                blend_devices[out][i].instance == instance) {
-                blend_devices[out][i].active = false;
-                blend_devices[out][i].dev_addr = 0;
-                blend_devices[out][i].instance = -1;
-                init_input_event(&blend_devices[out][i].state);
-                printf(LOG_TAG "Cleared blend device slot %d for output %d\n", i, out);
+            if (blend_devices[row][i].active &&
+                blend_devices[row][i].dev_addr == dev_addr &&
+                blend_devices[row][i].instance == instance) {
+                blend_devices[row][i].active = false;
+                blend_devices[row][i].dev_addr = 0;
+                blend_devices[row][i].instance = -1;
+                init_input_event(&blend_devices[row][i].state);
+                printf(LOG_TAG "Cleared blend device slot %d for output row %d\n", i, row);
             }
         }
     }
 
     // For MERGE mode, all inputs go to player 0 - re-blend remaining devices
-    if (router_config.mode == ROUTING_MODE_MERGE) {
-        output_state_t* out_state = &router_outputs[output][0];
+    output_state_t* out_state = output_slot(output, 0);
+    if (router_config.mode == ROUTING_MODE_MERGE && out_state) {
+        blend_device_state_t* blend = output_blend(output);
         init_input_event(&out_state->current_state);
 
         if (router_config.merge_mode == MERGE_BLEND) {
             // Re-blend all remaining active devices
             for (uint8_t i = 0; i < MAX_BLEND_DEVICES; i++) {
-                if (!blend_devices[output][i].active) continue;
+                if (!blend[i].active) continue;
 
-                input_event_t* dev = &blend_devices[output][i].state;
+                input_event_t* dev = &blend[i].state;
 
                 // Buttons: OR together
                 out_state->current_state.buttons |= dev->buttons;
@@ -1472,15 +1582,16 @@ void router_device_disconnected(uint8_t dev_addr, int8_t instance) {
         }
 
         printf(LOG_TAG "Updated merged output (player 0)\n");
-    } else {
+    } else if (router_config.mode != ROUTING_MODE_MERGE) {
         // SIMPLE/BROADCAST mode: clear this player's specific output state
-        if (player_index >= 0 && player_index < MAX_PLAYERS_PER_OUTPUT) {
-            init_input_event(&router_outputs[output][player_index].current_state);
-            router_outputs[output][player_index].updated = true;
+        output_state_t* state = output_slot(output, player_index);
+        if (state) {
+            init_input_event(&state->current_state);
+            state->updated = true;
 
             // Notify tap if registered (sends zeroed state to USB/UART output)
             if (output_taps[output]) {
-                output_taps[output](output, player_index, &router_outputs[output][player_index].current_state);
+                output_taps[output](output, player_index, &state->current_state);
             }
 
             printf(LOG_TAG "Cleared output state for player %d\n", player_index);
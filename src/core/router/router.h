@@ -115,6 +115,17 @@ typedef struct {
 #define MAX_PLAYERS_PER_OUTPUT 8
 #endif
 
+// Router state is allocated only for outputs the app registers, sized by
+// their max_players_per_output. These bound the shared pools: total player
+// slots across all outputs, and how many distinct outputs may register.
+// Largest shipped configs are 3DO/UART (8 players) and dual USB+BLE outputs.
+#ifndef ROUTER_MAX_PLAYER_SLOTS
+#define ROUTER_MAX_PLAYER_SLOTS 12
+#endif
+#ifndef ROUTER_MAX_ACTIVE_OUTPUTS
+#define ROUTER_MAX_ACTIVE_OUTPUTS 3
+#endif
+
 typedef struct {
     routing_mode_t mode;
     merge_mode_t merge_mode;
@@ -144,6 +155,9 @@ void router_init(const router_config_t* config);
 // NOTE: This is the ONLY function input drivers should call!
 void router_submit_input(const input_event_t* event);
 
+// Number of events submitted since boot (any source, routed or not)
+uint32_t router_get_submit_count(void);
+
 // Host-side synthetic input "press overlay" — buttons set via INPUT.INJECT
 // are OR'd into every real input event as it passes through the router.
 // Works in any routing mode (SIMPLE, MERGE, BROADCAST). Pass 0 to release.
@@ -262,7 +276,7 @@ typedef void (*router_tap_callback_t)(output_target_t output, uint8_t player_ind
                                        const input_event_t* event);
 
 // Set tap callback for an output (NULL to disable)
-// Output still stores to router_outputs[] for polling via router_get_output()
+// Output still stores to its router state for polling via router_get_output()
 void router_set_tap(output_target_t output, router_tap_callback_t callback);
 
 // Set tap callback with exclusive mode — output is fully push-based,
@@ -283,6 +297,8 @@ typedef struct {
 } output_state_t;
 
 // Get pointer to output state array (for debugging/testing)
+// Returns NULL for outputs the app never registered; the array holds
+// max_players_per_output entries (1 for route-only outputs).
 output_state_t* router_get_state_ptr(output_target_t output);
 
 #endif // ROUTER_H
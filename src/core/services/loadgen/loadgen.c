@@ -0,0 +1,234 @@
+// loadgen.c - Synthetic Input Load Generator
+//
+// Virtual devices submit through router_submit_input() exactly like a real
+// driver, so everything downstream (player assignment, merge, profiles,
+// output taps) sees the same work it would with physical controllers.
+
+#include "loadgen.h"
+#include "core/router/router.h"
+#include "core/buttons.h"
+#include "core/services/players/manager.h"
+#include "platform/platform.h"
+#include <stdio.h>
+#include <string.h>
+
+// Buttons the generator may press. Excludes S1/S2, A1-A4 and F1/F2 so random
+// and mash patterns never fire router combos or hotkeys (profile cycling,
+// shoulder swap persisted to flash, etc.).
+#define LOADGEN_BUTTON_MASK (JP_BUTTON_B1 | JP_BUTTON_B2 | JP_BUTTON_B3 | JP_BUTTON_B4 | \
+                             JP_BUTTON_L1 | JP_BUTTON_R1 | JP_BUTTON_L2 | JP_BUTTON_R2 | \
+                             JP_BUTTON_L3 | JP_BUTTON_R3 | \
+                             JP_BUTTON_DU | JP_BUTTON_DD | JP_BUTTON_DL | JP_BUTTON_DR)
+
+#define LOADGEN_MAX_RATE_HZ 8000
+
+static loadgen_config_t config;
+static bool running = false;
+
+static uint32_t period_us;
+static uint32_t next_due_us;
+static uint32_t start_ms;
+static uint32_t tick;
+static uint32_t rng_state = 0x12345678;
+
+// Stats
+static uint32_t submitted;
+static uint32_t skipped;
+static uint32_t window_start_ms;
+static uint32_t window_submitted;
+static uint32_t submit_rate_hz;
+
+// Loop timing (measured between consecutive loadgen_task calls)
+static uint32_t last_loop_us;
+static uint32_t loop_sum_us;
+static uint32_t loop_samples;
+static uint32_t loop_avg_us;
+static uint32_t loop_max_us;
+
+static const char* pattern_names[LOADGEN_PATTERN_COUNT] = {
+    "random", "sweep", "mash"
+};
+
+const char* loadgen_pattern_name(loadgen_pattern_t pattern)
+{
+    return (pattern < LOADGEN_PATTERN_COUNT) ? pattern_names[pattern] : "unknown";
+}
+
+static uint32_t xorshift32(void)
+{
+    uint32_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rng_state = x;
+    return x;
+}
+
+static void fill_event(input_event_t* event, uint8_t device)
+{
+    init_input_event(event);
+    event->dev_addr = LOADGEN_DEV_ADDR_BASE + device;
+    event->instance = 0;
+    event->type = INPUT_TYPE_GAMEPAD;
+    event->transport = config.transport;
+
+    switch (config.pattern) {
+        case LOADGEN_PATTERN_RANDOM: {
+            event->buttons = xorshift32() & LOADGEN_BUTTON_MASK;
+            uint32_t r = xorshift32();
+            event->analog[ANALOG_LX] = r & 0xFF;
+            event->analog[ANALOG_LY] = (r >> 8) & 0xFF;
+            event->analog[ANALOG_RX] = (r >> 16) & 0xFF;
+            event->analog[ANALOG_RY] = (r >> 24) & 0xFF;
+            r = xorshift32();
+            event->analog[ANALOG_L2] = r & 0xFF;
+            event->analog[ANALOG_R2] = (r >> 8) & 0xFF;
+            break;
+        }
+
+        case LOADGEN_PATTERN_SWEEP: {
+            // Offset each device so merged outputs still change every tick
+            uint8_t v = (uint8_t)(tick + device * 32);
+            static const uint32_t dpad_cycle[4] = {
+                JP_BUTTON_DU, JP_BUTTON_DR, JP_BUTTON_DD, JP_BUTTON_DL
+            };
+            event->buttons = dpad_cycle[(tick >> 6) & 3];
+            event->analog[ANALOG_LX] = v;
+            event->analog[ANALOG_LY] = 255 - v;
+            event->analog[ANALOG_RX] = 255 - v;
+            event->analog[ANALOG_RY] = v;
+            event->analog[ANALOG_L2] = v;
+            event->analog[ANALOG_R2] = 255 - v;
+            break;
+        }
+
+        case LOADGEN_PATTERN_MASH:
+        default:
+            event->buttons = ((tick + device) & 1)
+                ? (JP_BUTTON_B1 | JP_BUTTON_B2 | JP_BUTTON_B3 | JP_BUTTON_B4)
+                : 0;
+            break;
+    }
+}
+
+static void submit_neutral(uint8_t device)
+{
+    input_event_t event;
+    init_input_event(&event);
+    event.dev_addr = LOADGEN_DEV_ADDR_BASE + device;
+    event.instance = 0;
+    event.type = INPUT_TYPE_GAMEPAD;
+    event.transport = config.transport;
+    router_submit_input(&event);
+}
+
+bool loadgen_start(const loadgen_config_t* cfg)
+{
+    if (!cfg || cfg->devices == 0 || cfg->devices > LOADGEN_MAX_DEVICES) return false;
+    if (cfg->rate_hz == 0 || cfg->rate_hz > LOADGEN_MAX_RATE_HZ) return false;
+    if (cfg->pattern >= LOADGEN_PATTERN_COUNT) return false;
+
+    if (running) loadgen_stop();
+
+    config = *cfg;
+    if (config.transport == INPUT_TRANSPORT_NONE) config.transport = INPUT_TRANSPORT_USB;
+    period_us = 1000000u / config.rate_hz;
+    next_due_us = platform_time_us();
+    start_ms = platform_time_ms();
+    tick = 0;
+
+    submitted = 0;
+    skipped = 0;
+    window_start_ms = start_ms;
+    window_submitted = 0;
+    submit_rate_hz = 0;
+    loop_sum_us = 0;
+    loop_samples = 0;
+    loop_avg_us = 0;
+    loop_max_us = 0;
+
+    running = true;
+    printf("[loadgen] Start: %u devices @ %u Hz, pattern=%s\n",
+           config.devices, config.rate_hz, loadgen_pattern_name(config.pattern));
+    return true;
+}
+
+void loadgen_stop(void)
+{
+    if (!running) return;
+    running = false;
+
+    // Release everything, then drop the virtual players
+    for (uint8_t d = 0; d < config.devices; d++) {
+        submit_neutral(d);
+        remove_players_by_address(LOADGEN_DEV_ADDR_BASE + d, 0);
+    }
+    printf("[loadgen] Stop: submitted=%lu skipped=%lu loop_max=%luus\n",
+           (unsigned long)submitted, (unsigned long)skipped, (unsigned long)loop_max_us);
+}
+
+void loadgen_task(void)
+{
+    uint32_t now_us = platform_time_us();
+    uint32_t loop_us = now_us - last_loop_us;
+    last_loop_us = now_us;
+
+    if (!running) return;
+
+    // Loop period (first sample after start spans the start call, skip it)
+    if (tick > 0 || submitted > 0) {
+        loop_sum_us += loop_us;
+        loop_samples++;
+        if (loop_us > loop_max_us) loop_max_us = loop_us;
+    }
+
+    if ((int32_t)(now_us - next_due_us) >= 0) {
+        // Reports whose slot already passed can't be sent late without
+        // distorting the rate: count them as skipped and send the current one.
+        uint32_t due = (now_us - next_due_us) / period_us + 1;
+        skipped += (due - 1) * config.devices;
+        next_due_us += due * period_us;
+
+        for (uint8_t d = 0; d < config.devices; d++) {
+            input_event_t event;
+            fill_event(&event, d);
+            router_submit_input(&event);
+        }
+        submitted += config.devices;
+        window_submitted += config.devices;
+        tick++;
+    }
+
+    uint32_t now_ms = platform_time_ms();
+    uint32_t elapsed = now_ms - window_start_ms;
+    if (elapsed >= 1000) {
+        submit_rate_hz = (uint32_t)(((uint64_t)window_submitted * 1000) / elapsed);
+        loop_avg_us = loop_samples ? loop_sum_us / loop_samples : 0;
+        window_submitted = 0;
+        loop_sum_us = 0;
+        loop_samples = 0;
+        window_start_ms = now_ms;
+    }
+}
+
+bool loadgen_is_running(void)
+{
+    return running;
+}
+
+void loadgen_get_config(loadgen_config_t* cfg)
+{
+    if (cfg) *cfg = config;
+}
+
+void loadgen_get_stats(loadgen_stats_t* stats)
+{
+    if (!stats) return;
+    stats->running = running;
+    stats->elapsed_ms = running ? platform_time_ms() - start_ms : 0;
+    stats->submitted = submitted;
+    stats->skipped = skipped;
+    stats->submit_rate_hz = submit_rate_hz;
+    stats->loop_avg_us = loop_avg_us;
+    stats->loop_max_us = loop_max_us;
+}
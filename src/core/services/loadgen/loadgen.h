@@ -0,0 +1,61 @@
+// loadgen.h - Synthetic Input Load Generator
+//
+// Drives the router with N virtual controllers at a fixed report rate so
+// throughput, drops and main-loop cost can be measured on real hardware
+// without physical controllers. Idle unless started (CDC LOADGEN.START).
+
+#ifndef LOADGEN_H
+#define LOADGEN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "core/input_event.h"
+
+// Maximum virtual devices
+#ifndef LOADGEN_MAX_DEVICES
+#define LOADGEN_MAX_DEVICES 8
+#endif
+
+// Virtual device addresses: 0xB0..0xB7, a range no real input uses (dev_addr.h)
+#define LOADGEN_DEV_ADDR_BASE DEV_ADDR_LOADGEN_BASE
+
+typedef enum {
+    LOADGEN_PATTERN_RANDOM = 0,  // Random buttons + sticks every report
+    LOADGEN_PATTERN_SWEEP,       // Sticks/triggers ramp, d-pad rotates
+    LOADGEN_PATTERN_MASH,        // Face buttons toggle every report
+    LOADGEN_PATTERN_COUNT
+} loadgen_pattern_t;
+
+typedef struct {
+    uint8_t devices;             // 1..LOADGEN_MAX_DEVICES
+    uint16_t rate_hz;            // Reports per second per device
+    loadgen_pattern_t pattern;
+    input_transport_t transport; // Reported transport of the virtual devices
+} loadgen_config_t;
+
+typedef struct {
+    bool running;
+    uint32_t elapsed_ms;         // Time since start
+    uint32_t submitted;          // Events handed to the router
+    uint32_t skipped;            // Scheduled reports skipped because the loop fell behind
+    uint32_t submit_rate_hz;     // Events/s over the last 1s window (all devices)
+    uint32_t loop_avg_us;        // Main loop period, last window average
+    uint32_t loop_max_us;        // Main loop period, worst since start
+} loadgen_stats_t;
+
+// Start generating (replaces any running session). Returns false on bad config.
+bool loadgen_start(const loadgen_config_t* config);
+
+// Stop generating; neutral reports are sent and virtual players removed
+void loadgen_stop(void);
+
+// Call once per main loop iteration (measures loop time even when idle)
+void loadgen_task(void);
+
+bool loadgen_is_running(void);
+void loadgen_get_config(loadgen_config_t* config);
+void loadgen_get_stats(loadgen_stats_t* stats);
+
+const char* loadgen_pattern_name(loadgen_pattern_t pattern);
+
+#endif // LOADGEN_H
@@ -0,0 +1,106 @@
+// imu.c - Per-player IMU sample ring
+
+#include "imu.h"
+#include "core/services/players/manager.h"
+#include "platform/platform.h"
+
+#define IMU_RING_MASK (IMU_RING_SIZE - 1)
+
+typedef struct {
+    int dev_addr;              // Owner; a reassigned player slot resets the ring
+    int instance;
+    uint8_t head;              // Next write
+    uint8_t tail;              // Next read
+    uint32_t last_push_us;
+    imu_sample_t samples[IMU_RING_SIZE];
+} imu_ring_t;
+
+static imu_ring_t rings[MAX_PLAYERS];
+static uint32_t overruns;
+
+static int16_t imu_rescale(int16_t value, uint16_t from_range, uint16_t to_range)
+{
+    if (from_range == to_range || from_range == 0) return value;
+    int32_t v = ((int32_t)value * from_range) / to_range;
+    if (v > INT16_MAX) return INT16_MAX;
+    if (v < INT16_MIN) return INT16_MIN;
+    return (int16_t)v;
+}
+
+// Ring for dev_addr/instance, or NULL if the device has no player
+static imu_ring_t* imu_ring_for(int dev_addr, int instance)
+{
+    int player = find_player_index(dev_addr, instance);
+    if (player < 0 || player >= MAX_PLAYERS) return NULL;
+    return &rings[player];
+}
+
+void imu_push(int dev_addr, int instance,
+              const int16_t accel[3], const int16_t gyro[3],
+              uint16_t accel_range, uint16_t gyro_range,
+              uint32_t timestamp_us)
+{
+    imu_ring_t* ring = imu_ring_for(dev_addr, instance);
+    if (!ring) return;
+
+    if (ring->dev_addr != dev_addr || ring->instance != instance) {
+        ring->dev_addr = dev_addr;
+        ring->instance = instance;
+        ring->head = ring->tail = 0;
+    }
+
+    imu_sample_t* s = &ring->samples[ring->head & IMU_RING_MASK];
+    s->timestamp_us = timestamp_us;
+    for (int i = 0; i < 3; i++) {
+        s->accel[i] = imu_rescale(accel[i], accel_range, IMU_ACCEL_RANGE);
+        s->gyro[i] = imu_rescale(gyro[i], gyro_range, IMU_GYRO_RANGE);
+    }
+
+    ring->head++;
+    if ((uint8_t)(ring->head - ring->tail) > IMU_RING_SIZE) {
+        ring->tail++;
+        overruns++;
+    }
+    ring->last_push_us = platform_time_us();
+}
+
+static imu_ring_t* imu_owned_ring(int dev_addr, int instance)
+{
+    imu_ring_t* ring = imu_ring_for(dev_addr, instance);
+    if (!ring || ring->dev_addr != dev_addr || ring->instance != instance) return NULL;
+    return ring;
+}
+
+bool imu_pop(int dev_addr, int instance, imu_sample_t* sample)
+{
+    imu_ring_t* ring = imu_owned_ring(dev_addr, instance);
+    if (!ring) return false;
+
+    uint32_t now = platform_time_us();
+    while (ring->tail != ring->head) {
+        const imu_sample_t* s = &ring->samples[ring->tail & IMU_RING_MASK];
+        ring->tail++;
+        if (now - s->timestamp_us <= IMU_SAMPLE_MAX_AGE_US) {
+            *sample = *s;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool imu_pending(int dev_addr, int instance)
+{
+    imu_ring_t* ring = imu_owned_ring(dev_addr, instance);
+    return ring && ring->tail != ring->head;
+}
+
+bool imu_streaming(int dev_addr, int instance)
+{
+    imu_ring_t* ring = imu_owned_ring(dev_addr, instance);
+    return ring && (platform_time_us() - ring->last_push_us) <= IMU_SAMPLE_MAX_AGE_US;
+}
+
+uint32_t imu_get_overruns(void)
+{
+    return overruns;
+}
@@ -0,0 +1,63 @@
+// imu.h - Per-player IMU sample ring
+//
+// input_event_t carries one accel/gyro sample, so controllers that pack
+// several IMU frames per report (Switch Pro 0x30: three 5 ms frames) lose
+// most of them once events are coalesced to the report rate. Drivers push
+// every frame here with its capture time; motion-consuming outputs (SInput,
+// PS4) drain one sample per report so gyro aiming keeps the sensor's native
+// temporal resolution.
+//
+// Samples are stored in the DS4/DS5 scale (±4 g, ±2000 dps full-scale int16)
+// so consumers can copy them straight into their reports. Drivers and
+// outputs both run on core0, so no locking is needed.
+
+#ifndef IMU_H
+#define IMU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Samples per player (power of 2). 16 covers 80 ms of 200 Hz data.
+#ifndef IMU_RING_SIZE
+#define IMU_RING_SIZE 16
+#endif
+
+// Samples older than this are dropped instead of being delivered late
+#ifndef IMU_SAMPLE_MAX_AGE_US
+#define IMU_SAMPLE_MAX_AGE_US 50000
+#endif
+
+// Scale of stored samples (same units as input_event_t accel_range/gyro_range)
+#define IMU_ACCEL_RANGE 4000   // milli-g
+#define IMU_GYRO_RANGE  2000   // dps
+
+typedef struct {
+    uint32_t timestamp_us;     // Capture time (platform_time_us base)
+    int16_t accel[3];          // X, Y, Z at IMU_ACCEL_RANGE
+    int16_t gyro[3];           // X, Y, Z at IMU_GYRO_RANGE
+} imu_sample_t;
+
+// Push one sample for the player owning dev_addr/instance. accel_range and
+// gyro_range describe the driver's raw scale; samples are rescaled (with
+// saturation) to IMU_ACCEL_RANGE/IMU_GYRO_RANGE. Dropped if the device has
+// no player yet. The oldest sample is overwritten when the ring is full.
+void imu_push(int dev_addr, int instance,
+              const int16_t accel[3], const int16_t gyro[3],
+              uint16_t accel_range, uint16_t gyro_range,
+              uint32_t timestamp_us);
+
+// Pop the oldest fresh sample for dev_addr/instance. Returns false if empty.
+bool imu_pop(int dev_addr, int instance, imu_sample_t* sample);
+
+// True if samples are waiting for dev_addr/instance
+bool imu_pending(int dev_addr, int instance);
+
+// True if dev_addr/instance has pushed a sample recently. Outputs use this to
+// tell ring-fed devices (keep the last delivered sample when the ring runs
+// dry) from single-sample devices (use the event's accel/gyro).
+bool imu_streaming(int dev_addr, int instance);
+
+// Samples overwritten before an output drained them (all players, since boot)
+uint32_t imu_get_overruns(void);
+
+#endif // IMU_H
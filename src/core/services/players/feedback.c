@@ -7,6 +7,7 @@
 #include "core/services/players/feedback.h"
 #include "core/services/players/manager.h"
 #include "core/services/profiles/profile_indicator.h"
+#include "platform/platform.h"
 #include <string.h>
 
 // ============================================================================
@@ -224,3 +225,64 @@ void feedback_clear_dirty(uint8_t player_index)
     feedback_states[player_index].led_dirty = false;
     feedback_states[player_index].triggers_dirty = false;
 }
+
+// ============================================================================
+// CONSOLE RUMBLE MAILBOX
+// ============================================================================
+// One word per port: sequence in the upper 16 bits, right << 8 | left below.
+// A single aligned 32-bit store publishes value and sequence together, so the
+// reader never needs a lock or retry. Each port has a single writer.
+
+static volatile uint32_t console_mailbox[FEEDBACK_CONSOLE_PORTS];
+static uint32_t console_seen[FEEDBACK_CONSOLE_PORTS];      // Core 0 only
+static uint8_t console_fanout_players;                     // Core 0 only
+
+void __not_in_flash_func(feedback_console_post)(uint8_t port, uint8_t left, uint8_t right)
+{
+    if (port >= FEEDBACK_CONSOLE_PORTS) return;
+
+    uint32_t word = console_mailbox[port];
+    uint32_t value = ((uint32_t)right << 8) | left;
+    if ((word & 0xFFFF) == value) return;
+
+    console_mailbox[port] = ((word + 0x10000) & 0xFFFF0000) | value;
+}
+
+bool feedback_console_take(uint8_t port, uint8_t* left, uint8_t* right)
+{
+    if (port >= FEEDBACK_CONSOLE_PORTS) return false;
+
+    uint32_t word = console_mailbox[port];
+    if (word == console_seen[port]) return false;
+    console_seen[port] = word;
+
+    if (left) *left = word & 0xFF;
+    if (right) *right = (word >> 8) & 0xFF;
+    return true;
+}
+
+void feedback_console_task(bool merged)
+{
+    uint8_t left, right;
+
+    if (merged) {
+        bool changed = feedback_console_take(0, &left, &right);
+        if (!changed) {
+            if (console_fanout_players == playersCount) return;
+            // New or removed players: bring them in line with the console
+            left = console_seen[0] & 0xFF;
+            right = (console_seen[0] >> 8) & 0xFF;
+        }
+        console_fanout_players = playersCount;
+        for (int i = 0; i < playersCount; i++) {
+            feedback_set_rumble(i, left, right);
+        }
+        return;
+    }
+
+    for (uint8_t port = 0; port < FEEDBACK_CONSOLE_PORTS && port < MAX_PLAYERS; port++) {
+        if (feedback_console_take(port, &left, &right)) {
+            feedback_set_rumble(port, left, right);
+        }
+    }
+}
@@ -126,6 +126,28 @@ void feedback_clear(uint8_t player_index);
 // Clear dirty flags after device has applied feedback
 void feedback_clear_dirty(uint8_t player_index);
 
+// ============================================================================
+// CONSOLE RUMBLE MAILBOX
+// ============================================================================
+// Console output drivers learn rumble state on whichever core runs the
+// console protocol (core 1 on RP2040). They post per-port values here; core 0
+// only does work for ports whose value actually changed.
+
+#define FEEDBACK_CONSOLE_PORTS 4
+
+// Post rumble for a console port (any core, RAM-resident). No-op if unchanged.
+// Not atomic: all posts for one port must come from the same core.
+void feedback_console_post(uint8_t port, uint8_t left, uint8_t right);
+
+// Take a pending change for a port. Returns true once per posted change.
+bool feedback_console_take(uint8_t port, uint8_t* left, uint8_t* right);
+
+// Core 0: deliver pending changes to the players mapped to each port.
+// merged: all players feed port 0 (ROUTING_MODE_MERGE), so port 0 fans out
+// to every player (re-sent when the player count changes). Otherwise port N
+// goes to player N.
+void feedback_console_task(bool merged);
+
 // ============================================================================
 // DEVICE CAPABILITY FLAGS
 // ============================================================================
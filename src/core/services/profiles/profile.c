@@ -274,10 +274,9 @@ static void profile_apply_unified_index(output_target_t output,
 {
     // Use the DEFERRED variant of flash_set_active_profile_index. The
     // SELECT+D-pad cycle hotkey can fire many times in quick succession;
-    // the immediate (flash_save_now) variant blocks ~50 ms with interrupts
-    // disabled which stalls USB host polling and console-output PIO
-    // callbacks long enough to hang the firmware on usb2gc / usb2pce /
-    // etc. Debounced save commits ~5 s after the last cycle event.
+    // the immediate (flash_save_now) variant would burn a journal slot per
+    // press and bring the next sector erase closer. Debounced save commits
+    // ~5 s after the last cycle event.
     if (unified_index < builtin_count) {
         // Built-in profile — clear any custom override so the built-in
         // actually takes effect.
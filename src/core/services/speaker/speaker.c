@@ -6,6 +6,8 @@
 #include "hardware/pwm.h"
 #include "hardware/gpio.h"
 #include "hardware/clocks.h"
+#include "hardware/sync.h"
+#include "pico/time.h"
 #include <stdio.h>
 
 // ============================================================================
@@ -18,6 +20,130 @@ static int8_t enable_pin = -1;
 static uint pwm_slice = 0;
 static uint pwm_channel = 0;
 
+// Melody queue (filled by speaker_play, drained by the note alarm)
+static speaker_note_t queue[SPEAKER_QUEUE_SIZE];
+static volatile uint8_t queue_head = 0;
+static volatile uint8_t queue_tail = 0;
+static volatile bool playing = false;
+static alarm_id_t note_alarm = 0;
+
+// Rumble requested while a melody holds the speaker
+static volatile uint8_t rumble_intensity = 0;
+static int16_t rumble_applied = -1;     // -1 = speaker output not from rumble
+
+// ============================================================================
+// PWM OUTPUT
+// ============================================================================
+
+static void output_tone(uint16_t frequency, uint8_t volume)
+{
+    // Enable speaker
+    if (enable_pin >= 0) {
+        gpio_put(enable_pin, 1);
+    }
+
+    // Calculate PWM settings for desired frequency
+    // PWM frequency = clock / (wrap + 1)
+    uint32_t clock = clock_get_hz(clk_sys);
+    uint32_t divider = 1;
+    uint32_t wrap = clock / frequency;
+
+    // Use clock divider if wrap would be too large
+    while (wrap > 65535 && divider < 256) {
+        divider++;
+        wrap = clock / (frequency * divider);
+    }
+
+    if (wrap > 65535) wrap = 65535;
+    if (wrap < 1) wrap = 1;
+
+    // Set PWM frequency
+    pwm_set_clkdiv(pwm_slice, (float)divider);
+    pwm_set_wrap(pwm_slice, wrap);
+
+    // Set duty cycle based on volume (50% max for square wave)
+    uint32_t level = (wrap * volume) / 512;  // volume/255 * wrap/2
+    pwm_set_chan_level(pwm_slice, pwm_channel, level);
+}
+
+static void output_silence(void)
+{
+    // Disable speaker
+    if (enable_pin >= 0) {
+        gpio_put(enable_pin, 0);
+    }
+
+    // Set PWM level to 0
+    pwm_set_chan_level(pwm_slice, pwm_channel, 0);
+}
+
+// Volume scaling (0-100, where 100 = full volume)
+#define SPEAKER_VOLUME_PERCENT 25
+
+static void output_rumble(uint8_t intensity)
+{
+    if (rumble_applied == intensity) return;
+    rumble_applied = intensity;
+
+    if (intensity == 0) {
+        output_silence();
+        return;
+    }
+
+    // Map rumble intensity to frequency and volume
+    // Lower rumble = lower frequency (more bass-like buzz)
+    // Frequency range: 100Hz (low rumble) to 400Hz (high rumble)
+    uint16_t frequency = 100 + (intensity * 300 / 255);
+
+    // Volume proportional to intensity, scaled down
+    uint8_t volume = (intensity * SPEAKER_VOLUME_PERCENT) / 100;
+
+    output_tone(frequency, volume);
+}
+
+// ============================================================================
+// NOTE SEQUENCER
+// ============================================================================
+
+// Alarm IRQ: start the next note and reschedule for its end. Negative return
+// reschedules relative to the previous fire time, so notes don't drift.
+static int64_t note_alarm_cb(alarm_id_t id, void* user_data)
+{
+    (void)id;
+    (void)user_data;
+
+    if (queue_tail == queue_head) {
+        // Melody done, hand the speaker back to rumble
+        playing = false;
+        note_alarm = 0;
+        rumble_applied = -1;
+        output_rumble(rumble_intensity);
+        return 0;
+    }
+
+    speaker_note_t note = queue[queue_tail];
+    queue_tail = (queue_tail + 1) % SPEAKER_QUEUE_SIZE;
+
+    if (note.frequency) {
+        output_tone(note.frequency, note.volume);
+    } else {
+        output_silence();
+    }
+
+    uint32_t duration_ms = note.duration_ms ? note.duration_ms : 1;
+    return -(int64_t)duration_ms * 1000;
+}
+
+static void sequencer_cancel(void)
+{
+    if (note_alarm > 0) {
+        cancel_alarm(note_alarm);
+        note_alarm = 0;
+    }
+    playing = false;
+    queue_head = queue_tail = 0;
+}
+
 // ============================================================================
 // IMPLEMENTATION
 // ============================================================================
@@ -57,69 +183,72 @@ void speaker_tone(uint16_t frequency, uint8_t volume)
         return;
     }
 
-    // Enable speaker
-    if (enable_pin >= 0) {
-        gpio_put(enable_pin, 1);
-    }
+    sequencer_cancel();
+    rumble_applied = -1;
+    output_tone(frequency, volume);
+}
 
-    // Calculate PWM settings for desired frequency
-    // PWM frequency = clock / (wrap + 1)
-    uint32_t clock = clock_get_hz(clk_sys);
-    uint32_t divider = 1;
-    uint32_t wrap = clock / frequency;
+bool speaker_play(const speaker_note_t* notes, uint8_t count)
+{
+    if (!initialized || !notes || count == 0) return false;
 
-    // Use clock divider if wrap would be too large
-    while (wrap > 65535 && divider < 256) {
-        divider++;
-        wrap = clock / (frequency * divider);
+    // Alarm IRQ runs on this core, so masking it keeps the queue consistent
+    uint32_t ints = save_and_disable_interrupts();
+
+    uint8_t used = (queue_head - queue_tail + SPEAKER_QUEUE_SIZE) % SPEAKER_QUEUE_SIZE;
+    if (used + count > SPEAKER_QUEUE_SIZE - 1) {
+        restore_interrupts(ints);
+        printf("[speaker] Queue full, dropping %d notes\n", count);
+        return false;
     }
 
-    if (wrap > 65535) wrap = 65535;
-    if (wrap < 1) wrap = 1;
+    for (uint8_t i = 0; i < count; i++) {
+        queue[queue_head] = notes[i];
+        queue_head = (queue_head + 1) % SPEAKER_QUEUE_SIZE;
+    }
 
-    // Set PWM frequency
-    pwm_set_clkdiv(pwm_slice, (float)divider);
-    pwm_set_wrap(pwm_slice, wrap);
+    bool start = !playing;
+    playing = true;
+    restore_interrupts(ints);
 
-    // Set duty cycle based on volume (50% max for square wave)
-    uint32_t level = (wrap * volume) / 512;  // volume/255 * wrap/2
-    pwm_set_chan_level(pwm_slice, pwm_channel, level);
+    if (start) {
+        note_alarm = add_alarm_in_us(1, note_alarm_cb, NULL, true);
+        if (note_alarm < 0) {
+            sequencer_cancel();
+            return false;
+        }
+    }
+    return true;
 }
 
-// Volume scaling (0-100, where 100 = full volume)
-#define SPEAKER_VOLUME_PERCENT 25
+bool speaker_is_playing(void)
+{
+    return playing;
+}
 
 void speaker_set_rumble(uint8_t intensity)
 {
     if (!initialized) return;
 
-    if (intensity == 0) {
-        speaker_stop();
-        return;
+    // Called every loop: only touches the PWM when the intensity changes,
+    // and waits for a playing melody to finish. The alarm IRQ that ends a
+    // melody also writes playing and rumble_applied, so mask it here.
+    uint32_t ints = save_and_disable_interrupts();
+    rumble_intensity = intensity;
+    if (!playing) {
+        output_rumble(intensity);
     }
-
-    // Map rumble intensity to frequency and volume
-    // Lower rumble = lower frequency (more bass-like buzz)
-    // Frequency range: 100Hz (low rumble) to 400Hz (high rumble)
-    uint16_t frequency = 100 + (intensity * 300 / 255);
-
-    // Volume proportional to intensity, scaled down
-    uint8_t volume = (intensity * SPEAKER_VOLUME_PERCENT) / 100;
-
-    speaker_tone(frequency, volume);
+    restore_interrupts(ints);
 }
 
 void speaker_stop(void)
 {
     if (!initialized) return;
 
-    // Disable speaker
-    if (enable_pin >= 0) {
-        gpio_put(enable_pin, 0);
-    }
-
-    // Set PWM level to 0
-    pwm_set_chan_level(pwm_slice, pwm_channel, 0);
+    sequencer_cancel();
+    rumble_intensity = 0;
+    rumble_applied = 0;
+    output_silence();
 }
 
 bool speaker_is_initialized(void)
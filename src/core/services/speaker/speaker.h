@@ -4,6 +4,10 @@
 //
 // Simple PWM-based speaker driver for haptic feedback via buzzer.
 // Used on MacroPad RP2040 (speaker on GPIO 16, shutdown on GPIO 14).
+//
+// Melodies are queued with speaker_play() and stepped from a hardware alarm,
+// so the caller never waits on them. Rumble is held off while a melody plays
+// and picks up again at its last requested intensity when the queue empties.
 
 #ifndef SPEAKER_H
 #define SPEAKER_H
@@ -11,6 +15,17 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// Max notes waiting to play
+#ifndef SPEAKER_QUEUE_SIZE
+#define SPEAKER_QUEUE_SIZE 16
+#endif
+
+typedef struct {
+    uint16_t frequency;     // Hz, 0 = rest
+    uint8_t volume;         // 0-255
+    uint16_t duration_ms;
+} speaker_note_t;
+
 // Initialize speaker with GPIO pins
 // speaker_pin: PWM output pin (e.g., GPIO 16)
 // shutdown_pin: Speaker enable pin (e.g., GPIO 14), or -1 if not used
@@ -21,9 +36,17 @@ void speaker_init(uint8_t speaker_pin, int8_t shutdown_pin);
 void speaker_set_rumble(uint8_t intensity);
 
 // Play a tone at specified frequency (Hz) and volume (0-255)
+// Cancels any queued melody
 void speaker_tone(uint16_t frequency, uint8_t volume);
 
-// Stop speaker output
+// Queue notes behind anything already playing and return immediately
+// Returns false if the queue can't hold all of them (nothing is queued)
+bool speaker_play(const speaker_note_t* notes, uint8_t count);
+
+// True while queued notes are playing
+bool speaker_is_playing(void);
+
+// Stop speaker output (drops queued notes and rumble)
 void speaker_stop(void);
 
 // Check if speaker is initialized
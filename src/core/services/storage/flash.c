@@ -6,14 +6,15 @@
 // - When one sector fills, erase the OTHER sector and continue there
 // - This allows sector erases while valid data remains readable
 // - No need to defer erases for BT - always safe to erase inactive sector
+//
+// Writes are queued on the flash scheduler (flash_sched.c), which runs them
+// between console polls. A save issued while the previous one is still
+// queued reuses its slot instead of consuming another.
 
 #include "core/services/storage/flash.h"
+#include "core/services/storage/flash_sched.h"
 #include "pico/stdlib.h"
 #include "hardware/flash.h"
-#include "hardware/sync.h"
-#include "pico/multicore.h"
-#include "pico/flash.h"
-#include "tusb.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -21,18 +22,6 @@
 // Note: With dual-sector design, we no longer need to defer erases for BT
 __attribute__((weak)) uint8_t btstack_classic_get_connection_count(void) { return 0; }
 
-// Helper to flush debug output before critical sections
-static void flush_output(void)
-{
-#if CFG_TUD_ENABLED
-    tud_task();
-    sleep_ms(20);
-    tud_task();
-#else
-    sleep_ms(20);
-#endif
-}
-
 // Flash memory layout
 // - RP2040/RP2350 flash is memory-mapped at XIP_BASE (0x10000000)
 // - BTstack uses 8KB (2 sectors) for Bluetooth bond storage
@@ -73,6 +62,10 @@ static absolute_time_t last_change_time;
 static flash_t pending_settings;
 static uint32_t current_sequence = 0;  // Current sequence number
 
+// Record handed to the flash scheduler but not yet programmed (-1 = none)
+static int queued_slot = -1;
+static flash_t queued_settings;
+
 // Runtime settings (loaded on init, updated on save)
 static flash_t runtime_settings;
 static bool runtime_settings_loaded = false;
@@ -185,6 +178,17 @@ static uint8_t get_slot_sector(uint8_t slot_index)
     return (slot_index < SLOTS_PER_SECTOR) ? 0 : 1;
 }
 
+// True while the last queued record hasn't reached flash yet
+static bool has_queued_record(void)
+{
+    if (queued_slot < 0) return false;
+    if (!flash_sched_is_queued(get_slot_offset(queued_slot))) {
+        queued_slot = -1;
+        return false;
+    }
+    return true;
+}
+
 void flash_init(void)
 {
     // Idempotent: safe to call from early detection paths AND later setup.
@@ -225,6 +229,12 @@ void flash_init(void)
 // advanced past the stale record so the next write supersedes it.
 bool flash_load(flash_t* settings)
 {
+    // A save still waiting on the scheduler is newer than anything in flash
+    if (has_queued_record()) {
+        memcpy(settings, &queued_settings, sizeof(flash_t));
+        return true;
+    }
+
     int newest = find_newest_slot();
 
     if (newest < 0) {
@@ -260,153 +270,91 @@ void flash_save(const flash_t* settings)
     last_change_time = get_absolute_time();
 }
 
-// Page program worker - only programs one page, no erase (~1ms)
-// This is safe during BT as it only takes ~1ms
-typedef struct {
-    uint32_t offset;
-    const uint8_t* data;
-} page_program_params_t;
-
-static void __no_inline_not_in_flash_func(page_program_worker)(void* param)
-{
-    page_program_params_t* p = (page_program_params_t*)param;
-    flash_range_program(p->offset, p->data, FLASH_PAGE_SIZE);
-}
-
-// Sector erase worker - erases entire sector (~45ms)
-// With dual-sector design, we always erase the inactive sector, so this is safe
-typedef struct {
-    uint32_t offset;
-} sector_erase_params_t;
-
-static void __no_inline_not_in_flash_func(sector_erase_worker)(void* param)
-{
-    sector_erase_params_t* p = (sector_erase_params_t*)param;
-    flash_range_erase(p->offset, FLASH_SECTOR_SIZE);
-}
-
-// Write a single page to flash (BT-safe, ~1ms)
-static bool flash_write_page(uint8_t slot_index, const flash_t* settings)
-{
-    static flash_t write_buffer;  // Static to persist during flash ops
-    memcpy(&write_buffer, settings, sizeof(flash_t));
-
-    uint32_t offset = get_slot_offset(slot_index);
-
-    page_program_params_t params = {
-        .offset = offset,
-        .data = (const uint8_t*)&write_buffer
-    };
-
-    // Try flash_safe_execute first
-    int result = flash_safe_execute(page_program_worker, &params, UINT32_MAX);
-
-    if (result != PICO_OK) {
-        // Fallback: direct write with interrupts disabled briefly
-        uint32_t ints = save_and_disable_interrupts();
-        flash_range_program(offset, (const uint8_t*)&write_buffer, FLASH_PAGE_SIZE);
-        restore_interrupts(ints);
-    }
-
-    return true;
-}
-
-// Erase a specific sector (0 = A, 1 = B)
-// Safe to call anytime - we only erase the sector without valid data
-static void flash_erase_sector(uint8_t sector)
+// Scheduler queue full while the console is polling: keep the record
+// pending and try again after another debounce period
+static void flash_save_retry(const flash_t* settings)
 {
-    uint32_t offset = (sector == 0) ? FLASH_SECTOR_A_OFFSET : FLASH_SECTOR_B_OFFSET;
-    printf("[flash] Erasing sector %c at offset 0x%lX...\n",
-           (sector == 0) ? 'A' : 'B', (unsigned long)offset);
-    flush_output();
-
-    sector_erase_params_t params = { .offset = offset };
-
-    // Try flash_safe_execute first
-    int result = flash_safe_execute(sector_erase_worker, &params, UINT32_MAX);
-
-    if (result != PICO_OK) {
-        printf("[flash] flash_safe_execute failed (%d), trying direct erase...\n", result);
-        flush_output();
-
-        uint32_t ints = save_and_disable_interrupts();
-        flash_range_erase(offset, FLASH_SECTOR_SIZE);
-        restore_interrupts(ints);
+    if (settings != &pending_settings) {
+        memcpy(&pending_settings, settings, sizeof(flash_t));
     }
-
-    printf("[flash] Sector erase complete\n");
+    current_sequence--;
+    save_pending = true;
+    last_change_time = get_absolute_time();
+    printf("[flash] Flash queue full, save deferred\n");
 }
 
-// Force immediate save (bypasses debouncing)
+// Queue a save on the flash scheduler (runs at the next safe point).
 // With dual-sector design, this is always safe - we erase the OTHER sector
 void flash_save_now(const flash_t* settings)
 {
-    static flash_t write_settings;
-    memcpy(&write_settings, settings, sizeof(flash_t));
-    write_settings.magic = SETTINGS_MAGIC;
-    write_settings.schema_version = FLASH_SCHEMA_VERSION;
-    write_settings.sequence = ++current_sequence;
+    flash_t* write_settings = &queued_settings;
+    memcpy(write_settings, settings, sizeof(flash_t));
+    write_settings->magic = SETTINGS_MAGIC;
+    write_settings->schema_version = FLASH_SCHEMA_VERSION;
+    write_settings->sequence = ++current_sequence;
 
-    // Find next empty slot
-    int slot = find_empty_slot();
+    // Previous save still queued - overwrite it in place
+    int slot = has_queued_record() ? queued_slot : find_empty_slot();
 
     if (slot < 0) {
         // Both sectors full - find newest slot and erase the OTHER sector
         int newest = find_newest_slot();
         uint8_t newest_sector = (newest >= 0) ? get_slot_sector(newest) : 0;
         uint8_t erase_sector = (newest_sector == 0) ? 1 : 0;
+        uint32_t offset = (erase_sector == 0) ? FLASH_SECTOR_A_OFFSET : FLASH_SECTOR_B_OFFSET;
 
-        printf("[flash] Both sectors full, erasing sector %c\n",
-               (erase_sector == 0) ? 'A' : 'B');
-        flash_erase_sector(erase_sector);
+        printf("[flash] Both sectors full, erasing sector %c at offset 0x%lX\n",
+               (erase_sector == 0) ? 'A' : 'B', (unsigned long)offset);
+        if (!flash_sched_erase(offset)) {
+            flash_save_retry(write_settings);
+            return;
+        }
 
         // Write to first slot of erased sector
         slot = (erase_sector == 0) ? 0 : SLOTS_PER_SECTOR;
     }
 
     printf("[flash] Writing to slot %d (seq=%lu) at offset 0x%lX\n",
-           slot, (unsigned long)write_settings.sequence,
+           slot, (unsigned long)write_settings->sequence,
            (unsigned long)get_slot_offset(slot));
 
-    flash_write_page(slot, &write_settings);
-
-    // Verify the write
-    const flash_t* verify = get_slot(slot);
-    printf("[flash] Verify: magic=0x%08lX, seq=%lu, profile=%d, usb_mode=%d, orient=%d\n",
-           (unsigned long)verify->magic, (unsigned long)verify->sequence,
-           verify->active_profile_index, verify->usb_output_mode,
-           verify->wiimote_orient_mode);
-
+    if (!flash_sched_program(get_slot_offset(slot), write_settings, sizeof(flash_t))) {
+        flash_save_retry(write_settings);
+        return;
+    }
+    queued_slot = slot;
     save_pending = false;
 }
 
-// Force immediate save - same as flash_save_now() with dual-sector design
-// Kept for API compatibility
+// Save and wait for the write to land (use before device reset). Draining
+// the queue first means the save can't be refused.
 void flash_save_force(const flash_t* settings)
 {
+    flash_sched_flush();
     flash_save_now(settings);
+    flash_sched_flush();
 }
 
 void flash_factory_reset(void)
 {
     // Erase the settings sector
     flash_t empty = {0};
-    flash_save_now(&empty);
+    flash_save_force(&empty);
     printf("[flash] Factory reset — settings erased\n");
 }
 
 // Task function to handle debounced flash writes (call from main loop)
 void flash_task(void)
 {
-    if (!save_pending) {
-        return;
+    if (save_pending) {
+        // Check if debounce time has elapsed
+        int64_t time_since_change = absolute_time_diff_us(last_change_time, get_absolute_time());
+        if (time_since_change >= (SAVE_DEBOUNCE_MS * 1000)) {
+            flash_save_now(&pending_settings);
+        }
     }
 
-    // Check if debounce time has elapsed
-    int64_t time_since_change = absolute_time_diff_us(last_change_time, get_absolute_time());
-    if (time_since_change >= (SAVE_DEBOUNCE_MS * 1000)) {
-        flash_save_now(&pending_settings);
-    }
+    flash_sched_task();
 }
 
 // Called when BT disconnects - kept for API compatibility
@@ -416,10 +364,10 @@ void flash_on_bt_disconnect(void)
     // No-op with dual-sector design
 }
 
-// Check if there's a pending write waiting
+// Check if there's a pending write waiting (debounce or scheduler queue)
 bool flash_has_pending_write(void)
 {
-    return save_pending;
+    return save_pending || has_queued_record();
 }
 
 // ============================================================================
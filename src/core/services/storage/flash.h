@@ -3,7 +3,7 @@
 // Uses journaled storage for BT-safe writes:
 // - 4KB sector = 16 x 256-byte slots (ring buffer)
 // - Each save writes to next empty slot (page program only, ~1ms)
-// - Sector erase (~45ms) only when full AND BT is idle
+// - Sector erase (~45ms) only when full, deferred until the console is idle
 // - Sequence number identifies newest entry
 //
 // Settings persist across power cycles and firmware updates (unless flash is erased).
@@ -127,16 +127,18 @@ bool flash_load(flash_t* settings);
 // Save settings to flash (debounced - actual write happens after delay)
 void flash_save(const flash_t* settings);
 
-// Force immediate save (bypasses debouncing - use sparingly)
+// Save without debouncing - queued on the flash scheduler, which programs it
+// at the next safe point between console polls
 void flash_save_now(const flash_t* settings);
 
-// Force immediate save, ignoring BT-active check (use before device reset)
+// Save and block until it is in flash (use before device reset)
 void flash_save_force(const flash_t* settings);
 
 // Factory reset — erase all stored data (settings, bonds, pad config)
 void flash_factory_reset(void);
 
-// Task function to handle debounced flash writes (call from main loop)
+// Task function to handle debounced flash writes and run the flash
+// scheduler (call from main loop)
 void flash_task(void);
 
 // Notify flash system that BT has disconnected (safe to write now)
@@ -169,10 +171,10 @@ flash_t* flash_get_settings(void);
 // Get active custom profile index (0=Default/passthrough, 1-4=custom profiles)
 uint8_t flash_get_active_profile_index(void);
 
-// Set active custom profile index (immediate flash write — blocks ~50 ms
-// with interrupts disabled). Use for PROFILE.SET from the web config and
-// other rare deliberate-config paths where landing before a reboot
-// matters more than not stalling a hot path.
+// Set active custom profile index (immediate save — queued on the flash
+// scheduler rather than debounced). Use for PROFILE.SET from the web config
+// and other rare deliberate-config paths where landing before a reboot
+// matters more than coalescing rapid changes.
 void flash_set_active_profile_index(uint8_t index);
 
 // Same effect as flash_set_active_profile_index, but the flash write is
@@ -0,0 +1,320 @@
+// core/services/storage/flash_sched.c - Flash erase/program scheduler
+//
+// Ops are kept in submission order. Each flash_sched_task() picks the ops
+// that fit before the next console poll (or everything, when no console is
+// polling), runs them as one batch with XIP paused, and drops them from the
+// queue. An op that can't run blocks later ops to the same sector so the
+// chip always sees erase -> program in the order it was asked for. Nothing
+// outside flash_sched_flush() runs while a poll is due: a full queue refuses
+// new ops instead of flushing, and overdue ops still wait for a gap.
+
+#include "core/services/storage/flash_sched.h"
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "pico/flash.h"
+#include <string.h>
+#include <stdio.h>
+
+// Worst-case cost used to fit a batch between polls
+#define PROGRAM_COST_US   1000   // 256-byte page + lockout round trip
+#define ERASE_COST_US     50000  // 4KB sector
+#define GUARD_US          300    // Margin before the next poll is due
+#define BURST_GAP_US      1000   // Quiet time that ends a burst (Maple polls ports back to back)
+#define FLUSH_WAIT_US     20000  // flash_sched_flush waits this long for a window
+
+typedef enum {
+    OP_PROGRAM = 0,
+    OP_ERASE,
+} flash_op_kind_t;
+
+typedef struct {
+    uint8_t kind;
+    bool run;                       // Selected for the current batch
+    bool overdue;                   // Past FLASH_SCHED_MAX_DEFER_MS (logged once)
+    uint32_t offset;
+    uint32_t queued_ms;
+    uint8_t page[FLASH_PAGE_SIZE];
+} flash_op_t;
+
+static flash_op_t ops[FLASH_SCHED_MAX_OPS];
+static uint8_t op_count = 0;
+static flash_sched_stats_t stats;
+
+// Console poll timing (written by core 1, read by core 0)
+static volatile uint32_t poll_last_us = 0;
+static volatile uint32_t poll_period_us = 0;
+static volatile bool poll_seen = false;
+
+static inline uint32_t sector_of(uint32_t offset)
+{
+    return offset & ~(uint32_t)(FLASH_SECTOR_SIZE - 1);
+}
+
+// ============================================================================
+// SAFE-POINT TRACKING
+// ============================================================================
+
+void __not_in_flash_func(flash_sched_console_polled)(void)
+{
+    uint32_t now = time_us_32();
+    uint32_t gap = now - poll_last_us;
+
+    if (!poll_seen || gap >= FLASH_SCHED_IDLE_US) {
+        poll_period_us = 0;  // (Re)learn the rate after idle
+    } else if (gap >= BURST_GAP_US) {
+        // Gap between bursts: follow the shortest recent one, relax slowly
+        // so a single early poll doesn't close the window for good
+        uint32_t period = poll_period_us;
+        if (period == 0 || gap < period) {
+            poll_period_us = gap;
+        } else {
+            poll_period_us = period + ((gap - period) >> 4);
+        }
+    }
+
+    poll_last_us = now;
+    poll_seen = true;
+}
+
+// Microseconds until the next poll is due, UINT32_MAX if the console is idle
+static uint32_t window_us(void)
+{
+    if (!poll_seen) return UINT32_MAX;
+
+    uint32_t since = time_us_32() - poll_last_us;
+    if (since >= FLASH_SCHED_IDLE_US) return UINT32_MAX;
+
+    // Still inside a burst, or no rate learned yet
+    uint32_t period = poll_period_us;
+    if (since < BURST_GAP_US || period == 0 || since + GUARD_US >= period) return 0;
+    return period - since - GUARD_US;
+}
+
+// ============================================================================
+// BATCH EXECUTION
+// ============================================================================
+
+static void __no_inline_not_in_flash_func(batch_worker)(void* param)
+{
+    (void)param;
+    for (uint8_t i = 0; i < op_count; i++) {
+        if (!ops[i].run) continue;
+        if (ops[i].kind == OP_ERASE) {
+            flash_range_erase(ops[i].offset, FLASH_SECTOR_SIZE);
+        } else {
+            flash_range_program(ops[i].offset, ops[i].page, FLASH_PAGE_SIZE);
+        }
+    }
+}
+
+// Mark the ops that fit in budget (all of them if all=true). Erases wait for
+// the console to go idle; once overdue they also take a poll gap long enough
+// for them. Returns the estimated cost.
+static uint32_t select_batch(uint32_t budget, bool all)
+{
+    uint32_t blocked[FLASH_SCHED_MAX_OPS];
+    uint8_t blocked_count = 0;
+    uint32_t cost = 0;
+    uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+
+    for (uint8_t i = 0; i < op_count; i++) {
+        flash_op_t* op = &ops[i];
+        uint32_t sector = sector_of(op->offset);
+        op->run = false;
+
+        bool is_blocked = false;
+        for (uint8_t b = 0; b < blocked_count; b++) {
+            if (blocked[b] == sector) { is_blocked = true; break; }
+        }
+        if (is_blocked) continue;
+
+        uint32_t op_cost = (op->kind == OP_ERASE) ? ERASE_COST_US : PROGRAM_COST_US;
+        bool overdue = (now_ms - op->queued_ms) >= FLASH_SCHED_MAX_DEFER_MS;
+        bool fits = (cost + op_cost <= budget) &&
+                    (op->kind != OP_ERASE || budget == UINT32_MAX || overdue);
+
+        if (overdue && !op->overdue) {
+            op->overdue = true;
+            stats.overdue++;
+            printf("[flash_sched] %s at 0x%lX waiting %lums for a poll gap\n",
+                   op->kind == OP_ERASE ? "Erase" : "Program",
+                   (unsigned long)op->offset, (unsigned long)(now_ms - op->queued_ms));
+        }
+
+        if (all || fits) {
+            op->run = true;
+            cost += op_cost;
+        } else {
+            blocked[blocked_count++] = sector;
+        }
+    }
+    return cost;
+}
+
+static void run_batch(uint32_t budget, uint32_t cost)
+{
+    uint32_t start = time_us_32();
+    if (flash_safe_execute(batch_worker, NULL, UINT32_MAX) != PICO_OK) {
+        // Other core isn't a lockout victim (CONFIG_NO_FLASH_LOCKOUT)
+        uint32_t ints = save_and_disable_interrupts();
+        batch_worker(NULL);
+        restore_interrupts(ints);
+    }
+    uint32_t stall = time_us_32() - start;
+
+    stats.batches++;
+    stats.stall_last_us = stall;
+    if (cost > budget) stats.forced++;
+    if (stall > stats.stall_max_us) {
+        stats.stall_max_us = stall;
+        printf("[flash_sched] Worst stall now %luus\n", (unsigned long)stall);
+    }
+
+    // Drop what ran, keep the rest in order
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < op_count; i++) {
+        if (ops[i].run) {
+            if (ops[i].kind == OP_ERASE) stats.erases++;
+            else stats.programs++;
+            continue;
+        }
+        if (kept != i) ops[kept] = ops[i];
+        kept++;
+    }
+    op_count = kept;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+// A full queue only drains here when no console is polling, where a stall
+// can't cost a poll. Otherwise the op is refused (NULL) and the caller keeps
+// its data for a retry.
+static flash_op_t* alloc_op(uint8_t kind, uint32_t offset)
+{
+    if (op_count >= FLASH_SCHED_MAX_OPS && window_us() == UINT32_MAX) {
+        run_batch(UINT32_MAX, select_batch(UINT32_MAX, true));
+    }
+    if (op_count >= FLASH_SCHED_MAX_OPS) {
+        stats.refused++;
+        printf("[flash_sched] Queue full, refused %s at 0x%lX\n",
+               kind == OP_ERASE ? "erase" : "program", (unsigned long)offset);
+        return NULL;
+    }
+    flash_op_t* op = &ops[op_count++];
+    op->kind = kind;
+    op->run = false;
+    op->overdue = false;
+    op->offset = offset;
+    op->queued_ms = to_ms_since_boot(get_absolute_time());
+    return op;
+}
+
+bool flash_sched_program(uint32_t offset, const void* data, uint32_t len)
+{
+    if (len > FLASH_PAGE_SIZE) len = FLASH_PAGE_SIZE;
+
+    // Newer data for a page still in the queue replaces it, as long as no
+    // erase of its sector was queued after it
+    flash_op_t* op = NULL;
+    for (int i = (int)op_count - 1; i >= 0; i--) {
+        if (ops[i].kind == OP_ERASE && ops[i].offset == sector_of(offset)) break;
+        if (ops[i].kind == OP_PROGRAM && ops[i].offset == offset) {
+            op = &ops[i];
+            stats.coalesced++;
+            break;
+        }
+    }
+    if (!op) op = alloc_op(OP_PROGRAM, offset);
+    if (!op) return false;
+
+    memcpy(op->page, data, len);
+    memset(op->page + len, 0xFF, FLASH_PAGE_SIZE - len);
+    return true;
+}
+
+bool flash_sched_erase(uint32_t offset)
+{
+    offset = sector_of(offset);
+
+    // Anything queued for this sector would be wiped by the erase anyway
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < op_count; i++) {
+        if (sector_of(ops[i].offset) == offset) {
+            stats.coalesced++;
+            continue;
+        }
+        if (kept != i) ops[kept] = ops[i];
+        kept++;
+    }
+    op_count = kept;
+
+    return alloc_op(OP_ERASE, offset) != NULL;
+}
+
+bool flash_sched_is_queued(uint32_t offset)
+{
+    for (uint8_t i = 0; i < op_count; i++) {
+        if (ops[i].kind == OP_PROGRAM && ops[i].offset == offset) return true;
+    }
+    return false;
+}
+
+void flash_sched_read(uint32_t offset, void* dst, uint32_t len)
+{
+    uint8_t* out = (uint8_t*)dst;
+    memcpy(out, (const void*)(XIP_BASE + offset), len);
+
+    // Replay the queue over the range. Programming can only clear bits.
+    for (uint8_t i = 0; i < op_count; i++) {
+        uint32_t start = ops[i].offset;
+        uint32_t size = (ops[i].kind == OP_ERASE) ? FLASH_SECTOR_SIZE : FLASH_PAGE_SIZE;
+        uint32_t lo = (start > offset) ? start : offset;
+        uint32_t hi = (start + size < offset + len) ? start + size : offset + len;
+        if (lo >= hi) continue;
+
+        if (ops[i].kind == OP_ERASE) {
+            memset(out + (lo - offset), 0xFF, hi - lo);
+        } else {
+            for (uint32_t a = lo; a < hi; a++) {
+                out[a - offset] &= ops[i].page[a - start];
+            }
+        }
+    }
+}
+
+void flash_sched_task(void)
+{
+    if (op_count == 0) return;
+
+    // Only start right after a poll (or while idle) so at worst an overdue
+    // op costs the polls its stall overlaps, never a half-answered one
+    uint32_t budget = window_us();
+    if (budget == 0) return;
+
+    uint32_t cost = select_batch(budget, false);
+    if (cost > 0) run_batch(budget, cost);
+}
+
+void flash_sched_flush(void)
+{
+    if (op_count == 0) return;
+
+    uint32_t start = time_us_32();
+    uint32_t budget;
+    while ((budget = window_us()) == 0 && time_us_32() - start < FLUSH_WAIT_US) {
+        tight_loop_contents();
+    }
+
+    uint32_t cost = select_batch(budget, true);
+    run_batch(budget, cost);
+}
+
+void flash_sched_get_stats(flash_sched_stats_t* out)
+{
+    if (!out) return;
+    *out = stats;
+    out->queued = op_count;
+}
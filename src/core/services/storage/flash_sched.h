@@ -0,0 +1,82 @@
+// core/services/storage/flash_sched.h - Flash erase/program scheduler
+//
+// Every on-chip flash write (settings journal, pad config, BTstack TLV banks)
+// goes through this queue instead of calling flash_range_* directly. Erasing
+// or programming the QSPI flash stalls XIP for both cores, so the scheduler:
+// - Coalesces: a program to a page that is still queued replaces it, and an
+//   erase drops queued programs to the same sector
+// - Batches: everything runnable goes out under one flash_safe_execute
+// - Runs at safe points: right after the console output answered a poll,
+//   only if the batch fits before the next poll is due. Sector erases
+//   (~45ms) wait until the console stops polling, or once overdue, for a
+//   poll gap long enough to hold one.
+// - Never forces a stall into active polling: a full queue refuses new ops
+//   (the call returns false) unless the console is idle. Only
+//   flash_sched_flush() runs regardless.
+//
+// Reads of a queued range must go through flash_sched_read() so callers see
+// the data they wrote before it reaches the chip.
+
+#ifndef FLASH_SCHED_H
+#define FLASH_SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Queue depth (each entry holds one 256-byte page). A full queue refuses
+// ops while a console polls, so leave room for a BTstack TLV bank erase
+// plus the pages of a pairing's writes on top of settings saves.
+#ifndef FLASH_SCHED_MAX_OPS
+#define FLASH_SCHED_MAX_OPS 16
+#endif
+
+// Console counts as idle after this long without a poll
+#ifndef FLASH_SCHED_IDLE_US
+#define FLASH_SCHED_IDLE_US 100000
+#endif
+
+// An op held back this long is logged and lets an erase take any poll gap
+// that fits it, instead of waiting for the console to go idle
+#ifndef FLASH_SCHED_MAX_DEFER_MS
+#define FLASH_SCHED_MAX_DEFER_MS   60000
+#endif
+
+typedef struct {
+    uint32_t programs;          // Pages programmed
+    uint32_t erases;            // Sectors erased
+    uint32_t coalesced;         // Queued ops replaced or dropped before running
+    uint32_t batches;           // flash_safe_execute calls
+    uint32_t forced;            // Batches run outside a safe window (flush)
+    uint32_t refused;           // Ops turned away because the queue was full
+    uint32_t overdue;           // Ops that waited past FLASH_SCHED_MAX_DEFER_MS
+    uint32_t stall_last_us;     // Duration of the last batch
+    uint32_t stall_max_us;      // Worst batch since boot
+    uint8_t  queued;            // Ops currently waiting
+} flash_sched_stats_t;
+
+// Queue a page program. offset must be page-aligned, len <= FLASH_PAGE_SIZE.
+// Returns false if the queue is full and the console is polling.
+bool flash_sched_program(uint32_t offset, const void* data, uint32_t len);
+
+// Queue a sector erase. offset must be sector-aligned. Returns false if the
+// queue is full and the console is polling.
+bool flash_sched_erase(uint32_t offset);
+
+// True while a program to the page at offset is still queued
+bool flash_sched_is_queued(uint32_t offset);
+
+// Read flash as it will be once the queue drains
+void flash_sched_read(uint32_t offset, void* dst, uint32_t len);
+
+// Run queued ops that fit the current safe window (call from main loop)
+void flash_sched_task(void);
+
+// Run everything now (before reset, or when the data must land)
+void flash_sched_flush(void);
+
+// Console outputs call this on core 1 right after answering a poll
+void flash_sched_console_polled(void);
+
+void flash_sched_get_stats(flash_sched_stats_t* stats);
+
+#endif // FLASH_SCHED_H
@@ -90,8 +90,8 @@ static uint8_t jw_scale_adc(uint8_t inst, uint8_t axis, uint16_t raw) {
     return (uint8_t)(((int32_t)(raw - eff_min) * 255) / eff_range);
 }
 
-#define JOYWING_DEV_ADDR_STANDALONE 0xE0
-#define JOYWING_DEV_ADDR_MERGED    0xF0
+#define JOYWING_DEV_ADDR_STANDALONE DEV_ADDR_JOYWING
+#define JOYWING_DEV_ADDR_MERGED    DEV_ADDR_PAD_BASE
 
 // When true, joywing_task skips router_submit_input (pad_input merges us)
 static bool merge_with_pad = false;
@@ -169,7 +169,7 @@ static void joywing_init_instance(uint8_t idx)
     printf("[joywing:%d] Initialized\n", idx);
 }
 
-static void joywing_init(void)
+static void joywing_init_event(void)
 {
     // Initialize ADC calibration
     jw_cal_init();
@@ -180,13 +180,32 @@ static void joywing_init(void)
     joywing_event.instance = 0;
     joywing_event.type = INPUT_TYPE_GAMEPAD;
     joywing_event.transport = INPUT_TRANSPORT_GPIO;
+}
 
+static void joywing_init(void)
+{
+    joywing_init_event();
     for (uint8_t i = 0; i < instance_count; i++) {
         joywing_init_instance(i);
     }
     printf("[joywing] %d instance(s) initialized\n", instance_count);
 }
 
+// One seesaw probe per main loop pass: each is several I2C transactions
+static input_init_result_t joywing_init_stage(uint8_t stage)
+{
+    if (stage == 0) {
+        joywing_init_event();
+        return INPUT_INIT_NEXT;
+    }
+    if (stage <= instance_count) {
+        joywing_init_instance(stage - 1);
+        return INPUT_INIT_NEXT;
+    }
+    printf("[joywing] %d instance(s) initialized\n", instance_count);
+    return INPUT_INIT_DONE;
+}
+
 // Poll one instance and merge its data into the shared event
 static void joywing_poll_instance(uint8_t idx)
 {
@@ -285,6 +304,7 @@ const InputInterface joywing_input_interface = {
     .source = INPUT_SOURCE_GPIO,
     .init = joywing_init,
     .task = joywing_task,
+    .init_stage = joywing_init_stage,
     .is_connected = joywing_is_connected,
     .get_device_count = joywing_get_device_count,
 };
@@ -28,8 +28,8 @@
 #define I2C_PEER_PROTOCOL_VER   1       // Protocol version (upper nibble of status)
 #define I2C_PEER_BAUDRATE       400000  // 400kHz fast mode
 
-// Device address range for I2C peer devices (distinct from USB, BT, UART)
-#define I2C_PEER_DEV_ADDR_BASE  0xE0
+// Device address range for I2C peer devices (see core/dev_addr.h)
+#define I2C_PEER_DEV_ADDR_BASE  DEV_ADDR_I2C_PEER_BASE
 
 // ============================================================================
 // REGISTER MAP
@@ -26,9 +26,11 @@
 #include "core/app_registry.h"
 #include "core/input_interface.h"
 #include "core/output_interface.h"
+#include "core/router/router.h"
 #include "core/services/players/manager.h"
 #include "core/services/leds/leds.h"
 #include "core/services/storage/storage.h"
+#include "core/services/loadgen/loadgen.h"
 
 // App layer (linked per-product)
 extern void app_init(void);
@@ -73,10 +75,59 @@ static void core1_wrapper(void) {
   if (core1_actual_task) {
     core1_actual_task();
   } else {
-    // No task - just idle forever while handling flash lockout requests
-    while (1) {
-      __wfi();  // Wait for interrupt (low power idle)
-    }
+    // No task - idle while handling flash lockout requests, and run one-shot
+    // jobs posted by core 0 (platform_idle_core_submit)
+    extern void platform_idle_core_run(void);
+    platform_idle_core_run();
+  }
+}
+
+// ============================================================================
+// INPUT BRING-UP
+// ============================================================================
+// Inputs are initialized from the main loop rather than before it, so a slow
+// one (BT radio, MAX3421E, PIO USB) doesn't hold back the others. Each loop
+// iteration makes one init call per input that isn't ready yet; ready inputs
+// run their task in the same loop.
+
+static void input_bringup_step(uint8_t i)
+{
+  const InputInterface* in = inputs[i];
+  input_bringup_t* st = app_registry_input_bringup(i);
+
+  input_init_result_t result = INPUT_INIT_DONE;
+  if (in->init_stage) {
+    result = in->init_stage(st->stage);
+    if (result == INPUT_INIT_NEXT) st->stage++;
+  } else if (in->init) {
+    printf("[joypad] Initializing input: %s\n", in->name);
+    in->init();
+  }
+  if (result != INPUT_INIT_DONE) return;
+
+  st->ready = true;
+  st->ready_ms = to_ms_since_boot(get_absolute_time());
+  printf("[joypad] Input ready: %s (%lums)\n", in->name, (unsigned long)st->ready_ms);
+}
+
+// Run a ready input's task and note when it submits its first event
+static inline void input_task(uint8_t i)
+{
+  const InputInterface* in = inputs[i];
+  input_bringup_t* st = app_registry_input_bringup(i);
+
+  if (st->first_input_ms) {
+    in->task();
+    return;
+  }
+
+  uint32_t before = router_get_submit_count();
+  in->task();
+  if (router_get_submit_count() != before) {
+    st->first_input_ms = to_ms_since_boot(get_absolute_time());
+    printf("[joypad] First input: %s (%lums, %lums after ready)\n", in->name,
+           (unsigned long)st->first_input_ms,
+           (unsigned long)(st->first_input_ms - st->ready_ms));
   }
 }
 
@@ -93,13 +144,19 @@ static void __not_in_flash_func(core0_main)(void)
     players_task();
     if (first_loop) printf("[joypad] Loop: storage\n");
     storage_task();
+    loadgen_task();  // Synthetic input load (idle unless started over CDC)
 
     // Poll all input interfaces FIRST so output reads freshest data this iteration
     // (Eliminates one-loop-iteration latency vs polling input after output)
     for (uint8_t i = 0; i < input_count; i++) {
-      if (inputs[i] && inputs[i]->task) {
+      if (!inputs[i]) continue;
+      if (!app_registry_input_bringup(i)->ready) {
+        input_bringup_step(i);
+        continue;
+      }
+      if (inputs[i]->task) {
         if (first_loop) printf("[joypad] Loop: input %s\n", inputs[i]->name);
-        inputs[i]->task();
+        input_task(i);
       }
     }
 
@@ -180,16 +237,12 @@ int main(void)
   players_init();
   app_init();
 
-  // Render one LED frame before input init (which may block for seconds on MAX3421E)
-  leds_task();
-
-  // Get and initialize input interfaces
+  // Input interfaces are initialized by the main loop (see INPUT BRING-UP)
   inputs = app_get_input_interfaces(&input_count);
-  for (uint8_t i = 0; i < input_count; i++) {
-    if (inputs[i] && inputs[i]->init) {
-      printf("[joypad] Initializing input: %s\n", inputs[i]->name);
-      inputs[i]->init();
-    }
+  if (input_count > MAX_INPUT_INTERFACES) {
+    printf("[joypad] WARNING: %d inputs, only %d supported\n",
+           input_count, MAX_INPUT_INTERFACES);
+    input_count = MAX_INPUT_INTERFACES;
   }
 
   // Publish active interfaces so shared code (CDC, router) can introspect.
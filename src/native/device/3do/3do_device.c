@@ -447,7 +447,7 @@ static uint8_t parse_extension_to_router(uint8_t* buffer, size_t buffer_size) {
 
     input_event_t event;
     init_input_event(&event);
-    event.dev_addr = 0xE0 + count;  // 3DO extension range
+    event.dev_addr = DEV_ADDR_3DO_BASE + count;  // 3DO extension range
     event.instance = 0;
 
     uint8_t id_nibble = (byte0 >> 4) & 0x0F;
@@ -0,0 +1,24 @@
+// amiga_button_map.h - JP_BUTTON_* -> CD32 shift register bits
+//
+// Built into a button_encoder_t at init; checked against the old branch
+// encoder by test/button_encoder_test.c.
+
+#ifndef AMIGA_BUTTON_MAP_H
+#define AMIGA_BUTTON_MAP_H
+
+#include "amiga_buttons.h"
+#include "core/buttons.h"
+#include "core/button_encoder.h"
+
+// CD32 shift register is active-low: idle 0xFF, pressed buttons clear bits
+static const button_encoder_map_t cd32_button_map[] = {
+    { JP_BUTTON_B1, 1 << CD32_BIT_RED },
+    { JP_BUTTON_B2, 1 << CD32_BIT_BLUE },
+    { JP_BUTTON_B3, 1 << CD32_BIT_GREEN },
+    { JP_BUTTON_B4, 1 << CD32_BIT_YELLOW },
+    { JP_BUTTON_R1, 1 << CD32_BIT_RFRONT },
+    { JP_BUTTON_L1, 1 << CD32_BIT_LFRONT },
+    { JP_BUTTON_S2, 1 << CD32_BIT_PAUSE },
+};
+
+#endif // AMIGA_BUTTON_MAP_H
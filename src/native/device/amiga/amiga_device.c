@@ -16,6 +16,8 @@
 #include "amiga_buttons.h"
 #include "core/router/router.h"
 #include "core/input_event.h"
+#include "core/button_encoder.h"
+#include "amiga_button_map.h"
 #include "core/services/players/manager.h"
 #include "core/services/profiles/profile.h"
 // Minimal BOOTSEL button reader — avoids button service GP7 conflict
@@ -161,16 +163,10 @@ static void update_led(void) {
 // HELPER: Build CD32 byte from button bitmap
 // ============================================================================
 
+static button_encoder_t cd32_button_encoder;
+
 static uint8_t __not_in_flash_func(build_cd32_byte)(uint32_t buttons) {
-    uint8_t b = 0xFF;
-    if (buttons & JP_BUTTON_B1) b &= ~(1 << CD32_BIT_RED);
-    if (buttons & JP_BUTTON_B2) b &= ~(1 << CD32_BIT_BLUE);
-    if (buttons & JP_BUTTON_B3) b &= ~(1 << CD32_BIT_GREEN);
-    if (buttons & JP_BUTTON_B4) b &= ~(1 << CD32_BIT_YELLOW);
-    if (buttons & JP_BUTTON_R1) b &= ~(1 << CD32_BIT_RFRONT);
-    if (buttons & JP_BUTTON_L1) b &= ~(1 << CD32_BIT_LFRONT);
-    if (buttons & JP_BUTTON_S2) b &= ~(1 << CD32_BIT_PAUSE);
-    return b;
+    return (uint8_t)~button_encoder_encode(&cd32_button_encoder, buttons);
 }
 
 // ============================================================================
@@ -503,6 +499,9 @@ void amiga_device_task(void) {
 // ============================================================================
 
 void amiga_device_init(void) {
+    button_encoder_build(&cd32_button_encoder, cd32_button_map,
+                         sizeof(cd32_button_map) / sizeof(cd32_button_map[0]));
+
     // All DE9 signal pins start as inputs (open-collector, HIGH-Z = released)
     gpio_init(AMIGA_PIN_UP);    gpio_put(AMIGA_PIN_UP,    0); gpio_set_dir(AMIGA_PIN_UP,    GPIO_IN);
     gpio_init(AMIGA_PIN_DOWN);  gpio_put(AMIGA_PIN_DOWN,  0); gpio_set_dir(AMIGA_PIN_DOWN,  GPIO_IN);
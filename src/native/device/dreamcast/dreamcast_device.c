@@ -25,6 +25,7 @@
 #include "core/router/router.h"
 #include "core/services/players/manager.h"
 #include "core/services/players/feedback.h"
+#include "core/services/storage/flash_sched.h"
 #include "core/services/profiles/profile_indicator.h"
 #include "core/uart.h"
 #include "hardware/clocks.h"
@@ -59,6 +60,12 @@ static uint tx_sm = 0;
 #define ADDRESS_SUBPERIPHERAL1  0x02
 #define ADDRESS_PORT_MASK       0xC0
 #define ADDRESS_PERIPHERAL_MASK 0x3F
+#define ADDRESS_PORT_SHIFT      6
+
+// Maple ports A-D. Static responses are pre-serialized once per port so the
+// responder never rewrites port bits at request time.
+#define MAPLE_PORTS             4
+#define MAPLE_PORT(addr)        (((addr) & ADDRESS_PORT_MASK) >> ADDRESS_PORT_SHIFT)
 
 // ============================================================================
 // MAPLE BUS COMMANDS
@@ -235,38 +242,45 @@ typedef struct __attribute__((packed)) {
 static uint8_t RxBuffer[RX_BUFFER_SIZE] __attribute__((aligned(4)));
 static uint8_t Packet[1024 + 8] __attribute__((aligned(4)));
 
-// Pre-built response packets
-static FInfoPacket InfoPacket;
-static FAllInfoPacket AllInfoPacket;
-static FAllInfoPacket PuruPuruAllInfoPacket;
-static FControllerPacket ControllerPacket;
-static FACKPacket ACKPacket;
+// Pre-built response packets, one fully serialized copy (header + CRC) per
+// Maple port, indexed by the port of the request being answered
+static FInfoPacket InfoPacket[MAPLE_PORTS];
+static FAllInfoPacket AllInfoPacket[MAPLE_PORTS];
+static FAllInfoPacket PuruPuruAllInfoPacket[MAPLE_PORTS];
+static FACKPacket ACKPacket[MAPLE_PORTS];
+static FACKPacket PuruPuruACKPacket[MAPLE_PORTS];
+
+// Controller condition (GET_CONDITION response). Core 0 assembles a complete
+// per-port set in a free buffer whenever the input changes and publishes it;
+// the responder only picks up the ready buffer. Three buffers so Core 0
+// always has one that is neither published nor possibly still in DMA.
+#define CONDITION_BUFFERS 3
+static FControllerPacket ControllerPacket[CONDITION_BUFFERS][MAPLE_PORTS];
+static volatile uint8_t condition_ready = 0;    // Written by Core 0
+static volatile uint8_t condition_sending = 0;  // Written by responder
 
 #ifdef CONFIG_VMU
 // Shadow packets — built at init with VMU address, never modified after
 // dreamcast_enable_vmu() switches pointers atomically (safe on Cortex-M0+)
-static FInfoPacket InfoPacket_vmu;
-static FAllInfoPacket AllInfoPacket_vmu;
-static FControllerPacket ControllerPacket_vmu;
-static FACKPacket ACKPacket_vmu;
+static FInfoPacket InfoPacket_vmu[MAPLE_PORTS];
+static FAllInfoPacket AllInfoPacket_vmu[MAPLE_PORTS];
+static FACKPacket ACKPacket_vmu[MAPLE_PORTS];
 
 // Pointers used by Core 1 — atomic pointer switch in dreamcast_enable_vmu()
-static FInfoPacket * volatile pInfoPacket = &InfoPacket;
-static FAllInfoPacket * volatile pAllInfoPacket = &AllInfoPacket;
-static FControllerPacket * volatile pControllerPacket = &ControllerPacket;
-static FACKPacket * volatile pACKPacket = &ACKPacket;
+static FInfoPacket * volatile pInfoPacket = InfoPacket;
+static FAllInfoPacket * volatile pAllInfoPacket = AllInfoPacket;
+static FACKPacket * volatile pACKPacket = ACKPacket;
 #else
 // Non-VMU builds: pointer indirection unused; map to direct packet refs so
 // we don't have to wrap every send-site reference in #ifdef.
-#define pInfoPacket (&InfoPacket)
-#define pAllInfoPacket (&AllInfoPacket)
-#define pControllerPacket (&ControllerPacket)
-#define pACKPacket (&ACKPacket)
+#define pInfoPacket (InfoPacket)
+#define pAllInfoPacket (AllInfoPacket)
+#define pACKPacket (ACKPacket)
 #endif
-static FPuruPuruDeviceInfoPacket PuruPuruDeviceInfoPacket;
-static FPuruPuruInfoPacket PuruPuruInfoPacket;
-static FPuruPuruConditionPacket PuruPuruConditionPacket;
-static FPuruPuruBlockReadPacket PuruPuruBlockReadPacket;
+static FPuruPuruDeviceInfoPacket PuruPuruDeviceInfoPacket[MAPLE_PORTS];
+static FPuruPuruInfoPacket PuruPuruInfoPacket[MAPLE_PORTS];
+static FPuruPuruConditionPacket PuruPuruConditionPacket[MAPLE_PORTS];
+static FPuruPuruBlockReadPacket PuruPuruBlockReadPacket[MAPLE_PORTS];
 
 // Puru Puru AST (Auto-Stop Table) - default 5 second auto-stop
 static uint8_t purupuru_ast[4] = {0x05, 0x00, 0x00, 0x00};
@@ -281,16 +295,40 @@ static uint8_t purupuru_inc[MAX_PLAYERS] = {0};
 // This keeps packet processing fast to avoid DC timeout/disconnection
 static volatile bool purupuru_updated[MAX_PLAYERS] = {false};
 
-// Rumble timeout - DC doesn't send explicit "stop", it just stops sending commands
-static uint32_t last_rumble_time[MAX_PLAYERS] = {0};
+// Rumble timeout - DC doesn't send explicit "stop", it just stops sending commands.
+// Only port 0 receives SET_CONDITION. The timeout runs on the same core as
+// ConsumePacket (see dc_rumble_timeout_check) so that port's rumble mailbox
+// keeps a single writer.
+static volatile uint32_t last_rumble_time[MAX_PLAYERS] = {0};
 #define RUMBLE_TIMEOUT_MS 300  // Turn off rumble if no command for 300ms
 
 // ============================================================================
 // CONTROLLER STATE
 // ============================================================================
 
-// Controller state - volatile for cross-core access (Core 0 writes, Core 1 reads)
-static volatile dc_controller_state_t dc_state[MAX_PLAYERS];
+// Scale PuruPuru power (0-7 typical, but can be higher) to 0-255
+static inline uint8_t dc_rumble_level(uint8_t power)
+{
+    return (power * 36 > 255) ? 255 : (power * 36);
+}
+
+// Stop port 0 rumble once the console has gone quiet for RUMBLE_TIMEOUT_MS.
+// Called from the core that runs ConsumePacket (core 1 with
+// CONFIG_DC_CORE1_TX, core 0 otherwise).
+static inline void __not_in_flash_func(dc_rumble_timeout_check)(void)
+{
+    uint32_t started_ms = last_rumble_time[0];
+    if (started_ms == 0) return;
+
+    if ((time_us_32() / 1000) - started_ms > RUMBLE_TIMEOUT_MS) {
+        last_rumble_time[0] = 0;
+        feedback_console_post(0, 0, 0);
+    }
+}
+
+// Controller state - Core 0 only. Core 1 sees it through the condition
+// packets BuildConditionPackets() publishes.
+static dc_controller_state_t dc_state[MAX_PLAYERS];
 static uint8_t dc_rumble[MAX_PLAYERS];
 
 // ============================================================================
@@ -303,6 +341,7 @@ typedef enum {
     SEND_CONTROLLER_ALL_INFO,   // Extended device info for controller
     SEND_CONTROLLER_STATUS,
     SEND_ACK,
+    SEND_PURUPURU_ACK,          // ACK from the Puru Puru sub-peripheral
     SEND_PURUPURU_INFO,         // Device info for Puru Puru
     SEND_PURUPURU_ALL_INFO,     // Extended device info for Puru Puru
     SEND_PURUPURU_MEDIA_INFO,   // Media info (capabilities)
@@ -319,6 +358,7 @@ typedef enum {
 } ESendState;
 
 static volatile ESendState NextPacketSend = SEND_NOTHING;
+static volatile uint8_t NextPacketPort = 0;  // Maple port of the request being answered
 
 // ============================================================================
 // CRC CALCULATION
@@ -335,6 +375,30 @@ static uint32_t __not_in_flash_func(CalcCRC)(const uint32_t *Words, uint32_t Num
     return XOR;
 }
 
+// Compute the CRC word of a pre-built packet (BitPairsMinus1, header,
+// payload, CRC) of Size bytes
+static void __not_in_flash_func(SealPacket)(void *Slot, uint32_t Size)
+{
+    uint32_t *Words = (uint32_t *)Slot;
+    uint32_t NumWords = Size / sizeof(uint32_t);
+    Words[NumWords - 1] = CalcCRC(&Words[1], NumWords - 2);
+}
+
+// Replicate the port A packet in Slots[0] into the other port slots, setting
+// the port bits of Origin and Destination
+static void StampPorts(void *Slots, uint32_t Size)
+{
+    uint8_t *Base = (uint8_t *)Slots;
+    for (uint32_t port = 1; port < MAPLE_PORTS; port++) {
+        uint8_t *Slot = Base + port * Size;
+        memcpy(Slot, Base, Size);
+        PacketHeader *Header = (PacketHeader *)(Slot + sizeof(uint32_t));
+        Header->Origin = (Header->Origin & ADDRESS_PERIPHERAL_MASK) | (port << ADDRESS_PORT_SHIFT);
+        Header->Destination = (Header->Destination & ADDRESS_PERIPHERAL_MASK) | (port << ADDRESS_PORT_SHIFT);
+        SealPacket(Slot, Size);
+    }
+}
+
 // ============================================================================
 // PACKET BUILDERS
 // ============================================================================
@@ -353,199 +417,242 @@ static uint8_t current_controller_address = ADDRESS_CONTROLLER_ONLY;
 
 static void BuildInfoPacket(void)
 {
-    InfoPacket.BitPairsMinus1 = (sizeof(InfoPacket) - 7) * 4 - 1;
+    InfoPacket[0].BitPairsMinus1 = (sizeof(InfoPacket[0]) - 7) * 4 - 1;
 
-    InfoPacket.Header.Command = CMD_RESPOND_DEVICE_STATUS;
-    InfoPacket.Header.Destination = ADDRESS_DREAMCAST;
+    InfoPacket[0].Header.Command = CMD_RESPOND_DEVICE_STATUS;
+    InfoPacket[0].Header.Destination = ADDRESS_DREAMCAST;
     // Advertise controller + Puru Puru sub-peripheral
-    InfoPacket.Header.Origin = ADDRESS_CONTROLLER_AND_SUBS;
-    InfoPacket.Header.NumWords = sizeof(InfoPacket.Info) / sizeof(uint32_t);
-
-    InfoPacket.Info.Func = __builtin_bswap32(FUNC_CONTROLLER);
-    InfoPacket.Info.FuncData[0] = __builtin_bswap32(0x000f06fe);  // Buttons supported
-    InfoPacket.Info.FuncData[1] = 0;
-    InfoPacket.Info.FuncData[2] = 0;
-    InfoPacket.Info.AreaCode = -1;  // All regions
-    InfoPacket.Info.ConnectorDirection = 0;
-    strncpy(InfoPacket.Info.ProductName, "Dreamcast Controller          ", sizeof(InfoPacket.Info.ProductName));
-    strncpy(InfoPacket.Info.ProductLicense,
+    InfoPacket[0].Header.Origin = ADDRESS_CONTROLLER_AND_SUBS;
+    InfoPacket[0].Header.NumWords = sizeof(InfoPacket[0].Info) / sizeof(uint32_t);
+
+    InfoPacket[0].Info.Func = __builtin_bswap32(FUNC_CONTROLLER);
+    InfoPacket[0].Info.FuncData[0] = __builtin_bswap32(0x000f06fe);  // Buttons supported
+    InfoPacket[0].Info.FuncData[1] = 0;
+    InfoPacket[0].Info.FuncData[2] = 0;
+    InfoPacket[0].Info.AreaCode = -1;  // All regions
+    InfoPacket[0].Info.ConnectorDirection = 0;
+    strncpy(InfoPacket[0].Info.ProductName, "Dreamcast Controller          ", sizeof(InfoPacket[0].Info.ProductName));
+    strncpy(InfoPacket[0].Info.ProductLicense,
             "Produced By or Under License From SEGA ENTERPRISES,LTD.     ",
-            sizeof(InfoPacket.Info.ProductLicense));
-    InfoPacket.Info.StandbyPower = 430;
-    InfoPacket.Info.MaxPower = 500;
+            sizeof(InfoPacket[0].Info.ProductLicense));
+    InfoPacket[0].Info.StandbyPower = 430;
+    InfoPacket[0].Info.MaxPower = 500;
 
-    InfoPacket.CRC = CalcCRC((uint32_t *)&InfoPacket.Header, sizeof(InfoPacket) / sizeof(uint32_t) - 2);
+    InfoPacket[0].CRC = CalcCRC((uint32_t *)&InfoPacket[0].Header, sizeof(InfoPacket[0]) / sizeof(uint32_t) - 2);
+    StampPorts(InfoPacket, sizeof(InfoPacket[0]));
 }
 
 static void BuildAllInfoPacket(void)
 {
-    AllInfoPacket.BitPairsMinus1 = (sizeof(AllInfoPacket) - 7) * 4 - 1;
-
-    AllInfoPacket.Header.Command = CMD_RESPOND_ALL_DEVICE_STATUS;
-    AllInfoPacket.Header.Destination = ADDRESS_DREAMCAST;
-    AllInfoPacket.Header.Origin = ADDRESS_CONTROLLER_AND_SUBS;
-    AllInfoPacket.Header.NumWords = sizeof(AllInfoPacket.Info) / sizeof(uint32_t);
-
-    AllInfoPacket.Info.Func = __builtin_bswap32(FUNC_CONTROLLER);
-    AllInfoPacket.Info.FuncData[0] = __builtin_bswap32(0x000f06fe);  // Buttons supported
-    AllInfoPacket.Info.FuncData[1] = 0;
-    AllInfoPacket.Info.FuncData[2] = 0;
-    AllInfoPacket.Info.AreaCode = -1;
-    AllInfoPacket.Info.ConnectorDirection = 0;
-    strncpy(AllInfoPacket.Info.ProductName, "Dreamcast Controller          ", sizeof(AllInfoPacket.Info.ProductName));
-    strncpy(AllInfoPacket.Info.ProductLicense,
+    AllInfoPacket[0].BitPairsMinus1 = (sizeof(AllInfoPacket[0]) - 7) * 4 - 1;
+
+    AllInfoPacket[0].Header.Command = CMD_RESPOND_ALL_DEVICE_STATUS;
+    AllInfoPacket[0].Header.Destination = ADDRESS_DREAMCAST;
+    AllInfoPacket[0].Header.Origin = ADDRESS_CONTROLLER_AND_SUBS;
+    AllInfoPacket[0].Header.NumWords = sizeof(AllInfoPacket[0].Info) / sizeof(uint32_t);
+
+    AllInfoPacket[0].Info.Func = __builtin_bswap32(FUNC_CONTROLLER);
+    AllInfoPacket[0].Info.FuncData[0] = __builtin_bswap32(0x000f06fe);  // Buttons supported
+    AllInfoPacket[0].Info.FuncData[1] = 0;
+    AllInfoPacket[0].Info.FuncData[2] = 0;
+    AllInfoPacket[0].Info.AreaCode = -1;
+    AllInfoPacket[0].Info.ConnectorDirection = 0;
+    strncpy(AllInfoPacket[0].Info.ProductName, "Dreamcast Controller          ", sizeof(AllInfoPacket[0].Info.ProductName));
+    strncpy(AllInfoPacket[0].Info.ProductLicense,
             "Produced By or Under License From SEGA ENTERPRISES,LTD.     ",
-            sizeof(AllInfoPacket.Info.ProductLicense));
-    AllInfoPacket.Info.StandbyPower = 430;
-    AllInfoPacket.Info.MaxPower = 500;
-    strncpy(AllInfoPacket.Info.FreeDeviceStatus,
+            sizeof(AllInfoPacket[0].Info.ProductLicense));
+    AllInfoPacket[0].Info.StandbyPower = 430;
+    AllInfoPacket[0].Info.MaxPower = 500;
+    strncpy(AllInfoPacket[0].Info.FreeDeviceStatus,
             "Version 1.010,1998/09/28,315-6125-AB   ,Analog Module : The 4th Edition. 05/08  ",
-            sizeof(AllInfoPacket.Info.FreeDeviceStatus));
+            sizeof(AllInfoPacket[0].Info.FreeDeviceStatus));
 
-    AllInfoPacket.CRC = CalcCRC((uint32_t *)&AllInfoPacket.Header, sizeof(AllInfoPacket) / sizeof(uint32_t) - 2);
+    AllInfoPacket[0].CRC = CalcCRC((uint32_t *)&AllInfoPacket[0].Header, sizeof(AllInfoPacket[0]) / sizeof(uint32_t) - 2);
+    StampPorts(AllInfoPacket, sizeof(AllInfoPacket[0]));
 }
 
 static void BuildPuruPuruAllInfoPacket(void)
 {
-    PuruPuruAllInfoPacket.BitPairsMinus1 = (sizeof(PuruPuruAllInfoPacket) - 7) * 4 - 1;
-
-    PuruPuruAllInfoPacket.Header.Command = CMD_RESPOND_ALL_DEVICE_STATUS;
-    PuruPuruAllInfoPacket.Header.Destination = ADDRESS_DREAMCAST;
-    PuruPuruAllInfoPacket.Header.Origin = ADDRESS_SUBPERIPHERAL1;
-    PuruPuruAllInfoPacket.Header.NumWords = sizeof(PuruPuruAllInfoPacket.Info) / sizeof(uint32_t);
-
-    PuruPuruAllInfoPacket.Info.Func = __builtin_bswap32(FUNC_VIBRATION);
-    PuruPuruAllInfoPacket.Info.FuncData[0] = __builtin_bswap32(0x01010000);
-    PuruPuruAllInfoPacket.Info.FuncData[1] = 0;
-    PuruPuruAllInfoPacket.Info.FuncData[2] = 0;
-    PuruPuruAllInfoPacket.Info.AreaCode = -1;
-    PuruPuruAllInfoPacket.Info.ConnectorDirection = 0;
-    strncpy(PuruPuruAllInfoPacket.Info.ProductName, "Puru Puru Pack                ", sizeof(PuruPuruAllInfoPacket.Info.ProductName));
-    strncpy(PuruPuruAllInfoPacket.Info.ProductLicense,
+    PuruPuruAllInfoPacket[0].BitPairsMinus1 = (sizeof(PuruPuruAllInfoPacket[0]) - 7) * 4 - 1;
+
+    PuruPuruAllInfoPacket[0].Header.Command = CMD_RESPOND_ALL_DEVICE_STATUS;
+    PuruPuruAllInfoPacket[0].Header.Destination = ADDRESS_DREAMCAST;
+    PuruPuruAllInfoPacket[0].Header.Origin = ADDRESS_SUBPERIPHERAL1;
+    PuruPuruAllInfoPacket[0].Header.NumWords = sizeof(PuruPuruAllInfoPacket[0].Info) / sizeof(uint32_t);
+
+    PuruPuruAllInfoPacket[0].Info.Func = __builtin_bswap32(FUNC_VIBRATION);
+    PuruPuruAllInfoPacket[0].Info.FuncData[0] = __builtin_bswap32(0x01010000);
+    PuruPuruAllInfoPacket[0].Info.FuncData[1] = 0;
+    PuruPuruAllInfoPacket[0].Info.FuncData[2] = 0;
+    PuruPuruAllInfoPacket[0].Info.AreaCode = -1;
+    PuruPuruAllInfoPacket[0].Info.ConnectorDirection = 0;
+    strncpy(PuruPuruAllInfoPacket[0].Info.ProductName, "Puru Puru Pack                ", sizeof(PuruPuruAllInfoPacket[0].Info.ProductName));
+    strncpy(PuruPuruAllInfoPacket[0].Info.ProductLicense,
             "Produced By or Under License From SEGA ENTERPRISES,LTD.     ",
-            sizeof(PuruPuruAllInfoPacket.Info.ProductLicense));
-    PuruPuruAllInfoPacket.Info.StandbyPower = 200;
-    PuruPuruAllInfoPacket.Info.MaxPower = 1600;
-    strncpy(PuruPuruAllInfoPacket.Info.FreeDeviceStatus,
+            sizeof(PuruPuruAllInfoPacket[0].Info.ProductLicense));
+    PuruPuruAllInfoPacket[0].Info.StandbyPower = 200;
+    PuruPuruAllInfoPacket[0].Info.MaxPower = 1600;
+    strncpy(PuruPuruAllInfoPacket[0].Info.FreeDeviceStatus,
             "Version 1.000,1998/11/10,315-6211-AH   ,Vibration Motor:1 , Fm:4 - 30Hz ,Pow:7  ",
-            sizeof(PuruPuruAllInfoPacket.Info.FreeDeviceStatus));
+            sizeof(PuruPuruAllInfoPacket[0].Info.FreeDeviceStatus));
 
-    PuruPuruAllInfoPacket.CRC = CalcCRC((uint32_t *)&PuruPuruAllInfoPacket.Header, sizeof(PuruPuruAllInfoPacket) / sizeof(uint32_t) - 2);
+    PuruPuruAllInfoPacket[0].CRC = CalcCRC((uint32_t *)&PuruPuruAllInfoPacket[0].Header, sizeof(PuruPuruAllInfoPacket[0]) / sizeof(uint32_t) - 2);
+    StampPorts(PuruPuruAllInfoPacket, sizeof(PuruPuruAllInfoPacket[0]));
 }
 
 static void BuildPuruPuruDeviceInfoPacket(void)
 {
-    PuruPuruDeviceInfoPacket.BitPairsMinus1 = (sizeof(PuruPuruDeviceInfoPacket) - 7) * 4 - 1;
+    PuruPuruDeviceInfoPacket[0].BitPairsMinus1 = (sizeof(PuruPuruDeviceInfoPacket[0]) - 7) * 4 - 1;
 
-    PuruPuruDeviceInfoPacket.Header.Command = CMD_RESPOND_DEVICE_STATUS;
-    PuruPuruDeviceInfoPacket.Header.Destination = ADDRESS_DREAMCAST;
-    PuruPuruDeviceInfoPacket.Header.Origin = ADDRESS_SUBPERIPHERAL1;
-    PuruPuruDeviceInfoPacket.Header.NumWords = sizeof(PuruPuruDeviceInfoPacket.Info) / sizeof(uint32_t);
+    PuruPuruDeviceInfoPacket[0].Header.Command = CMD_RESPOND_DEVICE_STATUS;
+    PuruPuruDeviceInfoPacket[0].Header.Destination = ADDRESS_DREAMCAST;
+    PuruPuruDeviceInfoPacket[0].Header.Origin = ADDRESS_SUBPERIPHERAL1;
+    PuruPuruDeviceInfoPacket[0].Header.NumWords = sizeof(PuruPuruDeviceInfoPacket[0].Info) / sizeof(uint32_t);
 
     // Puru Puru Pack device info
-    PuruPuruDeviceInfoPacket.Info.Func = __builtin_bswap32(FUNC_VIBRATION);  // 0x100
-    PuruPuruDeviceInfoPacket.Info.FuncData[0] = __builtin_bswap32(0x01010000);  // Vibration function data
-    PuruPuruDeviceInfoPacket.Info.FuncData[1] = 0;
-    PuruPuruDeviceInfoPacket.Info.FuncData[2] = 0;
-    PuruPuruDeviceInfoPacket.Info.AreaCode = -1;  // All regions
-    PuruPuruDeviceInfoPacket.Info.ConnectorDirection = 0;
-    strncpy(PuruPuruDeviceInfoPacket.Info.ProductName, "Puru Puru Pack                ", sizeof(PuruPuruDeviceInfoPacket.Info.ProductName));
-    strncpy(PuruPuruDeviceInfoPacket.Info.ProductLicense,
+    PuruPuruDeviceInfoPacket[0].Info.Func = __builtin_bswap32(FUNC_VIBRATION);  // 0x100
+    PuruPuruDeviceInfoPacket[0].Info.FuncData[0] = __builtin_bswap32(0x01010000);  // Vibration function data
+    PuruPuruDeviceInfoPacket[0].Info.FuncData[1] = 0;
+    PuruPuruDeviceInfoPacket[0].Info.FuncData[2] = 0;
+    PuruPuruDeviceInfoPacket[0].Info.AreaCode = -1;  // All regions
+    PuruPuruDeviceInfoPacket[0].Info.ConnectorDirection = 0;
+    strncpy(PuruPuruDeviceInfoPacket[0].Info.ProductName, "Puru Puru Pack                ", sizeof(PuruPuruDeviceInfoPacket[0].Info.ProductName));
+    strncpy(PuruPuruDeviceInfoPacket[0].Info.ProductLicense,
             "Produced By or Under License From SEGA ENTERPRISES,LTD.     ",
-            sizeof(PuruPuruDeviceInfoPacket.Info.ProductLicense));
-    PuruPuruDeviceInfoPacket.Info.StandbyPower = 200;
-    PuruPuruDeviceInfoPacket.Info.MaxPower = 1600;
+            sizeof(PuruPuruDeviceInfoPacket[0].Info.ProductLicense));
+    PuruPuruDeviceInfoPacket[0].Info.StandbyPower = 200;
+    PuruPuruDeviceInfoPacket[0].Info.MaxPower = 1600;
 
-    PuruPuruDeviceInfoPacket.CRC = CalcCRC((uint32_t *)&PuruPuruDeviceInfoPacket.Header, sizeof(PuruPuruDeviceInfoPacket) / sizeof(uint32_t) - 2);
+    PuruPuruDeviceInfoPacket[0].CRC = CalcCRC((uint32_t *)&PuruPuruDeviceInfoPacket[0].Header, sizeof(PuruPuruDeviceInfoPacket[0]) / sizeof(uint32_t) - 2);
+    StampPorts(PuruPuruDeviceInfoPacket, sizeof(PuruPuruDeviceInfoPacket[0]));
 }
 
 static void BuildPuruPuruInfoPacket(void)
 {
-    PuruPuruInfoPacket.BitPairsMinus1 = (sizeof(PuruPuruInfoPacket) - 7) * 4 - 1;
+    PuruPuruInfoPacket[0].BitPairsMinus1 = (sizeof(PuruPuruInfoPacket[0]) - 7) * 4 - 1;
 
-    PuruPuruInfoPacket.Header.Command = CMD_RESPOND_DATA_TRANSFER;
-    PuruPuruInfoPacket.Header.Destination = ADDRESS_DREAMCAST;
-    PuruPuruInfoPacket.Header.Origin = ADDRESS_SUBPERIPHERAL1;
-    PuruPuruInfoPacket.Header.NumWords = sizeof(PuruPuruInfoPacket.Info) / sizeof(uint32_t);
+    PuruPuruInfoPacket[0].Header.Command = CMD_RESPOND_DATA_TRANSFER;
+    PuruPuruInfoPacket[0].Header.Destination = ADDRESS_DREAMCAST;
+    PuruPuruInfoPacket[0].Header.Origin = ADDRESS_SUBPERIPHERAL1;
+    PuruPuruInfoPacket[0].Header.NumWords = sizeof(PuruPuruInfoPacket[0].Info) / sizeof(uint32_t);
 
-    PuruPuruInfoPacket.Info.Func = __builtin_bswap32(FUNC_VIBRATION);
+    PuruPuruInfoPacket[0].Info.Func = __builtin_bswap32(FUNC_VIBRATION);
     // VSet0: upper nybble = 1 vibration source, lower = 0 (location/axis)
-    PuruPuruInfoPacket.Info.VSet0 = 0x10;
+    PuruPuruInfoPacket[0].Info.VSet0 = 0x10;
     // VSet1: b7=Variable intensity, b6=Continuous, b5=Direction control
-    PuruPuruInfoPacket.Info.VSet1 = 0xE0;
+    PuruPuruInfoPacket[0].Info.VSet1 = 0xE0;
     // FMin/FMax: supported frequency range (0x07-0x3B Hz)
-    PuruPuruInfoPacket.Info.FMin = 0x07;
-    PuruPuruInfoPacket.Info.FMax = 0x3B;
+    PuruPuruInfoPacket[0].Info.FMin = 0x07;
+    PuruPuruInfoPacket[0].Info.FMax = 0x3B;
 
-    PuruPuruInfoPacket.CRC = CalcCRC((uint32_t *)&PuruPuruInfoPacket.Header, sizeof(PuruPuruInfoPacket) / sizeof(uint32_t) - 2);
+    PuruPuruInfoPacket[0].CRC = CalcCRC((uint32_t *)&PuruPuruInfoPacket[0].Header, sizeof(PuruPuruInfoPacket[0]) / sizeof(uint32_t) - 2);
+    StampPorts(PuruPuruInfoPacket, sizeof(PuruPuruInfoPacket[0]));
 }
 
 static void BuildPuruPuruConditionPacket(void)
 {
-    PuruPuruConditionPacket.BitPairsMinus1 = (sizeof(PuruPuruConditionPacket) - 7) * 4 - 1;
+    PuruPuruConditionPacket[0].BitPairsMinus1 = (sizeof(PuruPuruConditionPacket[0]) - 7) * 4 - 1;
 
-    PuruPuruConditionPacket.Header.Command = CMD_RESPOND_DATA_TRANSFER;
-    PuruPuruConditionPacket.Header.Destination = ADDRESS_DREAMCAST;
-    PuruPuruConditionPacket.Header.Origin = ADDRESS_SUBPERIPHERAL1;
-    PuruPuruConditionPacket.Header.NumWords = sizeof(PuruPuruConditionPacket.Condition) / sizeof(uint32_t);
+    PuruPuruConditionPacket[0].Header.Command = CMD_RESPOND_DATA_TRANSFER;
+    PuruPuruConditionPacket[0].Header.Destination = ADDRESS_DREAMCAST;
+    PuruPuruConditionPacket[0].Header.Origin = ADDRESS_SUBPERIPHERAL1;
+    PuruPuruConditionPacket[0].Header.NumWords = sizeof(PuruPuruConditionPacket[0].Condition) / sizeof(uint32_t);
 
-    PuruPuruConditionPacket.Condition.Func = __builtin_bswap32(FUNC_VIBRATION);
-    PuruPuruConditionPacket.Condition.Ctrl = 0x00;
-    PuruPuruConditionPacket.Condition.Power = 0x00;
-    PuruPuruConditionPacket.Condition.Freq = 0x00;
-    PuruPuruConditionPacket.Condition.Inc = 0x00;
+    PuruPuruConditionPacket[0].Condition.Func = __builtin_bswap32(FUNC_VIBRATION);
+    PuruPuruConditionPacket[0].Condition.Ctrl = 0x00;
+    PuruPuruConditionPacket[0].Condition.Power = 0x00;
+    PuruPuruConditionPacket[0].Condition.Freq = 0x00;
+    PuruPuruConditionPacket[0].Condition.Inc = 0x00;
 
-    PuruPuruConditionPacket.CRC = CalcCRC((uint32_t *)&PuruPuruConditionPacket.Header, sizeof(PuruPuruConditionPacket) / sizeof(uint32_t) - 2);
+    PuruPuruConditionPacket[0].CRC = CalcCRC((uint32_t *)&PuruPuruConditionPacket[0].Header, sizeof(PuruPuruConditionPacket[0]) / sizeof(uint32_t) - 2);
+    StampPorts(PuruPuruConditionPacket, sizeof(PuruPuruConditionPacket[0]));
 }
 
 static void BuildPuruPuruBlockReadPacket(void)
 {
-    PuruPuruBlockReadPacket.BitPairsMinus1 = (sizeof(PuruPuruBlockReadPacket) - 7) * 4 - 1;
+    PuruPuruBlockReadPacket[0].BitPairsMinus1 = (sizeof(PuruPuruBlockReadPacket[0]) - 7) * 4 - 1;
 
-    PuruPuruBlockReadPacket.Header.Command = CMD_RESPOND_DATA_TRANSFER;
-    PuruPuruBlockReadPacket.Header.Destination = ADDRESS_DREAMCAST;
-    PuruPuruBlockReadPacket.Header.Origin = ADDRESS_SUBPERIPHERAL1;
-    PuruPuruBlockReadPacket.Header.NumWords = sizeof(PuruPuruBlockReadPacket.BlockRead) / sizeof(uint32_t);
+    PuruPuruBlockReadPacket[0].Header.Command = CMD_RESPOND_DATA_TRANSFER;
+    PuruPuruBlockReadPacket[0].Header.Destination = ADDRESS_DREAMCAST;
+    PuruPuruBlockReadPacket[0].Header.Origin = ADDRESS_SUBPERIPHERAL1;
+    PuruPuruBlockReadPacket[0].Header.NumWords = sizeof(PuruPuruBlockReadPacket[0].BlockRead) / sizeof(uint32_t);
 
-    PuruPuruBlockReadPacket.BlockRead.Func = __builtin_bswap32(FUNC_VIBRATION);
-    PuruPuruBlockReadPacket.BlockRead.Address = 0;
-    memcpy(PuruPuruBlockReadPacket.BlockRead.Data, purupuru_ast, sizeof(PuruPuruBlockReadPacket.BlockRead.Data));
+    PuruPuruBlockReadPacket[0].BlockRead.Func = __builtin_bswap32(FUNC_VIBRATION);
+    PuruPuruBlockReadPacket[0].BlockRead.Address = 0;
+    memcpy(PuruPuruBlockReadPacket[0].BlockRead.Data, purupuru_ast, sizeof(PuruPuruBlockReadPacket[0].BlockRead.Data));
 
-    PuruPuruBlockReadPacket.CRC = CalcCRC((uint32_t *)&PuruPuruBlockReadPacket.Header, sizeof(PuruPuruBlockReadPacket) / sizeof(uint32_t) - 2);
+    PuruPuruBlockReadPacket[0].CRC = CalcCRC((uint32_t *)&PuruPuruBlockReadPacket[0].Header, sizeof(PuruPuruBlockReadPacket[0]) / sizeof(uint32_t) - 2);
+    StampPorts(PuruPuruBlockReadPacket, sizeof(PuruPuruBlockReadPacket[0]));
 }
 
-static void BuildControllerPacket(void)
+// Assemble a complete per-port controller condition set from dc_state[0] into
+// a free buffer and publish it. Core 0 only — called at init, when input
+// changes and when the advertised address changes.
+static void BuildConditionPackets(void)
 {
-    ControllerPacket.BitPairsMinus1 = (sizeof(ControllerPacket) - 7) * 4 - 1;
-
-    ControllerPacket.Header.Command = CMD_RESPOND_DATA_TRANSFER;
-    ControllerPacket.Header.Destination = ADDRESS_DREAMCAST;
-    ControllerPacket.Header.Origin = ADDRESS_CONTROLLER_AND_SUBS;  // Include sub-peripheral bits
-    ControllerPacket.Header.NumWords = sizeof(ControllerPacket.Controller) / sizeof(uint32_t);
-
-    ControllerPacket.Controller.Condition = __builtin_bswap32(FUNC_CONTROLLER);
-    ControllerPacket.Controller.Buttons = 0xFFFF;  // All released
-    ControllerPacket.Controller.RightTrigger = 0;
-    ControllerPacket.Controller.LeftTrigger = 0;
-    ControllerPacket.Controller.JoyX = 128;
-    ControllerPacket.Controller.JoyY = 128;
-    ControllerPacket.Controller.JoyX2 = 128;
-    ControllerPacket.Controller.JoyY2 = 128;
-
-    ControllerPacket.CRC = CalcCRC((uint32_t *)&ControllerPacket.Header, sizeof(ControllerPacket) / sizeof(uint32_t) - 2);
+    uint8_t buf = 0;
+    while (buf == condition_ready || buf == condition_sending) {
+        buf++;
+    }
+
+    FControllerPacket *Slots = ControllerPacket[buf];
+    Slots[0].BitPairsMinus1 = (sizeof(Slots[0]) - 7) * 4 - 1;
+
+    Slots[0].Header.Command = CMD_RESPOND_DATA_TRANSFER;
+    Slots[0].Header.Destination = ADDRESS_DREAMCAST;
+    Slots[0].Header.Origin = ADDRESS_CONTROLLER_AND_SUBS;  // Include sub-peripheral bits
+    Slots[0].Header.NumWords = sizeof(Slots[0].Controller) / sizeof(uint32_t);
+
+    Slots[0].Controller.Condition = __builtin_bswap32(FUNC_CONTROLLER);
+    Slots[0].Controller.Buttons = dc_state[0].buttons;
+    Slots[0].Controller.RightTrigger = dc_state[0].rt;
+    Slots[0].Controller.LeftTrigger = dc_state[0].lt;
+    Slots[0].Controller.JoyX = dc_state[0].joy_x;
+    Slots[0].Controller.JoyY = dc_state[0].joy_y;
+    Slots[0].Controller.JoyX2 = dc_state[0].joy2_x;
+    Slots[0].Controller.JoyY2 = dc_state[0].joy2_y;
+
+    SealPacket(&Slots[0], sizeof(Slots[0]));
+    StampPorts(Slots, sizeof(Slots[0]));
+
+    __dmb();  // Buffer contents visible before it is published
+    condition_ready = buf;
 }
 
 static void BuildACKPacket(void)
 {
-    ACKPacket.BitPairsMinus1 = (sizeof(ACKPacket) - 7) * 4 - 1;
+    ACKPacket[0].BitPairsMinus1 = (sizeof(ACKPacket[0]) - 7) * 4 - 1;
 
-    ACKPacket.Header.Command = CMD_RESPOND_COMMAND_ACK;
-    ACKPacket.Header.Destination = ADDRESS_DREAMCAST;
-    ACKPacket.Header.Origin = ADDRESS_CONTROLLER;
-    ACKPacket.Header.NumWords = 0;
+    ACKPacket[0].Header.Command = CMD_RESPOND_COMMAND_ACK;
+    ACKPacket[0].Header.Destination = ADDRESS_DREAMCAST;
+    ACKPacket[0].Header.Origin = ADDRESS_CONTROLLER;
+    ACKPacket[0].Header.NumWords = 0;
 
-    ACKPacket.CRC = CalcCRC((uint32_t *)&ACKPacket.Header, sizeof(ACKPacket) / sizeof(uint32_t) - 2);
+    ACKPacket[0].CRC = CalcCRC((uint32_t *)&ACKPacket[0].Header, sizeof(ACKPacket[0]) / sizeof(uint32_t) - 2);
+    StampPorts(ACKPacket, sizeof(ACKPacket[0]));
+}
+
+static void BuildPuruPuruACKPacket(void)
+{
+    PuruPuruACKPacket[0] = ACKPacket[0];
+    PuruPuruACKPacket[0].Header.Origin = ADDRESS_SUBPERIPHERAL1;
+    SealPacket(&PuruPuruACKPacket[0], sizeof(PuruPuruACKPacket[0]));
+    StampPorts(PuruPuruACKPacket, sizeof(PuruPuruACKPacket[0]));
+}
+
+#ifdef CONFIG_VMU
+// Copy a per-port packet set, replacing the peripheral bits of Origin
+static void CopyPortsWithOrigin(void *Dst, const void *Src, uint32_t Size, uint8_t Origin)
+{
+    memcpy(Dst, Src, Size * MAPLE_PORTS);
+    for (uint32_t port = 0; port < MAPLE_PORTS; port++) {
+        uint8_t *Slot = (uint8_t *)Dst + port * Size;
+        PacketHeader *Header = (PacketHeader *)(Slot + sizeof(uint32_t));
+        Header->Origin = Origin | (port << ADDRESS_PORT_SHIFT);
+        SealPacket(Slot, Size);
+    }
 }
+#endif
 
 #ifdef CONFIG_VMU
 // Enable VMU advertisement — call once VMU is ready to respond
@@ -554,11 +661,12 @@ static void BuildACKPacket(void)
 void dreamcast_enable_vmu(void)
 {
     // Switch to pre-built VMU versions atomically
-    pInfoPacket = &InfoPacket_vmu;
-    pAllInfoPacket = &AllInfoPacket_vmu;
-    pControllerPacket = &ControllerPacket_vmu;
-    pACKPacket = &ACKPacket_vmu;
+    pInfoPacket = InfoPacket_vmu;
+    pAllInfoPacket = AllInfoPacket_vmu;
+    pACKPacket = ACKPacket_vmu;
     current_controller_address = ADDRESS_CONTROLLER_AND_VMU;
+    // Condition packets are double-buffered already; publish a set with the new origin
+    BuildConditionPackets();
     printf("[DC] VMU advertisement enabled (addr 0x%02X)\n", current_controller_address);
 }
 #endif
@@ -567,13 +675,10 @@ void dreamcast_enable_vmu(void)
 // PACKET SENDING
 // ============================================================================
 
+// Packets are pre-serialized per port (and VMU packets use fixed addresses —
+// a real VMU always responds with src=0x01), so they go out unmodified
 static void __not_in_flash_func(SendPacket)(const uint32_t *Words, uint32_t NumWords)
 {
-    // Fix port number in header (doesn't change CRC as same on Origin and Destination)
-    PacketHeader *Header = (PacketHeader *)(Words + 1);
-    Header->Origin = (Header->Origin & ADDRESS_PERIPHERAL_MASK) | (((PacketHeader *)Packet)->Origin & ADDRESS_PORT_MASK);
-    Header->Destination = (Header->Destination & ADDRESS_PERIPHERAL_MASK) | (((PacketHeader *)Packet)->Origin & ADDRESS_PORT_MASK);
-
     // Wait for any previous DMA to complete first
     while (dma_channel_is_busy(tx_dma_channel)) {
         tight_loop_contents();
@@ -583,32 +688,108 @@ static void __not_in_flash_func(SendPacket)(const uint32_t *Words, uint32_t NumW
     dma_channel_set_trans_count(tx_dma_channel, NumWords, true);
 }
 
-// VMU packets use fixed addresses — don't patch port bits
-// Real VMU always responds with src=0x01 (no port bits)
-static void __not_in_flash_func(SendPacketVMU)(const uint32_t *Words, uint32_t NumWords)
+static void __not_in_flash_func(SendControllerStatus)(uint8_t Port)
 {
-    while (dma_channel_is_busy(tx_dma_channel)) {
-        tight_loop_contents();
-    }
-    dma_channel_set_read_addr(tx_dma_channel, Words, false);
-    dma_channel_set_trans_count(tx_dma_channel, NumWords, true);
+    // Claim the published buffer. Re-check after claiming: if Core 0
+    // published a newer one in between, it may already be rewriting the
+    // buffer we read, so take the new one instead.
+    uint8_t buf;
+    do {
+        buf = condition_ready;
+        condition_sending = buf;
+        __dmb();
+    } while (buf != condition_ready);
+
+    SendPacket((uint32_t *)&ControllerPacket[buf][Port], sizeof(FControllerPacket) / sizeof(uint32_t));
 }
 
-static void __not_in_flash_func(SendControllerStatus)(void)
+#ifdef CONFIG_VMU
+static void __not_in_flash_func(SendVMUPacket)(const void *(*Get)(uint32_t *))
 {
-    // Update controller state via pointer — works for both controller-only and VMU versions
-    pControllerPacket->Controller.Buttons = dc_state[0].buttons;
-    pControllerPacket->Controller.RightTrigger = dc_state[0].rt;
-    pControllerPacket->Controller.LeftTrigger = dc_state[0].lt;
-    pControllerPacket->Controller.JoyX = dc_state[0].joy_x;
-    pControllerPacket->Controller.JoyY = dc_state[0].joy_y;
-    pControllerPacket->Controller.JoyX2 = dc_state[0].joy2_x;
-    pControllerPacket->Controller.JoyY2 = dc_state[0].joy2_y;
-
-    // Recalculate CRC
-    pControllerPacket->CRC = CalcCRC((uint32_t *)&pControllerPacket->Header, sizeof(ControllerPacket) / sizeof(uint32_t) - 2);
-
-    SendPacket((uint32_t *)pControllerPacket, sizeof(ControllerPacket) / sizeof(uint32_t));
+    uint32_t sz;
+    const void *pkt = Get(&sz);
+    SendPacket((uint32_t *)pkt, sz);
+}
+
+// Info sent alongside the controller's own answers the port it was asked on
+// (doesn't change CRC as same on Origin and Destination)
+static void __not_in_flash_func(SendVMUPacketOnPort)(const void *(*Get)(uint32_t *), uint8_t Port)
+{
+    uint32_t sz;
+    uint32_t *Words = (uint32_t *)Get(&sz);
+    PacketHeader *Header = (PacketHeader *)(Words + 1);
+    Header->Origin = (Header->Origin & ADDRESS_PERIPHERAL_MASK) | (Port << ADDRESS_PORT_SHIFT);
+    Header->Destination = (Header->Destination & ADDRESS_PERIPHERAL_MASK) | (Port << ADDRESS_PORT_SHIFT);
+    SendPacket(Words, sz);
+}
+#endif
+
+// Send the response selected by ConsumePacket()
+static void __not_in_flash_func(SendResponse)(ESendState What, uint8_t Port)
+{
+    switch (What) {
+    case SEND_CONTROLLER_INFO:
+        SendPacket((uint32_t *)&pInfoPacket[Port], sizeof(FInfoPacket) / sizeof(uint32_t));
+        break;
+    case SEND_CONTROLLER_ALL_INFO:
+        SendPacket((uint32_t *)&pAllInfoPacket[Port], sizeof(FAllInfoPacket) / sizeof(uint32_t));
+        break;
+    case SEND_CONTROLLER_STATUS:
+        SendControllerStatus(Port);
+        break;
+    case SEND_ACK:
+        SendPacket((uint32_t *)&pACKPacket[Port], sizeof(FACKPacket) / sizeof(uint32_t));
+        break;
+    case SEND_PURUPURU_ACK:
+        SendPacket((uint32_t *)&PuruPuruACKPacket[Port], sizeof(FACKPacket) / sizeof(uint32_t));
+        break;
+    case SEND_PURUPURU_INFO:
+        SendPacket((uint32_t *)&PuruPuruDeviceInfoPacket[Port], sizeof(FPuruPuruDeviceInfoPacket) / sizeof(uint32_t));
+        break;
+    case SEND_PURUPURU_ALL_INFO:
+        SendPacket((uint32_t *)&PuruPuruAllInfoPacket[Port], sizeof(FAllInfoPacket) / sizeof(uint32_t));
+        break;
+    case SEND_PURUPURU_MEDIA_INFO:
+        SendPacket((uint32_t *)&PuruPuruInfoPacket[Port], sizeof(FPuruPuruInfoPacket) / sizeof(uint32_t));
+        break;
+    case SEND_PURUPURU_CONDITION:
+        SendPacket((uint32_t *)&PuruPuruConditionPacket[Port], sizeof(FPuruPuruConditionPacket) / sizeof(uint32_t));
+        break;
+    case SEND_PURUPURU_BLOCK_READ:
+        SendPacket((uint32_t *)&PuruPuruBlockReadPacket[Port], sizeof(FPuruPuruBlockReadPacket) / sizeof(uint32_t));
+        break;
+#ifdef CONFIG_VMU
+    case SEND_VMU_INFO:
+        SendVMUPacket(vmu_get_device_info_packet);
+        break;
+    case SEND_VMU_ALL_INFO:
+        SendVMUPacket(vmu_get_all_device_info_packet);
+        break;
+    case SEND_VMU_MEDIA_INFO:
+        SendVMUPacket(vmu_get_media_info_packet);
+        break;
+    case SEND_VMU_BLOCK_READ:
+        SendVMUPacket(vmu_get_block_read_packet);
+        break;
+    // WR_COMPLETE ACK — must use VMU ACK (origin=0x01), not controller ACK
+    case SEND_VMU_ACK:
+    case SEND_VMU_WRITE_COMPLETE_ACK:
+        SendVMUPacket(vmu_get_ack_packet);
+        break;
+    // Send controller info first, then VMU info back-to-back
+    // SendPacket() waits for DMA internally so these sequence correctly
+    case SEND_CONTROLLER_AND_VMU_INFO:
+        SendPacket((uint32_t *)&pInfoPacket[Port], sizeof(FInfoPacket) / sizeof(uint32_t));
+        SendVMUPacketOnPort(vmu_get_device_info_packet, Port);
+        break;
+    case SEND_CONTROLLER_AND_VMU_ALL_INFO:
+        SendPacket((uint32_t *)&pAllInfoPacket[Port], sizeof(FAllInfoPacket) / sizeof(uint32_t));
+        SendVMUPacketOnPort(vmu_get_all_device_info_packet, Port);
+        break;
+#endif
+    default:
+        break;
+    }
 }
 
 // ============================================================================
@@ -641,8 +822,9 @@ static bool __not_in_flash_func(ConsumePacket)(uint32_t Size)
         return false;
     }
 
-    // Mask off port number
+    // Mask off port number; the response is the pre-built copy for that port
     uint8_t DestPeripheral = Header->Destination & ADDRESS_PERIPHERAL_MASK;
+    NextPacketPort = MAPLE_PORT(Header->Origin);
 
     // Handle main controller requests (address 0x20)
     if (DestPeripheral == ADDRESS_CONTROLLER) {
@@ -744,9 +926,7 @@ static bool __not_in_flash_func(ConsumePacket)(uint32_t Size)
     else if (DestPeripheral == ADDRESS_SUBPERIPHERAL1) {
         switch (Header->Command) {
         case CMD_RESET_DEVICE:
-            ACKPacket.Header.Origin = ADDRESS_SUBPERIPHERAL1;
-            ACKPacket.CRC = CalcCRC((uint32_t *)&ACKPacket.Header, sizeof(ACKPacket) / sizeof(uint32_t) - 2);
-            NextPacketSend = SEND_ACK;
+            NextPacketSend = SEND_PURUPURU_ACK;
             return true;
 
         case CMD_DEVICE_REQUEST:
@@ -766,12 +946,6 @@ static bool __not_in_flash_func(ConsumePacket)(uint32_t Size)
             if (Header->NumWords >= 1) {
                 uint32_t Func = __builtin_bswap32(PacketData[0]);
                 if (Func == FUNC_VIBRATION) {
-                    PuruPuruConditionPacket.Condition.Ctrl  = purupuru_ctrl[0];
-                    PuruPuruConditionPacket.Condition.Power = purupuru_power[0];
-                    PuruPuruConditionPacket.Condition.Freq  = purupuru_freq[0];
-                    PuruPuruConditionPacket.Condition.Inc   = purupuru_inc[0];
-                    PuruPuruConditionPacket.CRC = CalcCRC((uint32_t *)&PuruPuruConditionPacket.Header,
-                        sizeof(PuruPuruConditionPacket) / sizeof(uint32_t) - 2);
                     NextPacketSend = SEND_PURUPURU_CONDITION;
                     return true;
                 }
@@ -791,9 +965,18 @@ static bool __not_in_flash_func(ConsumePacket)(uint32_t Size)
                                      (purupuru_freq[0] >= 0x07) &&
                                      (purupuru_freq[0] <= 0x3B);
                     last_rumble_time[0] = rumble_on ? (time_us_32() / 1000) : 0;
-                    ACKPacket.Header.Origin = ADDRESS_SUBPERIPHERAL1;
-                    ACKPacket.CRC = CalcCRC((uint32_t *)&ACKPacket.Header, sizeof(ACKPacket) / sizeof(uint32_t) - 2);
-                    NextPacketSend = SEND_ACK;
+                    // Hand the new level to Core 0 (no-op if unchanged)
+                    uint8_t level = rumble_on ? dc_rumble_level(purupuru_power[0]) : 0;
+                    feedback_console_post(0, level, level);
+                    // Keep the GET_CONDITION answer current for every port
+                    for (uint8_t port = 0; port < MAPLE_PORTS; port++) {
+                        PuruPuruConditionPacket[port].Condition.Ctrl  = purupuru_ctrl[0];
+                        PuruPuruConditionPacket[port].Condition.Power = purupuru_power[0];
+                        PuruPuruConditionPacket[port].Condition.Freq  = purupuru_freq[0];
+                        PuruPuruConditionPacket[port].Condition.Inc   = purupuru_inc[0];
+                        SealPacket(&PuruPuruConditionPacket[port], sizeof(FPuruPuruConditionPacket));
+                    }
+                    NextPacketSend = SEND_PURUPURU_ACK;
                     return true;
                 }
             }
@@ -811,9 +994,7 @@ static bool __not_in_flash_func(ConsumePacket)(uint32_t Size)
                     bytes_to_copy = sizeof(purupuru_ast);
                 memcpy(purupuru_ast, WriteData, bytes_to_copy);
             }
-            ACKPacket.Header.Origin = ADDRESS_SUBPERIPHERAL1;
-            ACKPacket.CRC = CalcCRC((uint32_t *)&ACKPacket.Header, sizeof(ACKPacket) / sizeof(uint32_t) - 2);
-            NextPacketSend = SEND_ACK;
+            NextPacketSend = SEND_PURUPURU_ACK;
             return true;
 
         default:
@@ -867,10 +1048,18 @@ static uint16_t map_buttons_to_dc(uint32_t jp_buttons)
 // OUTPUT UPDATE
 // ============================================================================
 
+static bool dc_state_equal(const dc_controller_state_t *a, const dc_controller_state_t *b)
+{
+    return a->buttons == b->buttons && a->rt == b->rt && a->lt == b->lt &&
+           a->joy_x == b->joy_x && a->joy_y == b->joy_y &&
+           a->joy2_x == b->joy2_x && a->joy2_y == b->joy2_y;
+}
+
 void __not_in_flash_func(dreamcast_update_output)(void)
 {
     // Only update state if there's new input - router clears updated flag after read
     // so we must not call this too frequently or we'll miss updates
+    bool changed = false;
     for (int port = 0; port < MAX_PLAYERS; port++) {
         const input_event_t *event = router_get_output(OUTPUT_TARGET_DREAMCAST, port);
         if (!event || event->type == INPUT_TYPE_NONE) {
@@ -879,11 +1068,12 @@ void __not_in_flash_func(dreamcast_update_output)(void)
         }
 
         // New input available - update state
-        dc_state[port].buttons = map_buttons_to_dc(event->buttons);
-        dc_state[port].joy_x = event->analog[ANALOG_LX];
-        dc_state[port].joy_y = event->analog[ANALOG_LY];
-        dc_state[port].joy2_x = event->analog[ANALOG_RX];
-        dc_state[port].joy2_y = event->analog[ANALOG_RY];
+        dc_controller_state_t state;
+        state.buttons = map_buttons_to_dc(event->buttons);
+        state.joy_x = event->analog[ANALOG_LX];
+        state.joy_y = event->analog[ANALOG_LY];
+        state.joy2_x = event->analog[ANALOG_RX];
+        state.joy2_y = event->analog[ANALOG_RY];
 
         // L trigger: pass the analog level through. Only force full from the
         // digital L2 bit when there's no analog data (a digital-only pad whose
@@ -892,12 +1082,23 @@ void __not_in_flash_func(dreamcast_update_output)(void)
         // full the instant it's touched.
         uint8_t lt = event->analog[ANALOG_L2];
         if ((event->buttons & JP_BUTTON_L2) && lt == 0) lt = 255;
-        dc_state[port].lt = lt;
+        state.lt = lt;
 
         // R trigger: same rule.
         uint8_t rt = event->analog[ANALOG_R2];
         if ((event->buttons & JP_BUTTON_R2) && rt == 0) rt = 255;
-        dc_state[port].rt = rt;
+        state.rt = rt;
+
+        if (port == 0 && !dc_state_equal(&dc_state[0], &state)) {
+            changed = true;
+        }
+        dc_state[port] = state;
+    }
+
+    // The condition response only carries port 0 — rebuild it off the
+    // response path, and only when it actually changed
+    if (changed) {
+        BuildConditionPackets();
     }
 }
 
@@ -969,8 +1170,13 @@ static void __no_inline_not_in_flash_func(core1_rx_task)(void)
 
     while (true) {
         // Wait for data from RX PIO
-        while ((RXPIO->fstat & (1u << PIO_FSTAT_RXEMPTY_LSB)) != 0)
-            ;
+        while ((RXPIO->fstat & (1u << PIO_FSTAT_RXEMPTY_LSB)) != 0) {
+#ifdef CONFIG_DC_CORE1_TX
+            // Idle between bytes: the only time Core 1 can notice the
+            // console stopped sending rumble commands
+            dc_rumble_timeout_check();
+#endif
+        }
 
         const uint8_t Value = RXPIO->rxf[0];
         rx_bytes_count++;
@@ -1027,95 +1233,9 @@ static void __no_inline_not_in_flash_func(core1_rx_task)(void)
                 // sending for at most one 16.7ms DC poll frame.
                 if (NextPacketSend != SEND_NOTHING && !maple_tx_pause) {
                     tx_sent_count++;
-                    switch (NextPacketSend) {
-                        case SEND_CONTROLLER_INFO:
-                            SendPacket((uint32_t *)pInfoPacket, sizeof(InfoPacket) / sizeof(uint32_t));
-                            break;
-                        case SEND_CONTROLLER_ALL_INFO:
-                            SendPacket((uint32_t *)pAllInfoPacket, sizeof(AllInfoPacket) / sizeof(uint32_t));
-                            break;
-                        case SEND_CONTROLLER_STATUS:
-                            SendControllerStatus();
-                            break;
-                        case SEND_ACK:
-                            SendPacket((uint32_t *)pACKPacket, sizeof(ACKPacket) / sizeof(uint32_t));
-                            break;
-#ifdef CONFIG_VMU
-                        case SEND_VMU_WRITE_COMPLETE_ACK: {
-                            // WR_COMPLETE ACK — must use VMU ACK (origin=0x01), not controller ACK
-                            uint32_t sz;
-                            const void *pkt = vmu_get_ack_packet(&sz);
-                            SendPacketVMU((uint32_t *)pkt, sz);
-                            break;
-                        }
-#endif
-                        case SEND_PURUPURU_INFO:
-                            SendPacket((uint32_t *)&PuruPuruDeviceInfoPacket, sizeof(PuruPuruDeviceInfoPacket) / sizeof(uint32_t));
-                            break;
-                        case SEND_PURUPURU_ALL_INFO:
-                            SendPacket((uint32_t *)&PuruPuruAllInfoPacket, sizeof(PuruPuruAllInfoPacket) / sizeof(uint32_t));
-                            break;
-                        case SEND_PURUPURU_MEDIA_INFO:
-                            SendPacket((uint32_t *)&PuruPuruInfoPacket, sizeof(PuruPuruInfoPacket) / sizeof(uint32_t));
-                            break;
-                        case SEND_PURUPURU_CONDITION:
-                            SendPacket((uint32_t *)&PuruPuruConditionPacket, sizeof(PuruPuruConditionPacket) / sizeof(uint32_t));
-                            break;
-                        case SEND_PURUPURU_BLOCK_READ:
-                            SendPacket((uint32_t *)&PuruPuruBlockReadPacket, sizeof(PuruPuruBlockReadPacket) / sizeof(uint32_t));
-                            break;
-#ifdef CONFIG_VMU
-                        case SEND_VMU_INFO: {
-                            uint32_t sz;
-                            const void *pkt = vmu_get_device_info_packet(&sz);
-                            SendPacketVMU((uint32_t *)pkt, sz);
-                            break;
-                        }
-                        case SEND_VMU_ALL_INFO: {
-                            uint32_t sz;
-                            const void *pkt = vmu_get_all_device_info_packet(&sz);
-                            SendPacketVMU((uint32_t *)pkt, sz);
-                            break;
-                        }
-                        case SEND_VMU_MEDIA_INFO: {
-                            uint32_t sz;
-                            const void *pkt = vmu_get_media_info_packet(&sz);
-                            SendPacketVMU((uint32_t *)pkt, sz);
-                            break;
-                        }
-                        case SEND_VMU_BLOCK_READ: {
-                            uint32_t sz;
-                            const void *pkt = vmu_get_block_read_packet(&sz);
-                            SendPacketVMU((uint32_t *)pkt, sz);
-                            break;
-                        }
-                        case SEND_VMU_ACK: {
-                            uint32_t sz;
-                            const void *pkt = vmu_get_ack_packet(&sz);
-                            SendPacketVMU((uint32_t *)pkt, sz);
-                            break;
-                        }
-                        // Send controller info first, then VMU info back-to-back
-                        // SendPacket() waits for DMA internally so these sequence correctly
-                        case SEND_CONTROLLER_AND_VMU_INFO: {
-                            SendPacket((uint32_t *)pInfoPacket, sizeof(InfoPacket) / sizeof(uint32_t));
-                            uint32_t sz;
-                            const void *pkt = vmu_get_device_info_packet(&sz);
-                            SendPacket((uint32_t *)pkt, sz);
-                            break;
-                        }
-                        case SEND_CONTROLLER_AND_VMU_ALL_INFO: {
-                            SendPacket((uint32_t *)pAllInfoPacket, sizeof(AllInfoPacket) / sizeof(uint32_t));
-                            uint32_t sz;
-                            const void *pkt = vmu_get_all_device_info_packet(&sz);
-                            SendPacket((uint32_t *)pkt, sz);
-                            break;
-                        }
-#endif
-                        default:
-                            break;
-                        }
+                    SendResponse(NextPacketSend, NextPacketPort);
                     NextPacketSend = SEND_NOTHING;
+                    flash_sched_console_polled();
                 }
 #else
                 // Queue packet for Core 0 processing
@@ -1229,8 +1349,9 @@ void dreamcast_init(void)
     // Build pre-built packets
     BuildInfoPacket();
     BuildAllInfoPacket();
-    BuildControllerPacket();
+    BuildConditionPackets();
     BuildACKPacket();
+    BuildPuruPuruACKPacket();
     BuildPuruPuruDeviceInfoPacket();
     BuildPuruPuruAllInfoPacket();
     BuildPuruPuruInfoPacket();
@@ -1248,36 +1369,19 @@ void dreamcast_init(void)
     current_controller_address = ADDRESS_CONTROLLER_ONLY;
     BuildInfoPacket();
     BuildAllInfoPacket();
-    BuildControllerPacket();
+    BuildConditionPackets();
     BuildACKPacket();
 
     // Pre-build VMU versions of packets now — dreamcast_enable_vmu() will
     // atomically switch pointers to these, avoiding any race with Core 1
-    current_controller_address = ADDRESS_CONTROLLER_AND_VMU;
-    // Copy and patch InfoPacket → InfoPacket_vmu
-    InfoPacket_vmu = InfoPacket;
-    InfoPacket_vmu.Header.Origin = ADDRESS_CONTROLLER_AND_VMU;
-    InfoPacket_vmu.CRC = CalcCRC((uint32_t *)&InfoPacket_vmu.Header, sizeof(InfoPacket_vmu) / sizeof(uint32_t) - 2);
-    // Copy and patch AllInfoPacket → AllInfoPacket_vmu
-    AllInfoPacket_vmu = AllInfoPacket;
-    AllInfoPacket_vmu.Header.Origin = ADDRESS_CONTROLLER_AND_VMU;
-    AllInfoPacket_vmu.CRC = CalcCRC((uint32_t *)&AllInfoPacket_vmu.Header, sizeof(AllInfoPacket_vmu) / sizeof(uint32_t) - 2);
-    // Copy and patch ControllerPacket → ControllerPacket_vmu
-    ControllerPacket_vmu = ControllerPacket;
-    ControllerPacket_vmu.Header.Origin = ADDRESS_CONTROLLER_AND_VMU;
-    ControllerPacket_vmu.CRC = CalcCRC((uint32_t *)&ControllerPacket_vmu.Header, sizeof(ControllerPacket_vmu) / sizeof(uint32_t) - 2);
-    // Copy and patch ACKPacket → ACKPacket_vmu
-    ACKPacket_vmu = ACKPacket;
-    ACKPacket_vmu.Header.Origin = ADDRESS_CONTROLLER_AND_VMU;
-    ACKPacket_vmu.CRC = CalcCRC((uint32_t *)&ACKPacket_vmu.Header, sizeof(ACKPacket_vmu) / sizeof(uint32_t) - 2);
-
-    // Restore controller-only address for boot
-    current_controller_address = ADDRESS_CONTROLLER_ONLY;
+    CopyPortsWithOrigin(InfoPacket_vmu, InfoPacket, sizeof(FInfoPacket), ADDRESS_CONTROLLER_AND_VMU);
+    CopyPortsWithOrigin(AllInfoPacket_vmu, AllInfoPacket, sizeof(FAllInfoPacket), ADDRESS_CONTROLLER_AND_VMU);
+    CopyPortsWithOrigin(ACKPacket_vmu, ACKPacket, sizeof(FACKPacket), ADDRESS_CONTROLLER_AND_VMU);
 #else
     // Non-VMU builds: build packets directly with controller + PuruPuru advertisement.
     BuildInfoPacket();
     BuildAllInfoPacket();
-    BuildControllerPacket();
+    BuildConditionPackets();
     BuildACKPacket();
 #endif
 
@@ -1456,178 +1560,15 @@ void dreamcast_task(void)
         // Send response IMMEDIATELY after processing (like MaplePad)
         // Don't wait for DMA - if it's busy, we're already too slow
         if (NextPacketSend != SEND_NOTHING && !dma_channel_is_busy(tx_dma_channel)) {
-            switch (NextPacketSend) {
-            case SEND_CONTROLLER_INFO:
-                SendPacket((uint32_t *)pInfoPacket, sizeof(InfoPacket) / sizeof(uint32_t));
-                break;
-            case SEND_CONTROLLER_ALL_INFO:
-                SendPacket((uint32_t *)pAllInfoPacket, sizeof(AllInfoPacket) / sizeof(uint32_t));
-                break;
-            case SEND_CONTROLLER_STATUS:
-                SendControllerStatus();
-                break;
-            case SEND_ACK:
-                SendPacket((uint32_t *)pACKPacket, sizeof(ACKPacket) / sizeof(uint32_t));
-                break;
-            case SEND_PURUPURU_INFO:
-                SendPacket((uint32_t *)&PuruPuruDeviceInfoPacket, sizeof(PuruPuruDeviceInfoPacket) / sizeof(uint32_t));
-                break;
-            case SEND_PURUPURU_ALL_INFO:
-                SendPacket((uint32_t *)&PuruPuruAllInfoPacket, sizeof(PuruPuruAllInfoPacket) / sizeof(uint32_t));
-                break;
-            case SEND_PURUPURU_MEDIA_INFO:
-                SendPacket((uint32_t *)&PuruPuruInfoPacket, sizeof(PuruPuruInfoPacket) / sizeof(uint32_t));
-                break;
-            case SEND_PURUPURU_CONDITION:
-                SendPacket((uint32_t *)&PuruPuruConditionPacket, sizeof(PuruPuruConditionPacket) / sizeof(uint32_t));
-                break;
-            case SEND_PURUPURU_BLOCK_READ:
-                SendPacket((uint32_t *)&PuruPuruBlockReadPacket, sizeof(PuruPuruBlockReadPacket) / sizeof(uint32_t));
-                break;
-#ifdef CONFIG_VMU
-            case SEND_VMU_INFO: {
-                uint32_t sz;
-                const void *pkt = vmu_get_device_info_packet(&sz);
-                SendPacketVMU((uint32_t *)pkt, sz);
-                break;
-            }
-            case SEND_VMU_ALL_INFO: {
-                uint32_t sz;
-                const void *pkt = vmu_get_all_device_info_packet(&sz);
-                SendPacketVMU((uint32_t *)pkt, sz);
-                break;
-            }
-            case SEND_VMU_MEDIA_INFO: {
-                uint32_t sz;
-                const void *pkt = vmu_get_media_info_packet(&sz);
-                SendPacketVMU((uint32_t *)pkt, sz);
-                break;
-            }
-            case SEND_VMU_BLOCK_READ: {
-                uint32_t sz;
-                const void *pkt = vmu_get_block_read_packet(&sz);
-                SendPacketVMU((uint32_t *)pkt, sz);
-                break;
-            }
-            case SEND_VMU_ACK: {
-                uint32_t sz;
-                const void *pkt = vmu_get_ack_packet(&sz);
-                SendPacketVMU((uint32_t *)pkt, sz);
-                break;
-            }
-            case SEND_VMU_WRITE_COMPLETE_ACK: {
-                uint32_t sz;
-                const void *pkt = vmu_get_ack_packet(&sz);
-                SendPacketVMU((uint32_t *)pkt, sz);
-                break;
-            }
-            case SEND_CONTROLLER_AND_VMU_INFO: {
-                SendPacket((uint32_t *)pInfoPacket, sizeof(InfoPacket) / sizeof(uint32_t));
-                uint32_t sz;
-                const void *pkt = vmu_get_device_info_packet(&sz);
-                SendPacketVMU((uint32_t *)pkt, sz);
-                break;
-            }
-            case SEND_CONTROLLER_AND_VMU_ALL_INFO: {
-                SendPacket((uint32_t *)pAllInfoPacket, sizeof(AllInfoPacket) / sizeof(uint32_t));
-                uint32_t sz;
-                const void *pkt = vmu_get_all_device_info_packet(&sz);
-                SendPacket((uint32_t *)pkt, sz);
-                break;
-            }
-#endif
-            default:
-                break;
-            }
+            SendResponse(NextPacketSend, NextPacketPort);
             NextPacketSend = SEND_NOTHING;
+            flash_sched_console_polled();
         }
     }
 
     // Handle any remaining pending response (shouldn't happen normally)
     if (NextPacketSend != SEND_NOTHING && !dma_channel_is_busy(tx_dma_channel)) {
-        switch (NextPacketSend) {
-        case SEND_CONTROLLER_INFO:
-            SendPacket((uint32_t *)pInfoPacket, sizeof(InfoPacket) / sizeof(uint32_t));
-            break;
-        case SEND_CONTROLLER_ALL_INFO:
-            SendPacket((uint32_t *)pAllInfoPacket, sizeof(AllInfoPacket) / sizeof(uint32_t));
-            break;
-        case SEND_CONTROLLER_STATUS:
-            SendControllerStatus();
-            break;
-        case SEND_ACK:
-            SendPacket((uint32_t *)pACKPacket, sizeof(ACKPacket) / sizeof(uint32_t));
-            break;
-        case SEND_PURUPURU_INFO:
-            SendPacket((uint32_t *)&PuruPuruDeviceInfoPacket, sizeof(PuruPuruDeviceInfoPacket) / sizeof(uint32_t));
-            break;
-        case SEND_PURUPURU_ALL_INFO:
-            SendPacket((uint32_t *)&PuruPuruAllInfoPacket, sizeof(PuruPuruAllInfoPacket) / sizeof(uint32_t));
-            break;
-        case SEND_PURUPURU_MEDIA_INFO:
-            SendPacket((uint32_t *)&PuruPuruInfoPacket, sizeof(PuruPuruInfoPacket) / sizeof(uint32_t));
-            break;
-        case SEND_PURUPURU_CONDITION:
-            SendPacket((uint32_t *)&PuruPuruConditionPacket, sizeof(PuruPuruConditionPacket) / sizeof(uint32_t));
-            break;
-        case SEND_PURUPURU_BLOCK_READ:
-            SendPacket((uint32_t *)&PuruPuruBlockReadPacket, sizeof(PuruPuruBlockReadPacket) / sizeof(uint32_t));
-            break;
-#ifdef CONFIG_VMU
-        case SEND_VMU_INFO: {
-            uint32_t sz;
-            const void *pkt = vmu_get_device_info_packet(&sz);
-            SendPacket((uint32_t *)pkt, sz);
-            break;
-        }
-        case SEND_VMU_ALL_INFO: {
-            uint32_t sz;
-            const void *pkt = vmu_get_all_device_info_packet(&sz);
-            SendPacket((uint32_t *)pkt, sz);
-            break;
-        }
-        case SEND_VMU_MEDIA_INFO: {
-            uint32_t sz;
-            const void *pkt = vmu_get_media_info_packet(&sz);
-            SendPacket((uint32_t *)pkt, sz);
-            break;
-        }
-        case SEND_VMU_BLOCK_READ: {
-            uint32_t sz;
-            const void *pkt = vmu_get_block_read_packet(&sz);
-            SendPacket((uint32_t *)pkt, sz);
-            break;
-        }
-        case SEND_VMU_ACK: {
-            uint32_t sz;
-            const void *pkt = vmu_get_ack_packet(&sz);
-            SendPacket((uint32_t *)pkt, sz);
-            break;
-        }
-        case SEND_VMU_WRITE_COMPLETE_ACK: {
-            uint32_t sz;
-            const void *pkt = vmu_get_ack_packet(&sz);
-            SendPacket((uint32_t *)pkt, sz);
-            break;
-        }
-        case SEND_CONTROLLER_AND_VMU_INFO: {
-            SendPacket((uint32_t *)pInfoPacket, sizeof(InfoPacket) / sizeof(uint32_t));
-            uint32_t sz;
-            const void *pkt = vmu_get_device_info_packet(&sz);
-            SendPacket((uint32_t *)pkt, sz);
-            break;
-        }
-        case SEND_CONTROLLER_AND_VMU_ALL_INFO: {
-            SendPacket((uint32_t *)pAllInfoPacket, sizeof(AllInfoPacket) / sizeof(uint32_t));
-            uint32_t sz;
-            const void *pkt = vmu_get_all_device_info_packet(&sz);
-            SendPacket((uint32_t *)pkt, sz);
-            break;
-        }
-#endif
-        default:
-            break;
-        }
+        SendResponse(NextPacketSend, NextPacketPort);
         NextPacketSend = SEND_NOTHING;
     }
 
@@ -1664,22 +1605,17 @@ void dreamcast_task(void)
     vmu_task();
 #endif
 
-    // Rumble timeout check - auto-stop if no new commands received
-    uint32_t now_ms = time_us_32() / 1000;
     for (int i = 0; i < MAX_PLAYERS; i++) {
         purupuru_updated[i] = false;
-
-        // Check if rumble should auto-stop due to timeout
-        if (last_rumble_time[i] != 0) {
-            uint32_t elapsed = now_ms - last_rumble_time[i];
-            if (elapsed > RUMBLE_TIMEOUT_MS) {
-                // Timeout expired - turn off rumble
-                feedback_set_rumble_internal(i, 0, 0);
-                last_rumble_time[i] = 0;
-            }
-        }
     }
 
+#ifndef CONFIG_DC_CORE1_TX
+    // Packets are consumed on this core, so the rumble timeout runs here too
+    // (Core 1 runs it between RX bytes otherwise). The posted 0 reaches the
+    // players through feedback_console_task().
+    dc_rumble_timeout_check();
+#endif
+
 }
 
 
@@ -1724,9 +1660,7 @@ static uint8_t dc_get_rumble(void)
         return 0;
     }
 
-    // Scale power (0-7 typical, but can be higher) to 0-255
-    // Use same calculation as in SET_CONDITION handler
-    return (purupuru_power[0] * 36 > 255) ? 255 : (purupuru_power[0] * 36);
+    return dc_rumble_level(purupuru_power[0]);
 }
 
 // ============================================================================
@@ -1740,14 +1674,17 @@ void dreamcast_set_controller_state(uint8_t port, uint16_t buttons,
 {
     if (port >= MAX_PLAYERS) return;
 
-    // Direct write to volatile state - Core 1 reads this immediately
-    dc_state[port].buttons = buttons;
-    dc_state[port].joy_x = joy_x;
-    dc_state[port].joy_y = joy_y;
-    dc_state[port].joy2_x = joy2_x;
-    dc_state[port].joy2_y = joy2_y;
-    dc_state[port].lt = lt;
-    dc_state[port].rt = rt;
+    dc_controller_state_t state = {
+        .buttons = buttons, .rt = rt, .lt = lt,
+        .joy_x = joy_x, .joy_y = joy_y, .joy2_x = joy2_x, .joy2_y = joy2_y,
+    };
+    bool changed = !dc_state_equal(&dc_state[port], &state);
+    dc_state[port] = state;
+
+    // Publish a fresh condition packet — Core 1 picks it up on the next poll
+    if (port == 0 && changed) {
+        BuildConditionPackets();
+    }
 }
 
 uint8_t dreamcast_get_rumble(uint8_t port)
@@ -13,11 +13,14 @@
 #include "pico/flash.h"
 #include "tusb.h"
 #include "core/services/storage/flash.h"
+#include "core/services/storage/flash_sched.h"
 #include "core/services/profiles/profile.h"
 #include "core/services/players/manager.h"
+#include "core/services/players/feedback.h"
 #include "core/services/codes/codes.h"
 #include "core/router/router.h"
 #include "platform/platform.h"
+#include "native/joybus_clock.h"
 
 // Declaration of global variables
 GamecubeConsole gc;
@@ -190,8 +193,8 @@ void gc_kb_key_lookup_init()
 // init for gamecube communication
 void ngc_init()
 {
-  // over clock CPU for correct timing with GC
-  set_sys_clock_khz(130000, true);
+  // Clean joybus clock (whole PIO divider) before any PIO/UART setup
+  joybus_clock_init();
 
   #ifdef UART_TX_PIN
   // Configure custom UART pins (KB2040: 12=TX, 13=RX)
@@ -243,6 +246,7 @@ void ngc_init()
   printf("[gc] joybus DATA pin: GPIO %d%s\n", data_pin,
          (data_pin != GC_DATA_PIN) ? " (override)" : "");
   GamecubeConsole_init(&gc, data_pin, pio, sm, offset);
+  joybus_clock_check(pio, gc._port.sm);
   gc_report = default_gc_report;
 
   const profile_t* profile = profile_get_active(OUTPUT_TARGET_GAMECUBE);
@@ -281,6 +285,10 @@ void __not_in_flash_func(core1_task)(void)
     // Send GameCube controller button report
     GamecubeConsole_SendReport(&gc, &gc_report);
 
+    // Reply first: the console's response window starts at the poll
+    feedback_console_post(0, gc_rumble, gc_rumble);
+    flash_sched_console_polled();
+
     gc_kb_counter++;
     gc_kb_counter &= 15;
 
@@ -13,8 +13,10 @@
 #include "pico/flash.h"
 #include "tusb.h"
 #include "core/services/storage/flash.h"
+#include "core/services/storage/flash_sched.h"
 #include "core/services/profiles/profile.h"
 #include "core/services/players/manager.h"
+#include "core/services/players/feedback.h"
 #include "core/services/codes/codes.h"
 #include "core/router/router.h"
 #include "platform/platform.h"
@@ -158,6 +160,8 @@ void __not_in_flash_func(core1_task)(void)
     // only inline PIO functions (pio_sm_set_config, pio_sm_restart, etc.).
     while (1) {
         N64Console_WaitForPoll(&n64);
+        flash_sched_console_polled();
+        feedback_console_post(0, n64_rumble_state, n64_rumble_state);
     }
 }
 
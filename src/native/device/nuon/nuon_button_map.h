@@ -0,0 +1,33 @@
+// nuon_button_map.h - JP_BUTTON_* -> Nuon button packet bits
+//
+// Built into a button_encoder_t at init; checked against the old branch
+// encoder by test/button_encoder_test.c.
+
+#ifndef NUON_BUTTON_MAP_H
+#define NUON_BUTTON_MAP_H
+
+#include "nuon_device.h"
+#include "nuon_buttons.h"
+#include "core/button_encoder.h"
+
+// maps default joypad button bit order to nuon's button packet data structure
+// (compiled into nuon_button_encoder by nuon_init)
+static const button_encoder_map_t nuon_button_map[] = {
+  { JP_BUTTON_B2, NUON_BUTTON_C_DOWN },   // Circle -> C-DOWN
+  { JP_BUTTON_B1, NUON_BUTTON_A },        // Cross -> A
+  { JP_BUTTON_S2, NUON_BUTTON_START },    // Option -> START
+  { JP_BUTTON_S1, NUON_BUTTON_NUON },     // Share -> NUON/Z
+  { JP_BUTTON_DD, NUON_BUTTON_DOWN },     // Dpad Down -> D-DOWN
+  { JP_BUTTON_DL, NUON_BUTTON_LEFT },     // Dpad Left -> D-LEFT
+  { JP_BUTTON_DU, NUON_BUTTON_UP },       // Dpad Up -> D-UP
+  { JP_BUTTON_DR, NUON_BUTTON_RIGHT },    // Dpad Right -> D-RIGHT
+  // Skipping the two buttons represented by 0x0080 and 0x0040 in the new format
+  { JP_BUTTON_L1, NUON_BUTTON_L },        // L1 -> L
+  { JP_BUTTON_R1, NUON_BUTTON_R },        // R1 -> R
+  { JP_BUTTON_B3, NUON_BUTTON_B },        // Square -> B
+  { JP_BUTTON_B4, NUON_BUTTON_C_LEFT },   // Triangle -> C-LEFT
+  { JP_BUTTON_L2, NUON_BUTTON_C_UP },     // L2 -> C-UP
+  { JP_BUTTON_R2, NUON_BUTTON_C_RIGHT },  // R2 -> C-RIGHT
+};
+
+#endif // NUON_BUTTON_MAP_H
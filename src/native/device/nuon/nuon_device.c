@@ -6,6 +6,8 @@
 #include "pico/cyw43_arch.h"
 #endif
 #include "nuon_buttons.h"
+#include "core/button_encoder.h"
+#include "nuon_button_map.h"
 #include "core/services/codes/codes.h"
 #include "core/services/hotkeys/hotkeys.h"
 #include "core/services/profiles/profile.h"
@@ -63,6 +65,8 @@ static int16_t last_stick_angle[MAX_PLAYERS] = {0};  // Track last angle per pla
 // Forward declaration for GPIO trigger function
 static void trigger_button_press(uint8_t pin);
 
+static button_encoder_t nuon_button_encoder;
+
 // IGR callback for long hold (power button)
 static void nuon_igr_power_callback(uint8_t player, uint32_t held_ms) {
     (void)player;
@@ -80,6 +84,9 @@ static void nuon_igr_stop_callback(uint8_t player, uint32_t held_ms) {
 // init for nuon communication
 void nuon_init(void)
 {
+  button_encoder_build(&nuon_button_encoder, nuon_button_map,
+                       sizeof(nuon_button_map) / sizeof(nuon_button_map[0]));
+
   output_buttons_0 = 0b00000000100000001000001100000011; // no buttons pressed
   output_analog_1x = 0b10000000100000110000001100000000; // x1 = 0
   output_analog_1y = 0b10000000100000110000001100000000; // y1 = 0
@@ -161,29 +168,10 @@ void nuon_init(void)
   hotkeys_register(&stop_hotkey);
 }
 
-// maps default joypad button bit order to nuon's button packet data structure
 uint32_t __no_inline_not_in_flash_func(map_nuon_buttons)(uint32_t buttons)
 {
-  uint32_t nuon_buttons = 0x0080;
-
   // Mapping the buttons (active-high: 1 = pressed)
-  nuon_buttons |= (buttons & JP_BUTTON_B2) ? NUON_BUTTON_C_DOWN : 0;  // Circle -> C-DOWN
-  nuon_buttons |= (buttons & JP_BUTTON_B1) ? NUON_BUTTON_A  : 0;  // Cross -> A
-  nuon_buttons |= (buttons & JP_BUTTON_S2) ? NUON_BUTTON_START : 0;  // Option -> START
-  nuon_buttons |= (buttons & JP_BUTTON_S1) ? NUON_BUTTON_NUON : 0;  // Share -> NUON/Z
-  nuon_buttons |= (buttons & JP_BUTTON_DD) ? NUON_BUTTON_DOWN : 0;  // Dpad Down -> D-DOWN
-  nuon_buttons |= (buttons & JP_BUTTON_DL) ? NUON_BUTTON_LEFT : 0;  // Dpad Left -> D-LEFT
-  nuon_buttons |= (buttons & JP_BUTTON_DU) ? NUON_BUTTON_UP : 0;  // Dpad Up -> D-UP
-  nuon_buttons |= (buttons & JP_BUTTON_DR) ? NUON_BUTTON_RIGHT : 0;  // Dpad Right -> D-RIGHT
-  // Skipping the two buttons represented by 0x0080 and 0x0040 in the new format
-  nuon_buttons |= (buttons & JP_BUTTON_L1) ? NUON_BUTTON_L : 0;  // L1 -> L
-  nuon_buttons |= (buttons & JP_BUTTON_R1) ? NUON_BUTTON_R : 0;  // R1 -> R
-  nuon_buttons |= (buttons & JP_BUTTON_B3) ? NUON_BUTTON_B : 0;  // Square -> B
-  nuon_buttons |= (buttons & JP_BUTTON_B4) ? NUON_BUTTON_C_LEFT : 0;  // Triangle -> C-LEFT
-  nuon_buttons |= (buttons & JP_BUTTON_L2) ? NUON_BUTTON_C_UP : 0;  // L2 -> C-UP
-  nuon_buttons |= (buttons & JP_BUTTON_R2) ? NUON_BUTTON_C_RIGHT : 0;  // R2 -> C-RIGHT
-
-  return nuon_buttons;
+  return 0x0080 | button_encoder_encode(&nuon_button_encoder, buttons);
 }
 
 uint8_t __no_inline_not_in_flash_func(eparity)(uint32_t data)
@@ -405,7 +405,7 @@ void tdo_host_task(void) {
         init_input_event(&event);
 
         // Use 0xE0+ range for 3DO native inputs (0xF0+ is SNES)
-        event.dev_addr = 0xE0 + i;
+        event.dev_addr = DEV_ADDR_3DO_BASE + i;
         event.instance = 0;
         event.buttons = buttons;
 
@@ -416,7 +416,7 @@ void arcade_host_task(void)
     input_event_t event;
     init_input_event(&event);
 
-    event.dev_addr = 0xF0;  // Use 0xF0+ range for native inputs
+    event.dev_addr = DEV_ADDR_NATIVE_BASE;  // Use 0xF0+ range for native inputs
     event.instance = 0;
     event.type = INPUT_TYPE_ARCADE_STICK;
     event.buttons = buttons;
@@ -69,10 +69,22 @@ gba_mb_result_t gba_mb_boot_embedded(joybus_port_t* port, int channel);
 // The payload uses joybus mode (READ command 0x14) — Doridian-style:
 //   data[0] bit 0..7 = GBA KEYINPUT lower 8 bits (A, B, Select, Start, R, L, U, D)
 //   data[1] bit 0..1 = GBA KEYINPUT upper bits (R, L)
+//   data[2..3]       = sample sequence (see gba_input_seq)
 // 0 bit = button pressed (matches GBA hardware convention).
 // Returns 0 on success, negative on error.
 int gba_input_read(joybus_port_t* port, uint8_t out[4]);
 
+// Sample sequence stamped by the joypad payload into the spare JOYTR
+// bytes: data[2] = rolling counter bumped when KEYINPUT changes,
+// data[3] = its complement. Returns the counter (0..255), or
+// GBA_INPUT_SEQ_NONE for payloads that leave the upper bytes zero.
+// Two reads with the same counter carry the same keys.
+#define GBA_INPUT_SEQ_NONE (-1)
+static inline int gba_input_seq(const uint8_t data[4])
+{
+    return ((uint8_t)~data[2] == data[3]) ? data[2] : GBA_INPUT_SEQ_NONE;
+}
+
 // Embedded GBA-as-controller payload. Defined weakly in gba_payload.c
 // so the firmware links cleanly even when no .gba is provided. Override
 // by replacing gba_payload.c with a generated source containing the
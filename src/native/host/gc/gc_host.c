@@ -14,6 +14,7 @@
 #include "core/buttons.h"
 #include "core/services/players/feedback.h"
 #include "platform/platform.h"
+#include "native/joybus_clock.h"
 #include <hardware/pio.h>
 #include <pico/time.h>
 #include <stdio.h>
@@ -26,7 +27,7 @@
 static GamecubeController gc_controllers[GC_MAX_PORTS];
 static bool initialized = false;
 static bool rumble_state[GC_MAX_PORTS] = {false};
-static uint8_t disconnect_debounce[GC_MAX_PORTS] = {0};  // Debounce brief disconnects
+static uint32_t disconnect_since_ms[GC_MAX_PORTS] = {0};  // Debounce brief disconnects (0 = responding)
 static bool was_connected[GC_MAX_PORTS] = {false};  // Track connection state
 static bool gba_boot_attempted[GC_MAX_PORTS] = {false};  // One multiboot attempt per disconnect cycle
 // Consecutive gba_input_read failures since the last successful read.
@@ -37,6 +38,15 @@ static bool gba_boot_attempted[GC_MAX_PORTS] = {false};  // One multiboot attemp
 static uint16_t gba_read_fail_streak[GC_MAX_PORTS] = {0};
 static bool gba_bridge_owned[GC_MAX_PORTS] = {false};    // True when gba_bridge.c owns the joybus port
 static uint32_t gba_probe_next_ms[GC_MAX_PORTS] = {0};  // Rate-limit GBA probes (500ms)
+// Reads hold off until this time after a multiboot, so the payload can init
+// SIO and halt without the main loop sleeping through it
+#define GBA_BOOT_SETTLE_MS 200
+static uint32_t gba_read_after_ms[GC_MAX_PORTS] = {0};
+// Last JOYTR sample sequence seen (GBA_INPUT_SEQ_NONE = none yet / legacy
+// payload) and fresh vs repeated sample counts for GBADETECT.
+static int16_t gba_last_seq[GC_MAX_PORTS];
+static uint32_t gba_fresh_samples[GC_MAX_PORTS] = {0};
+static uint32_t gba_repeat_samples[GC_MAX_PORTS] = {0};
 
 // Track previous state for edge detection
 static uint32_t prev_buttons[GC_MAX_PORTS] = {0};
@@ -47,6 +57,91 @@ static uint8_t prev_cstick_y[GC_MAX_PORTS] = {128};
 static uint8_t prev_l_analog[GC_MAX_PORTS] = {0};
 static uint8_t prev_r_analog[GC_MAX_PORTS] = {0};
 
+// ============================================================================
+// PER-PORT POLL RATE
+// ============================================================================
+// Each port starts at GC_POLLING_RATE and is judged over windows of polls.
+// A window with too many missed responses halves that port's rate (down to
+// GC_POLLING_RATE_MIN); a long run of clean windows tries the next rate up
+// again. Every step down doubles the clean run needed, so a controller that
+// really can't keep up (some third-party pads and wireless receivers) stops
+// flapping between rates. Ports are gated here rather than inside the
+// joybus library, which is initialized at the fastest rate.
+
+#define GC_RATE_WINDOW        200   // Polls per reliability window
+#define GC_RATE_MAX_MISSES    4     // Misses per window before stepping down (2%)
+#define GC_RATE_UP_WINDOWS    25    // Clean windows before trying a faster rate
+#define GC_RATE_MAX_BACKOFF   4     // Cap on doubling of GC_RATE_UP_WINDOWS
+
+// Time without a response before a port reports disconnected
+#define GC_DISCONNECT_DEBOUNCE_MS 240
+
+typedef struct {
+    uint8_t shift;              // Rate = GC_POLLING_RATE >> shift
+    uint8_t backoff;            // Step-downs since connect
+    uint16_t polls;             // Polls in the current window
+    uint16_t misses;            // Missed responses in the current window
+    uint16_t clean_windows;     // Consecutive windows under GC_RATE_MAX_MISSES
+    uint32_t next_poll_us;
+} gc_rate_t;
+
+static gc_rate_t poll_rate[GC_MAX_PORTS];
+
+static inline uint16_t rate_hz(const gc_rate_t* r)
+{
+    return (uint16_t)(GC_POLLING_RATE >> r->shift);
+}
+
+static void rate_reset(gc_rate_t* r)
+{
+    r->shift = 0;
+    r->backoff = 0;
+    r->polls = 0;
+    r->misses = 0;
+    r->clean_windows = 0;
+}
+
+// True when the port's next poll is due. Schedules the one after it.
+static bool rate_poll_due(gc_rate_t* r)
+{
+    uint32_t now = time_us_32();
+    if ((int32_t)(now - r->next_poll_us) < 0) return false;
+
+    uint32_t period = 1000000u / rate_hz(r);
+    r->next_poll_us += period;
+    // Fell a whole period behind (main loop stall): restart from now
+    if ((int32_t)(now - r->next_poll_us) >= 0) r->next_poll_us = now + period;
+    return true;
+}
+
+// Count one poll of a connected controller, close the window when full
+static void rate_track(gc_rate_t* r, int port, bool responded)
+{
+    if (!responded) r->misses++;
+    if (++r->polls < GC_RATE_WINDOW) return;
+
+    uint16_t misses = r->misses;
+    r->polls = 0;
+    r->misses = 0;
+
+    if (misses > GC_RATE_MAX_MISSES) {
+        r->clean_windows = 0;
+        if ((GC_POLLING_RATE >> (r->shift + 1)) < GC_POLLING_RATE_MIN) return;
+        r->shift++;
+        if (r->backoff < GC_RATE_MAX_BACKOFF) r->backoff++;
+        printf("[gc_host] Port %d: %d/%d polls missed, rate -> %dHz\n",
+               port, misses, GC_RATE_WINDOW, rate_hz(r));
+        return;
+    }
+
+    if (r->shift == 0) return;
+    if (++r->clean_windows < (GC_RATE_UP_WINDOWS << r->backoff)) return;
+    r->clean_windows = 0;
+    r->shift--;
+    printf("[gc_host] Port %d: clean for %d windows, trying %dHz\n",
+           port, GC_RATE_UP_WINDOWS << r->backoff, rate_hz(r));
+}
+
 // ============================================================================
 // AUTO-CALIBRATING STICK RANGE
 // ============================================================================
@@ -185,7 +280,8 @@ void gc_host_init(void)
 void gc_host_init_pin(uint8_t data_pin)
 {
     printf("[gc_host] Initializing GC host driver\n");
-    printf("[gc_host]   DATA=%d, rate=%dHz\n", data_pin, GC_POLLING_RATE);
+    printf("[gc_host]   DATA=%d, rate=%d-%dHz\n", data_pin,
+           GC_POLLING_RATE_MIN, GC_POLLING_RATE);
 
     // Enable pull-up before joybus init (open-drain protocol needs pull-up)
     gpio_init(data_pin);
@@ -203,6 +299,7 @@ void gc_host_init_pin(uint8_t data_pin)
     // Initialize GameCube controller on port 0
     GamecubeController_init(&gc_controllers[0], data_pin, GC_POLLING_RATE,
                             pio0, -1, -1);
+    joybus_clock_check(pio0, gc_controllers[0]._port.sm);
     printf("[gc_host]   joybus loaded at PIO0 offset %d\n", GamecubeController_GetOffset(&gc_controllers[0]));
 
     // Initialize state tracking
@@ -216,7 +313,11 @@ void gc_host_init_pin(uint8_t data_pin)
         prev_r_analog[i] = 0;
         rumble_state[i] = false;
         was_connected[i] = false;
+        gba_last_seq[i] = GBA_INPUT_SEQ_NONE;
         gba_boot_attempted[i] = false;
+        disconnect_since_ms[i] = 0;
+        rate_reset(&poll_rate[i]);
+        poll_rate[i].next_poll_us = time_us_32();
     }
 
     initialized = true;
@@ -270,6 +371,9 @@ void gc_host_task(void)
             if (gba_bridge_owned[port]) {
                 continue;
             }
+            if ((int32_t)(to_ms_since_boot(get_absolute_time()) - gba_read_after_ms[port]) < 0) {
+                continue;
+            }
             uint8_t gba_keys[4];
             if (gba_input_read(&controller->_port, gba_keys) < 0) {
                 // GBA may have been power-cycled (back into BIOS) or
@@ -283,6 +387,7 @@ void gc_host_task(void)
                            port, gba_read_fail_streak[port]);
                     gba_boot_attempted[port]  = false;
                     gba_read_fail_streak[port] = 0;
+                    gba_last_seq[port] = GBA_INPUT_SEQ_NONE;
                     // Give the GBA's BIOS time to finish its power-on
                     // init before bombing the bus again. If it's mid-
                     // boot when we probe, our STATUS commands fight
@@ -303,6 +408,18 @@ void gc_host_task(void)
                 gba_keys[2] == 0 && gba_keys[3] == 0) {
                 continue;
             }
+            // Sequenced payloads refresh JOYTR from keypad/timer IRQs and
+            // bump a counter when the keys change. Same counter as last
+            // read = no new input since then; nothing to decode.
+            int seq = gba_input_seq(gba_keys);
+            if (seq != GBA_INPUT_SEQ_NONE) {
+                if (seq == gba_last_seq[port]) {
+                    gba_repeat_samples[port]++;
+                    continue;
+                }
+                gba_last_seq[port] = (int16_t)seq;
+            }
+            gba_fresh_samples[port]++;
             // GBA KEYINPUT layout (0=pressed):
             //   data[0] bit 0: A, 1: B, 2: Select, 3: Start,
             //                4: Right, 5: Left, 6: Up, 7: Down
@@ -333,7 +450,7 @@ void gc_host_task(void)
                 prev_buttons[port] = buttons;
                 input_event_t event;
                 init_input_event(&event);
-                event.dev_addr = 0xD0 + port;
+                event.dev_addr = DEV_ADDR_GC_BASE + port;
                 event.instance = 0;
                 event.type = INPUT_TYPE_GAMEPAD;
                 event.layout = LAYOUT_NINTENDO_4FACE;
@@ -348,8 +465,16 @@ void gc_host_task(void)
         }
 
         // Poll the controller (rumble state passed in poll command)
+        gc_rate_t* rate = &poll_rate[port];
+        if (!rate_poll_due(rate)) {
+            continue;
+        }
+        bool responding = GamecubeController_IsInitialized(controller);
         gc_report_t report;
         bool success = GamecubeController_Poll(controller, &report, rumble_state[port]);
+        if (responding && was_connected[port]) {
+            rate_track(rate, port, success);
+        }
 
         // GBA-as-controller bridge: a cartless GBA boots into the BIOS
         // multiboot wait state in SIO normal mode — its 0x00 probe response
@@ -402,7 +527,7 @@ void gc_host_task(void)
                 if (r == GBA_MB_OK) {
                     printf("[gc_host] Port %d: GBA boot OK, payload running\n", port);
                     gba_boot_attempted[port] = true;
-                    sleep_ms(200);  // let the payload init SIO and halt before we poll
+                    gba_read_after_ms[port] = to_ms_since_boot(get_absolute_time()) + GBA_BOOT_SETTLE_MS;
                 } else {
                     printf("[gc_host] Port %d: GBA multiboot failed (%d), retrying in 2s\n",
                            port, (int)r);
@@ -415,12 +540,15 @@ void gc_host_task(void)
         bool is_connected = GamecubeController_IsInitialized(controller);
 
         if (!is_connected) {
-            // Debounce: require 30 consecutive disconnects before reporting
+            // Debounce: require GC_DISCONNECT_DEBOUNCE_MS of silence before
+            // reporting, whatever rate the port was polled at
             if (was_connected[port]) {
-                disconnect_debounce[port]++;
-                if (disconnect_debounce[port] >= 30) {
+                uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+                if (disconnect_since_ms[port] == 0) {
+                    disconnect_since_ms[port] = now_ms ? now_ms : 1;
+                } else if (now_ms - disconnect_since_ms[port] >= GC_DISCONNECT_DEBOUNCE_MS) {
                     was_connected[port] = false;
-                    disconnect_debounce[port] = 0;
+                    disconnect_since_ms[port] = 0;
                     // INTENTIONALLY NOT resetting gba_boot_attempted — once
                     // a GBA has multibooted, don't re-upload on transient
                     // disconnects. Users would see Nintendo logo flashing
@@ -431,7 +559,7 @@ void gc_host_task(void)
                     // Send cleared input to prevent stuck buttons
                     input_event_t event;
                     init_input_event(&event);
-                    event.dev_addr = 0xD0 + port;  // Use 0xD0+ range for GC native inputs
+                    event.dev_addr = DEV_ADDR_GC_BASE + port;  // Use 0xD0+ range for GC native inputs
                     event.instance = 0;
                     event.type = INPUT_TYPE_GAMEPAD;
                     event.buttons = 0;
@@ -454,10 +582,12 @@ void gc_host_task(void)
                 }
             }
         } else {
-            // Connected - reset debounce counter
-            disconnect_debounce[port] = 0;
+            // Connected - reset debounce timer
+            disconnect_since_ms[port] = 0;
             if (!was_connected[port]) {
                 was_connected[port] = true;
+                // Fresh controller gets judged from the top rate again
+                rate_reset(rate);
                 // Reset stick calibration for this port on fresh connect
                 for (int a = 0; a < 4; a++) {
                     stick_range[port][a].min = GC_STICK_INIT_MIN;
@@ -466,7 +596,8 @@ void gc_host_task(void)
                 // Reset trigger rest bias for this port on fresh connect
                 trigger_rest[port][0] = GC_TRIGGER_INIT_REST;
                 trigger_rest[port][1] = GC_TRIGGER_INIT_REST;
-                printf("[gc_host] Port %d: connected\n", port);
+                printf("[gc_host] Port %d: connected, polling at %dHz\n",
+                       port, rate_hz(rate));
             }
         }
 
@@ -508,7 +639,7 @@ void gc_host_task(void)
         input_event_t event;
         init_input_event(&event);
 
-        event.dev_addr = 0xD0 + port;  // Use 0xD0+ range for GC native inputs
+        event.dev_addr = DEV_ADDR_GC_BASE + port;  // Use 0xD0+ range for GC native inputs
         event.instance = 0;
         event.type = INPUT_TYPE_GAMEPAD;
         event.layout = LAYOUT_GAMECUBE;  // AXBY face style + gates GC hotkeys
@@ -560,6 +691,13 @@ void gc_host_set_rumble(uint8_t port, bool enabled)
     rumble_state[port] = enabled;
 }
 
+uint16_t gc_host_get_poll_rate(uint8_t port)
+{
+    if (!initialized || port >= GC_MAX_PORTS) return 0;
+    if (!was_connected[port] || gba_boot_attempted[port]) return 0;
+    return rate_hz(&poll_rate[port]);
+}
+
 // ============================================================================
 // INPUT INTERFACE
 // ============================================================================
@@ -600,6 +738,22 @@ bool gc_host_gba_boot_attempted(uint8_t port)
     return gba_boot_attempted[port];
 }
 
+void gc_host_gba_sample_counts(uint8_t port, uint32_t* fresh, uint32_t* repeat)
+{
+    if (port >= GC_MAX_PORTS) {
+        *fresh = *repeat = 0;
+        return;
+    }
+    *fresh = gba_fresh_samples[port];
+    *repeat = gba_repeat_samples[port];
+}
+
+// True once a read carried the payload's JOYTR sample stamp
+bool gc_host_gba_sequenced(uint8_t port)
+{
+    return port < GC_MAX_PORTS && gba_last_seq[port] != GBA_INPUT_SEQ_NONE;
+}
+
 uint16_t gc_host_gba_read_fail_streak(uint8_t port)
 {
     if (port >= GC_MAX_PORTS) return 0;
@@ -611,6 +765,7 @@ void gc_host_gba_reset_boot_attempted(uint8_t port)
     if (port >= GC_MAX_PORTS) return;
     gba_boot_attempted[port] = false;
     gba_probe_next_ms[port]  = 0;  // probe immediately on next task
+    gba_last_seq[port] = GBA_INPUT_SEQ_NONE;
 }
 
 bool gc_host_gba_acquire_for_bridge(void)
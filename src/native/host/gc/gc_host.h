@@ -19,9 +19,15 @@
 #define GC_PIN_DATA  2   // Data I/O (directly to controller)
 #endif
 
-// Default polling rate (Hz) - GameCube console polls at ~125Hz
+// Fastest polling rate (Hz). Each port starts here and halves down to
+// GC_POLLING_RATE_MIN if the controller misses too many polls at that rate.
 #ifndef GC_POLLING_RATE
-#define GC_POLLING_RATE  125
+#define GC_POLLING_RATE  1000
+#endif
+
+// Slowest rate a port steps down to (GameCube console polls at ~125Hz)
+#ifndef GC_POLLING_RATE_MIN
+#define GC_POLLING_RATE_MIN  125
 #endif
 
 // Maximum number of GameCube controllers (1 for now, future: adapter/multitap)
@@ -51,6 +57,9 @@ int16_t gc_host_get_device_type(uint8_t port);
 // Set rumble state for a port
 void gc_host_set_rumble(uint8_t port, bool enabled);
 
+// Rate (Hz) a port is currently polled at, 0 if nothing is connected
+uint16_t gc_host_get_poll_rate(uint8_t port);
+
 // GC input interface (implements InputInterface pattern for app declaration)
 extern const InputInterface gc_input_interface;
 
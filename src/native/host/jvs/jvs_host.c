@@ -292,7 +292,7 @@ void JVSIO_Client_synced(uint8_t players, uint8_t coin_state, uint8_t* sw_state0
         input_event_t event;
         init_input_event(&event);
 
-        event.dev_addr = 0xF0 + i;  // Use 0xF0+ range for native inputs
+        event.dev_addr = DEV_ADDR_NATIVE_BASE + i;  // Use 0xF0+ range for native inputs
         event.instance = 0;
         event.type = INPUT_TYPE_ARCADE_STICK;
         event.buttons = buttons;
@@ -236,7 +236,7 @@ static void submit_mcu(uint8_t *bytes, bool is_gc)
 
     input_event_t event;
     init_input_event(&event);
-    event.dev_addr = 0xF0;
+    event.dev_addr = DEV_ADDR_NATIVE_BASE;
     event.instance = 0;
     event.type = INPUT_TYPE_GAMEPAD;
     event.transport = INPUT_TRANSPORT_NATIVE;
@@ -299,7 +299,7 @@ static void submit_snes(uint16_t value)
 
     input_event_t event;
     init_input_event(&event);
-    event.dev_addr = 0xF0;
+    event.dev_addr = DEV_ADDR_NATIVE_BASE;
     event.instance = 0;
     event.type = INPUT_TYPE_GAMEPAD;
     event.transport = INPUT_TRANSPORT_NATIVE;
@@ -410,7 +410,7 @@ void lodgenet_host_task(void)
                 // Send cleared event
                 input_event_t event;
                 init_input_event(&event);
-                event.dev_addr = 0xF0;
+                event.dev_addr = DEV_ADDR_NATIVE_BASE;
                 event.type = INPUT_TYPE_GAMEPAD;
                 event.transport = INPUT_TRANSPORT_NATIVE;
                 router_submit_input(&event);
@@ -451,7 +451,7 @@ void lodgenet_host_task(void)
                 last_buttons = 0;
                 input_event_t event;
                 init_input_event(&event);
-                event.dev_addr = 0xF0;
+                event.dev_addr = DEV_ADDR_NATIVE_BASE;
                 event.type = INPUT_TYPE_GAMEPAD;
                 event.transport = INPUT_TRANSPORT_NATIVE;
                 router_submit_input(&event);
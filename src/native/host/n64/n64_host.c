@@ -204,7 +204,7 @@ void n64_host_task(void)
                     // Send cleared input to prevent stuck buttons
                     input_event_t event;
                     init_input_event(&event);
-                    event.dev_addr = 0xE0 + port;
+                    event.dev_addr = DEV_ADDR_N64_BASE + port;
                     event.instance = 0;
                     event.type = INPUT_TYPE_GAMEPAD;
                     event.buttons = 0;
@@ -287,7 +287,7 @@ void n64_host_task(void)
         input_event_t event;
         init_input_event(&event);
 
-        event.dev_addr = 0xE0 + port;  // Use 0xE0+ range for N64 native inputs
+        event.dev_addr = DEV_ADDR_N64_BASE + port;  // Use 0xE0+ range for N64 native inputs
         event.instance = 0;
         event.type = INPUT_TYPE_GAMEPAD;
         event.buttons = buttons;
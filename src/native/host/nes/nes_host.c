@@ -211,7 +211,7 @@ void nes_host_task(void)
 
     int port = 0;
 
-    event.dev_addr = 0xF0 + port; // port number 
+    event.dev_addr = DEV_ADDR_NATIVE_BASE + port; // port number 
     event.instance = 0; // Instance number for multi controller devices
     event.type = INPUT_TYPE_GAMEPAD;
     event.transport = INPUT_TRANSPORT_NATIVE;
@@ -31,7 +31,7 @@
 // CONFIG
 // ============================================================================
 
-#define PSX_DEV_ADDR     0xE1
+#define PSX_DEV_ADDR     DEV_ADDR_PSX
 #define PSX_HW_BYTES     21         // full transaction: 3 cmd + 18 data (covers
                                     // DS2 0x79 pressure block: id,5A,btn1,btn2,
                                     // RX,RY,LX,LY + 12 pressure bytes)
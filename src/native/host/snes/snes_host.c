@@ -281,7 +281,7 @@ void snes_host_task(void)
         input_event_t event;
         init_input_event(&event);
 
-        event.dev_addr = 0xF0 + port;  // Use 0xF0+ range for native inputs
+        event.dev_addr = DEV_ADDR_NATIVE_BASE + port;  // Use 0xF0+ range for native inputs
         event.instance = 0;
         event.type = INPUT_TYPE_GAMEPAD;
         event.buttons = buttons;
@@ -88,7 +88,7 @@ static void process_packet(uint8_t type, const uint8_t* payload, uint8_t len)
             init_input_event(&event);
 
             // Use 0xD0+ range for UART inputs (0xD0-0xD7)
-            event.dev_addr = 0xD0 + evt->player_index;
+            event.dev_addr = DEV_ADDR_UART_HOST_BASE + evt->player_index;
             event.instance = 0;
             event.type = evt->device_type;
             event.buttons = evt->buttons;
@@ -12,9 +12,8 @@
 #include <stdio.h>
 #include <string.h>
 
-// Device address range for native inputs. SNES/LodgeNet use 0xF0+, N64/3DO
-// 0xE0+, GC/UART 0xD0+. Wii claims 0xC0+ per the plan.
-#define WII_DEV_ADDR_BASE       0xC0
+// Device address range for Wii extension inputs (see core/dev_addr.h)
+#define WII_DEV_ADDR_BASE       DEV_ADDR_WII_EXT_BASE
 
 // Poll / retry cadence.
 #define WII_POLL_INTERVAL_US    2000      // ~500 Hz when connected
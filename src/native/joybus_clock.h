@@ -0,0 +1,142 @@
+// joybus_clock.h - System clock selection for joybus PIO timing
+//
+// joybus-pio runs its state machines at JOYBUS_PIO_HZ (40 PIO cycles per
+// 4us bit) and derives the divider from clk_sys when a port is initialized.
+// The divider's fractional part is dithered, so a clock that isn't a whole
+// multiple of JOYBUS_PIO_HZ jitters individual bit edges. Console polls
+// shrug that off, GBA multiboot's cipher stream doesn't: 125MHz (12.5)
+// breaks uploads, 130MHz (13), 150MHz (15) and 200MHz (20) are clean.
+//
+// Joybus apps call joybus_clock_init() before any PIO, UART or USB setup
+// instead of hard-coding a clock. It runs the fastest clean clock at or below
+// JOYBUS_SYS_CLOCK_KHZ (capped at JOYBUS_SYS_CLOCK_MAX_KHZ) that the PLL can
+// produce exactly. Ports call
+// joybus_clock_check() after init to log the divider joybus-pio programmed
+// and flag one that isn't clean. test/joybus_clock_test.c runs the selection
+// and divider math on the host for every target from 100MHz to 250MHz.
+
+#ifndef JOYBUS_CLOCK_H
+#define JOYBUS_CLOCK_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "hardware/clocks.h"
+#include "hardware/pio.h"
+
+// PIO clock the joybus programs are written for
+#define JOYBUS_PIO_HZ           10000000u
+#define JOYBUS_CLOCK_STEP_KHZ   (JOYBUS_PIO_HZ / 1000u)
+
+// Target system clock. RP2350's stock 150MHz is already clean; RP2040's
+// 125MHz isn't, so it runs at the next clean step up.
+#ifndef JOYBUS_SYS_CLOCK_KHZ
+#if PICO_RP2350
+#define JOYBUS_SYS_CLOCK_KHZ    150000
+#else
+#define JOYBUS_SYS_CLOCK_KHZ    130000
+#endif
+#endif
+
+// Highest clock joybus_clock_init() will switch to: the chip's rated clock
+// at the default core voltage and boot2 flash divider. It doesn't touch the
+// voltage regulator or the flash SSI divider, so a build that raises this
+// past the rating must set both itself before calling joybus_clock_init().
+#ifndef JOYBUS_SYS_CLOCK_MAX_KHZ
+#if PICO_RP2350
+#define JOYBUS_SYS_CLOCK_MAX_KHZ 150000
+#else
+#define JOYBUS_SYS_CLOCK_MAX_KHZ 133000
+#endif
+#endif
+
+// Lowest clock joybus_clock_init() walks down to before giving up
+#ifndef JOYBUS_SYS_CLOCK_MIN_KHZ
+#define JOYBUS_SYS_CLOCK_MIN_KHZ 100000
+#endif
+
+static inline bool joybus_clock_is_clean(uint32_t sys_hz)
+{
+    return sys_hz % JOYBUS_PIO_HZ == 0;
+}
+
+// Divider for JOYBUS_PIO_HZ at sys_hz, in the PIO's 16.8 format
+static inline void joybus_clock_divider(uint32_t sys_hz, uint16_t* div_int, uint8_t* div_frac)
+{
+    *div_int = (uint16_t)(sys_hz / JOYBUS_PIO_HZ);
+    *div_frac = (uint8_t)(((uint64_t)(sys_hz % JOYBUS_PIO_HZ) * 256u) / JOYBUS_PIO_HZ);
+}
+
+// Fastest clean clock at or below target_khz that the PLL can produce
+// exactly, or 0 if there is none down to JOYBUS_SYS_CLOCK_MIN_KHZ. Each
+// candidate is logged.
+static inline uint32_t joybus_clock_select(uint32_t target_khz)
+{
+    uint32_t khz = target_khz - (target_khz % JOYBUS_CLOCK_STEP_KHZ);
+    uint vco, postdiv1, postdiv2;
+
+    for (; khz >= JOYBUS_SYS_CLOCK_MIN_KHZ; khz -= JOYBUS_CLOCK_STEP_KHZ) {
+        if (check_sys_clock_khz(khz, &vco, &postdiv1, &postdiv2)) {
+            printf("[joybus] %luMHz: PLL %luMHz/%u/%u\n", (unsigned long)(khz / 1000),
+                   (unsigned long)(vco / 1000000), postdiv1, postdiv2);
+            return khz;
+        }
+        printf("[joybus] %luMHz: not reachable by the PLL\n", (unsigned long)(khz / 1000));
+    }
+    return 0;
+}
+
+// Switch clk_sys to the joybus target. Returns the clock now running in kHz.
+// Everything is logged before the switch; callers re-init stdio afterwards
+// so UART baud divisors follow the change.
+static inline uint32_t joybus_clock_init(void)
+{
+    uint32_t current_khz = clock_get_hz(clk_sys) / 1000;
+    uint32_t target_khz = JOYBUS_SYS_CLOCK_KHZ;
+
+    if (target_khz > JOYBUS_SYS_CLOCK_MAX_KHZ) {
+        printf("[joybus] Target %luMHz is above the %luMHz limit, capping\n",
+               (unsigned long)(target_khz / 1000), (unsigned long)(JOYBUS_SYS_CLOCK_MAX_KHZ / 1000));
+        target_khz = JOYBUS_SYS_CLOCK_MAX_KHZ;
+    }
+
+    uint32_t khz = joybus_clock_select(target_khz);
+
+    if (khz == 0) {
+        printf("[joybus] No clean clock up to %luMHz, staying at %luMHz\n",
+               (unsigned long)(target_khz / 1000), (unsigned long)(current_khz / 1000));
+        return current_khz;
+    }
+    if (khz == current_khz) {
+        printf("[joybus] Already running at %luMHz\n", (unsigned long)(khz / 1000));
+        return khz;
+    }
+    printf("[joybus] Switching clk_sys %luMHz -> %luMHz\n",
+           (unsigned long)(current_khz / 1000), (unsigned long)(khz / 1000));
+    return set_sys_clock_khz(khz, false) ? khz : current_khz;
+}
+
+// Log the divider joybus-pio set on a state machine and compare it with the
+// one the running clock calls for. Returns true if it is a whole divider.
+static inline bool joybus_clock_check(PIO pio, uint sm)
+{
+    uint32_t sys_hz = clock_get_hz(clk_sys);
+    uint32_t clkdiv = pio->sm[sm].clkdiv;
+    uint16_t sm_int = (uint16_t)((clkdiv & PIO_SM0_CLKDIV_INT_BITS) >> PIO_SM0_CLKDIV_INT_LSB);
+    uint8_t sm_frac = (uint8_t)((clkdiv & PIO_SM0_CLKDIV_FRAC_BITS) >> PIO_SM0_CLKDIV_FRAC_LSB);
+    uint16_t want_int;
+    uint8_t want_frac;
+
+    joybus_clock_divider(sys_hz, &want_int, &want_frac);
+
+    printf("[joybus] clk_sys=%luMHz, PIO%u SM%u divider %u+%u/256%s\n",
+           (unsigned long)(sys_hz / 1000000), (unsigned)pio_get_index(pio), sm,
+           sm_int, sm_frac, sm_frac == 0 ? "" : " (fractional, bit edges will jitter)");
+    if (sm_int != want_int || sm_frac != want_frac) {
+        printf("[joybus]   expected %u+%u/256 for %luMHz\n", want_int, want_frac,
+               (unsigned long)(sys_hz / 1000000));
+    }
+    return sm_frac == 0;
+}
+
+#endif // JOYBUS_CLOCK_H
@@ -3,13 +3,12 @@
 // Copyright 2024 Robert Dale Smith
 //
 // Single-sector journaled storage (16 slots × 256 bytes).
+// Writes go through the flash scheduler (core/services/storage/flash_sched.c).
 
 #include "pad_config_storage.h"
+#include "core/services/storage/flash_sched.h"
 #include "pico/stdlib.h"
 #include "hardware/flash.h"
-#include "hardware/sync.h"
-#include "pico/flash.h"
-#include "tusb.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -31,18 +30,27 @@
 
 static uint32_t pad_sequence = 0;
 
-static const pad_config_flash_t* get_slot(uint8_t index) {
-    return (const pad_config_flash_t*)(XIP_BASE + PAD_CONFIG_SECTOR_OFFSET + (index * PAD_SLOT_SIZE));
+// Slot handed to the flash scheduler but not yet programmed (-1 = none)
+static int queued_slot = -1;
+
+static uint32_t slot_offset(uint8_t slot) {
+    return PAD_CONFIG_SECTOR_OFFSET + (slot * PAD_SLOT_SIZE);
+}
+
+// Slot contents as they will be once queued writes land
+static void read_slot(uint8_t index, void* out, uint32_t len) {
+    flash_sched_read(slot_offset(index), out, len);
 }
 
 static int find_newest_slot(void) {
     int newest = -1;
     uint32_t highest = 0;
     for (uint8_t i = 0; i < PAD_SLOTS; i++) {
-        const pad_config_flash_t* slot = get_slot(i);
-        if (slot->magic == PAD_CONFIG_MAGIC && slot->sequence != 0xFFFFFFFF) {
-            if (newest == -1 || slot->sequence > highest) {
-                highest = slot->sequence;
+        uint32_t header[2];  // magic, sequence
+        read_slot(i, header, sizeof(header));
+        if (header[0] == PAD_CONFIG_MAGIC && header[1] != 0xFFFFFFFF) {
+            if (newest == -1 || header[1] > highest) {
+                highest = header[1];
                 newest = i;
             }
         }
@@ -52,53 +60,30 @@ static int find_newest_slot(void) {
 
 static int find_empty_slot(void) {
     for (uint8_t i = 0; i < PAD_SLOTS; i++) {
-        if (get_slot(i)->sequence == 0xFFFFFFFF) return i;
+        uint32_t header[2];
+        read_slot(i, header, sizeof(header));
+        if (header[1] == 0xFFFFFFFF) return i;
     }
     return -1;
 }
 
-static void flush_output(void) {
-#if CFG_TUD_ENABLED
-    tud_task(); sleep_ms(20); tud_task();
-#else
-    sleep_ms(20);
-#endif
-}
-
-typedef struct { uint32_t offset; const uint8_t* data; } page_params_t;
-typedef struct { uint32_t offset; } erase_params_t;
-
-static void __no_inline_not_in_flash_func(page_worker)(void* p) {
-    page_params_t* pp = (page_params_t*)p;
-    flash_range_program(pp->offset, pp->data, FLASH_PAGE_SIZE);
-}
-
-static void __no_inline_not_in_flash_func(erase_worker)(void* p) {
-    erase_params_t* ep = (erase_params_t*)p;
-    flash_range_erase(ep->offset, FLASH_SECTOR_SIZE);
-}
-
-static void write_page(uint8_t slot, const pad_config_flash_t* config) {
-    static pad_config_flash_t buf;
-    memcpy(&buf, config, sizeof(buf));
-    uint32_t offset = PAD_CONFIG_SECTOR_OFFSET + (slot * PAD_SLOT_SIZE);
-    page_params_t params = { .offset = offset, .data = (const uint8_t*)&buf };
-    if (flash_safe_execute(page_worker, &params, UINT32_MAX) != PICO_OK) {
-        uint32_t ints = save_and_disable_interrupts();
-        flash_range_program(offset, (const uint8_t*)&buf, FLASH_PAGE_SIZE);
-        restore_interrupts(ints);
+static bool has_queued_config(void) {
+    if (queued_slot < 0) return false;
+    if (!flash_sched_is_queued(slot_offset(queued_slot))) {
+        queued_slot = -1;
+        return false;
     }
+    return true;
 }
 
-static void erase_sector(void) {
+static bool erase_sector(void) {
     printf("[pad_config] Erasing sector at 0x%lX\n", (unsigned long)PAD_CONFIG_SECTOR_OFFSET);
-    flush_output();
-    erase_params_t params = { .offset = PAD_CONFIG_SECTOR_OFFSET };
-    if (flash_safe_execute(erase_worker, &params, UINT32_MAX) != PICO_OK) {
-        uint32_t ints = save_and_disable_interrupts();
-        flash_range_erase(PAD_CONFIG_SECTOR_OFFSET, FLASH_SECTOR_SIZE);
-        restore_interrupts(ints);
+    queued_slot = -1;
+    if (!flash_sched_erase(PAD_CONFIG_SECTOR_OFFSET)) {
+        printf("[pad_config] Flash queue full, erase not queued\n");
+        return false;
     }
+    return true;
 }
 
 // ============================================================================
@@ -108,7 +93,9 @@ static void erase_sector(void) {
 void pad_config_storage_init(void) {
     int newest = find_newest_slot();
     if (newest >= 0) {
-        pad_sequence = get_slot(newest)->sequence;
+        uint32_t header[2];
+        read_slot(newest, header, sizeof(header));
+        pad_sequence = header[1];
         printf("[pad_config] Found config in slot %d (seq=%lu)\n",
                newest, (unsigned long)pad_sequence);
     } else {
@@ -120,7 +107,7 @@ void pad_config_storage_init(void) {
 bool pad_config_storage_load(pad_config_flash_t* out) {
     int newest = find_newest_slot();
     if (newest < 0) return false;
-    memcpy(out, get_slot(newest), sizeof(pad_config_flash_t));
+    read_slot(newest, out, sizeof(pad_config_flash_t));
     pad_sequence = out->sequence;
     return true;
 }
@@ -131,19 +118,28 @@ void pad_config_storage_save(const pad_config_flash_t* config) {
     write_data.magic = PAD_CONFIG_MAGIC;
     write_data.sequence = ++pad_sequence;
 
-    int slot = find_empty_slot();
+    // Previous save still queued - overwrite it in place
+    int slot = has_queued_config() ? queued_slot : find_empty_slot();
     if (slot < 0) {
-        erase_sector();
+        if (!erase_sector()) {
+            pad_sequence--;
+            return;
+        }
         slot = 0;
     }
 
     printf("[pad_config] Writing to slot %d (seq=%lu)\n",
            slot, (unsigned long)write_data.sequence);
-    write_page(slot, &write_data);
+    if (!flash_sched_program(slot_offset(slot), &write_data, sizeof(write_data))) {
+        printf("[pad_config] Flash queue full, save not queued\n");
+        pad_sequence--;
+        return;
+    }
+    queued_slot = slot;
 }
 
 void pad_config_storage_erase(void) {
-    erase_sector();
+    if (!erase_sector()) return;
     pad_sequence = 0;
     printf("[pad_config] Config erased\n");
 }
@@ -642,7 +642,7 @@ int pad_input_add_device(const pad_device_config_t* config) {
 
     // Initialize input event for this device
     init_input_event(&pad_events[index]);
-    pad_events[index].dev_addr = 0xF0 + index;  // Virtual address for pad devices
+    pad_events[index].dev_addr = DEV_ADDR_PAD_BASE + index;  // Virtual address for pad devices
     pad_events[index].instance = index;
     pad_events[index].type = INPUT_TYPE_GAMEPAD;
     pad_events[index].transport = INPUT_TRANSPORT_GPIO;
@@ -90,6 +90,16 @@ void platform_reboot_bootloader(void) {
   platform_reboot();
 }
 
+// ============================================================================
+// IDLE CORE JOBS
+// ============================================================================
+
+bool platform_idle_core_submit(void (*job)(void)) {
+  // Single core: callers run the job inline.
+  (void)job;
+  return false;
+}
+
 // Note: tusb_time_millis_api()/tusb_time_delay_ms_api() (used by the ch32 USB
 // drivers) are provided by the TinyUSB board layer (hw/bsp/board.c). A future
 // standalone ch32/ build without that board layer must supply them itself.
@@ -134,3 +134,10 @@ void platform_clear_usb_persist(void)
 {
     chip_usb_set_persist_flags(0);
 }
+
+bool platform_idle_core_submit(void (*job)(void))
+{
+    // No dedicated idle core in this build: callers run the job inline.
+    (void)job;
+    return false;
+}
@@ -93,3 +93,10 @@ void platform_reboot_bootloader(void)
     NRF_POWER->GPREGRET = 0x57;
     sys_reboot(SYS_REBOOT_COLD);
 }
+
+bool platform_idle_core_submit(void (*job)(void))
+{
+    // No dedicated idle core in this build: callers run the job inline.
+    (void)job;
+    return false;
+}
@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 
 // RP2040 __not_in_flash_func places functions in RAM for timing.
 // On non-RP2040 platforms this is not needed — define as no-op.
@@ -41,4 +42,9 @@ void platform_reboot(void);
 // Reboot into bootloader (UF2/DFU mode)
 void platform_reboot_bootloader(void);
 
+// Run a one-shot job on an otherwise idle core so long computations (e.g.
+// console auth crypto) don't stall the main loop. Returns false if no idle
+// core is available or a job is already queued; the caller runs it inline.
+bool platform_idle_core_submit(void (*job)(void));
+
 #endif // PLATFORM_H
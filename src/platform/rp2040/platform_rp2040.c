@@ -6,7 +6,9 @@
 #include "pico/stdlib.h"
 #include "pico/unique_id.h"
 #include "pico/bootrom.h"
+#include "pico/multicore.h"
 #include "hardware/watchdog.h"
+#include "hardware/sync.h"
 #include <string.h>
 
 uint32_t platform_time_ms(void)
@@ -52,3 +54,43 @@ void platform_reboot_bootloader(void)
 {
     reset_usb_boot(0, 0);
 }
+
+// ============================================================================
+// IDLE CORE JOBS
+// ============================================================================
+
+// Core 1 enters platform_idle_core_run() when no output claims it (see
+// core1_wrapper in main.c). Core 0 posts a job pointer and wakes it with SEV.
+// Jobs run on core 1's stack; the XSM3 challenge job needs more than the
+// SDK's 2KB default (joypad_target_common sets 4KB).
+#define IDLE_CORE_MIN_STACK_SIZE 4096
+_Static_assert(PICO_CORE1_STACK_SIZE >= IDLE_CORE_MIN_STACK_SIZE,
+               "core 1 stack too small for idle core jobs");
+static volatile bool idle_core_available = false;
+static void (*volatile idle_core_job)(void) = NULL;
+
+bool platform_idle_core_submit(void (*job)(void))
+{
+    if (!idle_core_available || idle_core_job != NULL) return false;
+    idle_core_job = job;
+    __dmb();
+    __sev();
+    return true;
+}
+
+void platform_idle_core_run(void)
+{
+    idle_core_available = true;
+    __dmb();
+    while (1) {
+        void (*job)(void) = idle_core_job;
+        if (job) {
+            __dmb();
+            job();
+            __dmb();
+            idle_core_job = NULL;
+        } else {
+            __wfe();
+        }
+    }
+}
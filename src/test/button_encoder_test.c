@@ -0,0 +1,234 @@
+// button_encoder_test.c - Host test: table encoders vs. the branch encoders
+//
+// Every output converted to core/button_encoder.h gets its old per-button
+// branch encoder kept here verbatim as the golden reference. Each encoder is
+// checked over all 2^24 JP_BUTTON_* states, including the bits a format
+// doesn't map, so a map edit that drops or moves a button fails here.
+//
+// Build and run: make host-test
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "core/buttons.h"
+#include "core/button_encoder.h"
+#include "native/device/nuon/nuon_button_map.h"
+#include "native/device/amiga/amiga_button_map.h"
+#include "usb/usbd/modes/xinput_button_map.h"
+#include "usb/usbd/modes/switch_button_map.h"
+#include "usb/usbd/modes/ps4_button_map.h"
+#include "usb/usbd/modes/gc_adapter_button_map.h"
+
+#define ALL_BUTTON_STATES   (1u << 24)
+#define ARRAY_COUNT(a)      (sizeof(a) / sizeof((a)[0]))
+
+// ============================================================================
+// GOLDEN ENCODERS (branch form, as shipped before the table encoder)
+// ============================================================================
+
+static uint32_t golden_nuon(uint32_t buttons)
+{
+  uint32_t nuon_buttons = 0x0080;
+
+  nuon_buttons |= (buttons & JP_BUTTON_B2) ? NUON_BUTTON_C_DOWN : 0;  // Circle -> C-DOWN
+  nuon_buttons |= (buttons & JP_BUTTON_B1) ? NUON_BUTTON_A  : 0;  // Cross -> A
+  nuon_buttons |= (buttons & JP_BUTTON_S2) ? NUON_BUTTON_START : 0;  // Option -> START
+  nuon_buttons |= (buttons & JP_BUTTON_S1) ? NUON_BUTTON_NUON : 0;  // Share -> NUON/Z
+  nuon_buttons |= (buttons & JP_BUTTON_DD) ? NUON_BUTTON_DOWN : 0;  // Dpad Down -> D-DOWN
+  nuon_buttons |= (buttons & JP_BUTTON_DL) ? NUON_BUTTON_LEFT : 0;  // Dpad Left -> D-LEFT
+  nuon_buttons |= (buttons & JP_BUTTON_DU) ? NUON_BUTTON_UP : 0;  // Dpad Up -> D-UP
+  nuon_buttons |= (buttons & JP_BUTTON_DR) ? NUON_BUTTON_RIGHT : 0;  // Dpad Right -> D-RIGHT
+  nuon_buttons |= (buttons & JP_BUTTON_L1) ? NUON_BUTTON_L : 0;  // L1 -> L
+  nuon_buttons |= (buttons & JP_BUTTON_R1) ? NUON_BUTTON_R : 0;  // R1 -> R
+  nuon_buttons |= (buttons & JP_BUTTON_B3) ? NUON_BUTTON_B : 0;  // Square -> B
+  nuon_buttons |= (buttons & JP_BUTTON_B4) ? NUON_BUTTON_C_LEFT : 0;  // Triangle -> C-LEFT
+  nuon_buttons |= (buttons & JP_BUTTON_L2) ? NUON_BUTTON_C_UP : 0;  // L2 -> C-UP
+  nuon_buttons |= (buttons & JP_BUTTON_R2) ? NUON_BUTTON_C_RIGHT : 0;  // R2 -> C-RIGHT
+
+  return nuon_buttons;
+}
+
+static uint8_t golden_cd32(uint32_t buttons)
+{
+    uint8_t b = 0xFF;
+    if (buttons & JP_BUTTON_B1) b &= ~(1 << CD32_BIT_RED);
+    if (buttons & JP_BUTTON_B2) b &= ~(1 << CD32_BIT_BLUE);
+    if (buttons & JP_BUTTON_B3) b &= ~(1 << CD32_BIT_GREEN);
+    if (buttons & JP_BUTTON_B4) b &= ~(1 << CD32_BIT_YELLOW);
+    if (buttons & JP_BUTTON_R1) b &= ~(1 << CD32_BIT_RFRONT);
+    if (buttons & JP_BUTTON_L1) b &= ~(1 << CD32_BIT_LFRONT);
+    if (buttons & JP_BUTTON_S2) b &= ~(1 << CD32_BIT_PAUSE);
+    return b;
+}
+
+// Returns buttons0 | buttons1 << 8
+static uint32_t golden_xinput(uint32_t buttons)
+{
+    uint8_t buttons0 = 0;
+    if (buttons & JP_BUTTON_DU) buttons0 |= XINPUT_BTN_DPAD_UP;
+    if (buttons & JP_BUTTON_DD) buttons0 |= XINPUT_BTN_DPAD_DOWN;
+    if (buttons & JP_BUTTON_DL) buttons0 |= XINPUT_BTN_DPAD_LEFT;
+    if (buttons & JP_BUTTON_DR) buttons0 |= XINPUT_BTN_DPAD_RIGHT;
+    if (buttons & JP_BUTTON_S2) buttons0 |= XINPUT_BTN_START;
+    if (buttons & JP_BUTTON_S1) buttons0 |= XINPUT_BTN_BACK;
+    if (buttons & JP_BUTTON_L3) buttons0 |= XINPUT_BTN_L3;
+    if (buttons & JP_BUTTON_R3) buttons0 |= XINPUT_BTN_R3;
+
+    uint8_t buttons1 = 0;
+    if (buttons & JP_BUTTON_L1) buttons1 |= XINPUT_BTN_LB;
+    if (buttons & JP_BUTTON_R1) buttons1 |= XINPUT_BTN_RB;
+    if (buttons & JP_BUTTON_A1) buttons1 |= XINPUT_BTN_GUIDE;
+    if (buttons & JP_BUTTON_B1) buttons1 |= XINPUT_BTN_A;
+    if (buttons & JP_BUTTON_B2) buttons1 |= XINPUT_BTN_B;
+    if (buttons & JP_BUTTON_B3) buttons1 |= XINPUT_BTN_X;
+    if (buttons & JP_BUTTON_B4) buttons1 |= XINPUT_BTN_Y;
+
+    return buttons0 | ((uint32_t)buttons1 << 8);
+}
+
+static uint16_t golden_switch(uint32_t buttons)
+{
+    uint16_t out = 0;
+    if (buttons & JP_BUTTON_B1) out |= SWITCH_MASK_B;     // B1 (bottom) -> B
+    if (buttons & JP_BUTTON_B2) out |= SWITCH_MASK_A;     // B2 (right)  -> A
+    if (buttons & JP_BUTTON_B3) out |= SWITCH_MASK_Y;     // B3 (left)   -> Y
+    if (buttons & JP_BUTTON_B4) out |= SWITCH_MASK_X;     // B4 (top)    -> X
+    if (buttons & JP_BUTTON_L1) out |= SWITCH_MASK_L;     // L
+    if (buttons & JP_BUTTON_R1) out |= SWITCH_MASK_R;     // R
+    if (buttons & JP_BUTTON_L2) out |= SWITCH_MASK_ZL;    // ZL
+    if (buttons & JP_BUTTON_R2) out |= SWITCH_MASK_ZR;    // ZR
+    if (buttons & JP_BUTTON_S1) out |= SWITCH_MASK_MINUS; // Minus
+    if (buttons & JP_BUTTON_S2) out |= SWITCH_MASK_PLUS;  // Plus
+    if (buttons & JP_BUTTON_L3) out |= SWITCH_MASK_L3;
+    if (buttons & JP_BUTTON_R3) out |= SWITCH_MASK_R3;
+    if (buttons & JP_BUTTON_A1) out |= SWITCH_MASK_HOME;
+    if (buttons & JP_BUTTON_A2) out |= SWITCH_MASK_CAPTURE;
+    return out;
+}
+
+// Returns report bytes 5 (face bits only), 6 and 7 packed as bits 0-23
+static uint32_t golden_ps4(uint32_t buttons)
+{
+    uint8_t face_buttons = 0;
+    if (buttons & JP_BUTTON_B3) face_buttons |= 0x10;  // Square
+    if (buttons & JP_BUTTON_B1) face_buttons |= 0x20;  // Cross
+    if (buttons & JP_BUTTON_B2) face_buttons |= 0x40;  // Circle
+    if (buttons & JP_BUTTON_B4) face_buttons |= 0x80;  // Triangle
+
+    uint8_t byte6 = 0;
+    if (buttons & JP_BUTTON_L1) byte6 |= 0x01;  // L1
+    if (buttons & JP_BUTTON_R1) byte6 |= 0x02;  // R1
+    if (buttons & JP_BUTTON_L2) byte6 |= 0x04;  // L2 (digital)
+    if (buttons & JP_BUTTON_R2) byte6 |= 0x08;  // R2 (digital)
+    if (buttons & JP_BUTTON_S1) byte6 |= 0x10;  // Share
+    if (buttons & JP_BUTTON_S2) byte6 |= 0x20;  // Options
+    if (buttons & JP_BUTTON_L3) byte6 |= 0x40;  // L3
+    if (buttons & JP_BUTTON_R3) byte6 |= 0x80;  // R3
+
+    uint8_t byte7 = 0;
+    if (buttons & JP_BUTTON_A1) byte7 |= 0x01;  // PS button
+    if (buttons & JP_BUTTON_A2) byte7 |= 0x02;  // Touchpad click
+
+    return face_buttons | ((uint32_t)byte6 << 8) | ((uint32_t)byte7 << 16);
+}
+
+// Fills the port through the bitfields, as the old encoder did
+static void golden_gc_adapter(uint32_t buttons, gc_adapter_port_t* port)
+{
+    port->a = (buttons & JP_BUTTON_B2) ? 1 : 0;
+    port->b = (buttons & JP_BUTTON_B1) ? 1 : 0;
+    port->x = (buttons & JP_BUTTON_B4) ? 1 : 0;
+    port->y = (buttons & JP_BUTTON_B3) ? 1 : 0;
+    port->z = (buttons & JP_BUTTON_R1) ? 1 : 0;
+    port->l = (buttons & JP_BUTTON_L2) ? 1 : 0;
+    port->r = (buttons & JP_BUTTON_R2) ? 1 : 0;
+    port->start = (buttons & JP_BUTTON_S2) ? 1 : 0;
+    port->dpad_up = (buttons & JP_BUTTON_DU) ? 1 : 0;
+    port->dpad_down = (buttons & JP_BUTTON_DD) ? 1 : 0;
+    port->dpad_left = (buttons & JP_BUTTON_DL) ? 1 : 0;
+    port->dpad_right = (buttons & JP_BUTTON_DR) ? 1 : 0;
+}
+
+// ============================================================================
+// CHECKS
+// ============================================================================
+
+static int failures = 0;
+
+static void report(const char* name, uint32_t buttons, uint32_t got, uint32_t want)
+{
+    if (got == want) {
+        printf("  %-12s ok\n", name);
+        return;
+    }
+    printf("  %-12s FAIL at buttons=0x%06lx: got 0x%06lx, want 0x%06lx\n",
+           name, (unsigned long)buttons, (unsigned long)got, (unsigned long)want);
+    failures++;
+}
+
+// Compare an encoder against its golden over every button state. Stops at the
+// first mismatch; returns through report() either way.
+#define CHECK_ALL(name, got_expr, want_expr) do {                   \
+    uint32_t buttons = 0, got = 0, want = 0;                        \
+    for (uint32_t b = 0; b < ALL_BUTTON_STATES; b++) {              \
+        buttons = b;                                                \
+        got = (got_expr);                                           \
+        want = (want_expr);                                         \
+        if (got != want) break;                                     \
+    }                                                               \
+    report(name, buttons, got, want);                               \
+} while (0)
+
+static uint32_t gc_adapter_bytes(const gc_adapter_port_t* port)
+{
+    return port->buttons1 | ((uint32_t)port->buttons2 << 8);
+}
+
+int main(void)
+{
+    button_encoder_t enc;
+
+    printf("button_encoder: %u states per encoder\n", ALL_BUTTON_STATES);
+
+    button_encoder_build(&enc, nuon_button_map, ARRAY_COUNT(nuon_button_map));
+    CHECK_ALL("nuon",
+              0x0080 | button_encoder_encode(&enc, buttons),
+              golden_nuon(buttons));
+
+    button_encoder_build(&enc, cd32_button_map, ARRAY_COUNT(cd32_button_map));
+    CHECK_ALL("amiga_cd32",
+              (uint8_t)~button_encoder_encode(&enc, buttons),
+              golden_cd32(buttons));
+
+    button_encoder_build(&enc, xinput_button_map, ARRAY_COUNT(xinput_button_map));
+    CHECK_ALL("xinput",
+              button_encoder_encode(&enc, buttons) & 0xFFFF,
+              golden_xinput(buttons));
+
+    button_encoder_build(&enc, switch_button_map, ARRAY_COUNT(switch_button_map));
+    CHECK_ALL("switch",
+              (uint16_t)button_encoder_encode(&enc, buttons),
+              golden_switch(buttons));
+
+    button_encoder_build(&enc, ps4_button_map, ARRAY_COUNT(ps4_button_map));
+    CHECK_ALL("ps4",
+              button_encoder_encode(&enc, buttons) & 0xFFFFF0,
+              golden_ps4(buttons));
+
+    // Same port layout through both paths: whole-byte writes vs. bitfields
+    button_encoder_build(&enc, gc_adapter_button_map, ARRAY_COUNT(gc_adapter_button_map));
+    gc_adapter_port_t table_port = {0}, golden_port = {0};
+    CHECK_ALL("gc_adapter",
+              (table_port.buttons1 = button_encoder_encode(&enc, buttons) & 0xFF,
+               table_port.buttons2 = (button_encoder_encode(&enc, buttons) >> 8) & 0x0F,
+               gc_adapter_bytes(&table_port)),
+              (golden_gc_adapter(buttons, &golden_port),
+               gc_adapter_bytes(&golden_port)));
+
+    if (failures) {
+        printf("button_encoder: %d encoder(s) FAILED\n", failures);
+        return 1;
+    }
+    printf("button_encoder: all encoders match\n");
+    return 0;
+}
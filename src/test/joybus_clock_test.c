@@ -0,0 +1,229 @@
+// joybus_clock_test.c - Host test: joybus clock selection and PIO dividers
+//
+// Runs joybus_clock_select() for every target from 100MHz to 250MHz against
+// a copy of pico-sdk's PLL search (12MHz crystal), and checks that each pick
+// is the fastest clean clock the PLL can produce and gives joybus a whole PIO
+// divider. Then runs joybus_clock_init() and joybus_clock_check() against a
+// simulated clk_sys and state machine, including a target above
+// JOYBUS_SYS_CLOCK_MAX_KHZ that must be capped.
+//
+// Build and run: make host-test
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Candidate logging from the header is only shown for the summary lines
+static bool log_enabled = false;
+
+static int test_log(const char* fmt, ...)
+{
+    if (!log_enabled) return 0;
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vprintf(fmt, ap);
+    va_end(ap);
+    return n;
+}
+
+// Build target for joybus_clock_init(), so the cap can be exercised
+static uint32_t init_target_khz = 130000;
+#define JOYBUS_SYS_CLOCK_KHZ init_target_khz
+
+#define printf test_log
+#include "native/joybus_clock.h"
+#undef printf
+
+#define TARGET_MIN_KHZ  100000
+#define TARGET_MAX_KHZ  250000
+
+// ============================================================================
+// SIMULATED SDK
+// ============================================================================
+
+#define XOSC_HZ         12000000u
+#define VCO_MIN_HZ      750000000u
+#define VCO_MAX_HZ      1600000000u
+
+static uint32_t sim_sys_hz = 125000000u;   // RP2040 boot clock
+
+uint32_t clock_get_hz(enum clock_index clk_index)
+{
+    (void)clk_index;
+    return sim_sys_hz;
+}
+
+// Same search as pico-sdk's check_sys_clock_hz(): exact output only
+bool check_sys_clock_khz(uint32_t freq_khz, uint *vco_out, uint *postdiv1_out, uint *postdiv2_out)
+{
+    uint32_t freq_hz = freq_khz * 1000u;
+    for (uint fbdiv = 320; fbdiv >= 16; fbdiv--) {
+        uint32_t vco_hz = fbdiv * XOSC_HZ;
+        if (vco_hz < VCO_MIN_HZ || vco_hz > VCO_MAX_HZ) continue;
+        for (uint postdiv1 = 7; postdiv1 >= 1; postdiv1--) {
+            for (uint postdiv2 = postdiv1; postdiv2 >= 1; postdiv2--) {
+                uint div = postdiv1 * postdiv2;
+                if (vco_hz % div == 0 && vco_hz / div == freq_hz) {
+                    *vco_out = vco_hz;
+                    *postdiv1_out = postdiv1;
+                    *postdiv2_out = postdiv2;
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+bool set_sys_clock_khz(uint32_t freq_khz, bool required)
+{
+    uint vco, pd1, pd2;
+    (void)required;
+    if (!check_sys_clock_khz(freq_khz, &vco, &pd1, &pd2)) return false;
+    sim_sys_hz = freq_khz * 1000u;
+    return true;
+}
+
+// Divider as the SDK's float clkdiv path programs it at port init
+static void sim_program_sm(pio_hw_t* pio, uint sm)
+{
+    float div = (float)clock_get_hz(clk_sys) / (float)JOYBUS_PIO_HZ;
+    uint16_t div_int = (uint16_t)div;
+    uint8_t div_frac = (uint8_t)((div - (float)div_int) * 256.0f);
+    pio->sm[sm].clkdiv = ((uint32_t)div_int << PIO_SM0_CLKDIV_INT_LSB) |
+                         ((uint32_t)div_frac << PIO_SM0_CLKDIV_FRAC_LSB);
+}
+
+// ============================================================================
+// CHECKS
+// ============================================================================
+
+static int failures = 0;
+
+#define CHECK(cond, ...) do {                                       \
+    if (!(cond)) {                                                  \
+        printf("  FAIL: " __VA_ARGS__);                             \
+        printf("\n");                                               \
+        failures++;                                                 \
+    }                                                               \
+} while (0)
+
+static bool pll_exact(uint32_t khz)
+{
+    uint vco, pd1, pd2;
+    return check_sys_clock_khz(khz, &vco, &pd1, &pd2);
+}
+
+// Every target: the pick is clean, reachable, not above the target, and
+// nothing clean and reachable was skipped between it and the target
+static void check_select_sweep(void)
+{
+    int picks = 0;
+
+    for (uint32_t target = TARGET_MIN_KHZ; target <= TARGET_MAX_KHZ; target += 1000) {
+        log_enabled = (target % JOYBUS_CLOCK_STEP_KHZ) == 0;
+        if (log_enabled) printf("target %luMHz:\n", (unsigned long)(target / 1000));
+        uint32_t khz = joybus_clock_select(target);
+        log_enabled = false;
+
+        CHECK(khz != 0, "target %lu: no clock selected", (unsigned long)target);
+        if (khz == 0) continue;
+        CHECK(khz <= target, "target %lu: picked %lu above it",
+              (unsigned long)target, (unsigned long)khz);
+        CHECK(joybus_clock_is_clean(khz * 1000u), "target %lu: picked %lu is not clean",
+              (unsigned long)target, (unsigned long)khz);
+        CHECK(pll_exact(khz), "target %lu: picked %lu is not PLL-exact",
+              (unsigned long)target, (unsigned long)khz);
+        for (uint32_t k = khz + JOYBUS_CLOCK_STEP_KHZ; k <= target; k += JOYBUS_CLOCK_STEP_KHZ) {
+            CHECK(!pll_exact(k), "target %lu: skipped reachable %lu",
+                  (unsigned long)target, (unsigned long)k);
+        }
+
+        uint16_t div_int;
+        uint8_t div_frac;
+        joybus_clock_divider(khz * 1000u, &div_int, &div_frac);
+        CHECK(div_frac == 0 && div_int * JOYBUS_PIO_HZ == khz * 1000u,
+              "%lu: divider %u+%u/256", (unsigned long)khz, div_int, div_frac);
+        picks++;
+    }
+    printf("  select: %d targets ok\n", picks);
+}
+
+// The clocks called out in joybus_clock.h
+static void check_known_clocks(void)
+{
+    static const struct { uint32_t khz; bool clean; uint16_t div_int; uint8_t div_frac; } known[] = {
+        { 125000, false, 12, 128 },
+        { 130000, true,  13, 0 },
+        { 150000, true,  15, 0 },
+        { 200000, true,  20, 0 },
+    };
+
+    for (unsigned i = 0; i < sizeof(known) / sizeof(known[0]); i++) {
+        uint16_t div_int;
+        uint8_t div_frac;
+        joybus_clock_divider(known[i].khz * 1000u, &div_int, &div_frac);
+        CHECK(joybus_clock_is_clean(known[i].khz * 1000u) == known[i].clean,
+              "%luMHz: clean flag", (unsigned long)(known[i].khz / 1000));
+        CHECK(div_int == known[i].div_int && div_frac == known[i].div_frac,
+              "%luMHz: divider %u+%u/256", (unsigned long)(known[i].khz / 1000), div_int, div_frac);
+        CHECK(pll_exact(known[i].khz), "%luMHz: not PLL-exact", (unsigned long)(known[i].khz / 1000));
+    }
+    printf("  known clocks: ok\n");
+}
+
+// Boot at 125MHz, switch, check the SM divider, and check a second init is a no-op
+static void check_init_and_check(void)
+{
+    pio_hw_t pio = {0};
+
+    sim_sys_hz = 125000000u;
+    sim_program_sm(&pio, 0);
+    CHECK(!joybus_clock_check(&pio, 0), "125MHz divider not flagged fractional");
+
+    uint32_t khz = joybus_clock_init();
+    CHECK(khz == init_target_khz, "init picked %lu, want %lu",
+          (unsigned long)khz, (unsigned long)init_target_khz);
+    CHECK(sim_sys_hz == khz * 1000u, "clk_sys %lu after init", (unsigned long)sim_sys_hz);
+
+    sim_program_sm(&pio, 0);
+    CHECK(joybus_clock_check(&pio, 0), "%luMHz divider flagged fractional",
+          (unsigned long)(khz / 1000));
+
+    CHECK(joybus_clock_init() == khz && sim_sys_hz == khz * 1000u, "second init changed clk_sys");
+    printf("  init/check: ok at %luMHz\n", (unsigned long)(khz / 1000));
+}
+
+// A target above the rated clock never switches past JOYBUS_SYS_CLOCK_MAX_KHZ
+static void check_init_cap(void)
+{
+    uint32_t want = joybus_clock_select(JOYBUS_SYS_CLOCK_MAX_KHZ);
+
+    for (init_target_khz = JOYBUS_SYS_CLOCK_MAX_KHZ + 1; init_target_khz <= TARGET_MAX_KHZ;
+         init_target_khz += JOYBUS_CLOCK_STEP_KHZ) {
+        sim_sys_hz = 125000000u;
+        uint32_t khz = joybus_clock_init();
+        CHECK(khz == want && khz <= JOYBUS_SYS_CLOCK_MAX_KHZ, "target %luMHz: init picked %lu, want %lu",
+              (unsigned long)(init_target_khz / 1000), (unsigned long)khz, (unsigned long)want);
+    }
+    init_target_khz = 130000;
+    printf("  init cap: ok at %luMHz\n", (unsigned long)(want / 1000));
+}
+
+int main(void)
+{
+    printf("joybus_clock: targets %u-%uMHz\n", TARGET_MIN_KHZ / 1000, TARGET_MAX_KHZ / 1000);
+
+    check_select_sweep();
+    check_known_clocks();
+    check_init_and_check();
+    check_init_cap();
+
+    if (failures) {
+        printf("joybus_clock: %d check(s) FAILED\n", failures);
+        return 1;
+    }
+    printf("joybus_clock: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,16 @@
+// hardware/clocks.h - Host-test stand-in for the Pico SDK clocks header
+//
+// Declarations only; a test that includes this supplies the functions.
+
+#ifndef TEST_STUB_HARDWARE_CLOCKS_H
+#define TEST_STUB_HARDWARE_CLOCKS_H
+
+#include "pico/stdlib.h"
+
+enum clock_index { clk_sys = 5 };
+
+uint32_t clock_get_hz(enum clock_index clk_index);
+bool check_sys_clock_khz(uint32_t freq_khz, uint *vco_out, uint *postdiv1_out, uint *postdiv2_out);
+bool set_sys_clock_khz(uint32_t freq_khz, bool required);
+
+#endif // TEST_STUB_HARDWARE_CLOCKS_H
@@ -0,0 +1,24 @@
+// hardware/pio.h - Host-test stand-in for the Pico SDK PIO header
+
+#ifndef TEST_STUB_HARDWARE_PIO_H
+#define TEST_STUB_HARDWARE_PIO_H
+
+#include "pico/stdlib.h"
+
+#define PIO_SM0_CLKDIV_INT_BITS     0xffff0000u
+#define PIO_SM0_CLKDIV_INT_LSB      16
+#define PIO_SM0_CLKDIV_FRAC_BITS    0x0000ff00u
+#define PIO_SM0_CLKDIV_FRAC_LSB     8
+
+typedef struct {
+    uint32_t clkdiv;
+} pio_sm_hw_t;
+
+typedef struct pio_hw {
+    pio_sm_hw_t sm[4];
+} pio_hw_t;
+typedef pio_hw_t *PIO;
+
+static inline uint pio_get_index(PIO pio) { (void)pio; return 0; }
+
+#endif // TEST_STUB_HARDWARE_PIO_H
@@ -0,0 +1,14 @@
+// pico/stdlib.h - Host-test stand-in for the Pico SDK base types
+
+#ifndef TEST_STUB_PICO_STDLIB_H
+#define TEST_STUB_PICO_STDLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef unsigned int uint;
+
+#define __not_in_flash_func(func_name)              func_name
+#define __no_inline_not_in_flash_func(func_name)    func_name
+
+#endif // TEST_STUB_PICO_STDLIB_H
@@ -0,0 +1 @@
+// Host-test stand-in for the pioasm-generated header (no programs needed)
@@ -0,0 +1,71 @@
+// tusb.h - Host-test stand-in for TinyUSB
+//
+// Only what the descriptor headers pulled in by the host tests use: the
+// device descriptor type, descriptor/class constants, and the config
+// descriptor builder. Values match TinyUSB so the size asserts still hold.
+
+#ifndef TEST_STUB_TUSB_H
+#define TEST_STUB_TUSB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TU_ATTR_PACKED              __attribute__((packed))
+#define TU_BIT(n)                   (1UL << (n))
+#define TU_U16_LOW(u16)             ((uint8_t)((u16) & 0x00ff))
+#define TU_U16_HIGH(u16)            ((uint8_t)(((u16) >> 8) & 0x00ff))
+#define U16_TO_U8S_LE(u16)          TU_U16_LOW(u16), TU_U16_HIGH(u16)
+
+enum {
+    TUSB_DESC_DEVICE        = 0x01,
+    TUSB_DESC_CONFIGURATION = 0x02,
+    TUSB_DESC_STRING        = 0x03,
+    TUSB_DESC_INTERFACE     = 0x04,
+    TUSB_DESC_ENDPOINT      = 0x05,
+};
+
+enum {
+    TUSB_CLASS_HID          = 3,
+    TUSB_CLASS_VENDOR_SPECIFIC = 0xFF,
+};
+
+enum {
+    TUSB_XFER_CONTROL       = 0,
+    TUSB_XFER_ISOCHRONOUS   = 1,
+    TUSB_XFER_BULK          = 2,
+    TUSB_XFER_INTERRUPT     = 3,
+};
+
+enum {
+    HID_DESC_TYPE_HID       = 0x21,
+    HID_DESC_TYPE_REPORT    = 0x22,
+};
+
+#define TUSB_DESC_CONFIG_ATT_REMOTE_WAKEUP  TU_BIT(5)
+#define TUSB_DESC_CONFIG_ATT_SELF_POWERED   TU_BIT(6)
+
+typedef struct TU_ATTR_PACKED {
+    uint8_t  bLength;
+    uint8_t  bDescriptorType;
+    uint16_t bcdUSB;
+    uint8_t  bDeviceClass;
+    uint8_t  bDeviceSubClass;
+    uint8_t  bDeviceProtocol;
+    uint8_t  bMaxPacketSize0;
+    uint16_t idVendor;
+    uint16_t idProduct;
+    uint16_t bcdDevice;
+    uint8_t  iManufacturer;
+    uint8_t  iProduct;
+    uint8_t  iSerialNumber;
+    uint8_t  bNumConfigurations;
+} tusb_desc_device_t;
+
+#define TUD_CONFIG_DESC_LEN         (9)
+#define TUD_HID_INOUT_DESC_LEN      (9 + 9 + 7 + 7)
+
+#define TUD_CONFIG_DESCRIPTOR(config_num, _itfcount, _stridx, _total_len, _attribute, _power_ma) \
+    9, TUSB_DESC_CONFIGURATION, U16_TO_U8S_LE(_total_len), _itfcount, config_num, _stridx, \
+    TU_BIT(7) | _attribute, (_power_ma) / 2
+
+#endif // TEST_STUB_TUSB_H
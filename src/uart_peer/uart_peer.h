@@ -31,9 +31,9 @@
 #define UART_PEER_CTS_PIN        26
 #define UART_PEER_RTS_PIN        27
 
-// Device address range for UART-peer devices — distinct from USB/BT, native
-// (0xD0+) and I2C peer (0xE0+). Used for loop-prevention + router slotting.
-#define UART_PEER_DEV_ADDR_BASE  0xC0
+// Device address range for UART-peer devices (see core/dev_addr.h). Used for
+// loop-prevention + router slotting.
+#define UART_PEER_DEV_ADDR_BASE  DEV_ADDR_UART_PEER_BASE
 
 // Frame message types (first byte of each framed packet)
 #define UART_PEER_MSG_EVENT      0x01   // producer -> consumer: input event
@@ -92,7 +92,7 @@ static void cdc_process_command(const char* cmd)
                          mode_num, usbd_get_mode_name((usb_output_mode_t)mode_num));
                 cdc_data_write_str(response);
                 cdc_data_flush();
-                // This will trigger a device reset
+                // Device re-enumerates in the new mode
                 usbd_set_mode((usb_output_mode_t)mode_num);
             }
         } else {
@@ -156,6 +156,9 @@ static void cdc_process_command(const char* cmd)
 #endif
 #if CFG_TUD_VENDOR
         cdc_data_write_str("  GBALINK?  - GBA Link USB bridge stats (frames, joybus timeouts)\r\n");
+#endif
+#ifdef CONFIG_GC2USB
+        cdc_data_write_str("  GCRATE?   - Current GameCube poll rate per port\r\n");
 #endif
     }
 #if CFG_TUD_VENDOR
@@ -264,6 +267,8 @@ static void cdc_process_command(const char* cmd)
         extern const char* gba_mb_detect_log_get(void);
         extern bool gc_host_gba_boot_attempted(uint8_t port);
         extern uint16_t gc_host_gba_read_fail_streak(uint8_t port);
+        extern void gc_host_gba_sample_counts(uint8_t port, uint32_t* fresh, uint32_t* repeat);
+        extern bool gc_host_gba_sequenced(uint8_t port);
 #ifndef GC_PIN_DATA
 #define GC_PIN_DATA 4
 #endif
@@ -276,6 +281,17 @@ static void cdc_process_command(const char* cmd)
                  (unsigned)gc_host_gba_read_fail_streak(0),
                  GC_PIN_DATA, pin_level);
         cdc_data_write_str(response);
+        // Fresh vs repeated JOYTR samples (sequenced payloads only; fresh
+        // counts key changes, repeat counts reads with nothing new).
+        // seq=none means the embedded payload predates the JOYTR stamp
+        // and every read counts as fresh.
+        uint32_t fresh, repeat;
+        gc_host_gba_sample_counts(0, &fresh, &repeat);
+        snprintf(response, sizeof(response),
+                 "GBADETECT: samples fresh=%lu repeat=%lu seq=%s\r\n",
+                 (unsigned long)fresh, (unsigned long)repeat,
+                 gc_host_gba_sequenced(0) ? "stamped" : "none");
+        cdc_data_write_str(response);
         if (log && log[0]) {
             cdc_data_write_str("--- last gc_host_task probe ---\r\n");
             cdc_data_write_str(log);
@@ -295,6 +311,19 @@ static void cdc_process_command(const char* cmd)
         cdc_data_write_str("GBARESET: cleared boot_attempted[0], probe "
                            "will fire on next gc_host_task tick\r\n");
     }
+    // GCRATE? — rate each port is polled at after step-down. 0 = no
+    // controller (or the port is running a GBA).
+    else if (strcmp(cmd, "GCRATE?") == 0) {
+        extern uint16_t gc_host_get_poll_rate(uint8_t port);
+#ifndef GC_MAX_PORTS
+#define GC_MAX_PORTS 1
+#endif
+        for (uint8_t port = 0; port < GC_MAX_PORTS; port++) {
+            snprintf(response, sizeof(response), "GCRATE: port%u=%uHz\r\n",
+                     port, gc_host_get_poll_rate(port));
+            cdc_data_write_str(response);
+        }
+    }
 #endif
     // BOOTSEL — drop into UF2 bootloader via the platform HAL so this
     // works on both RP2040 (reset_usb_boot) and ESP32-S3 (TinyUF2).
@@ -9,10 +9,14 @@
 #include "core/app_registry.h"
 #include "core/router/router.h"
 #include "core/services/storage/flash.h"
+#if !defined(PLATFORM_ESP32) && !defined(PLATFORM_NRF) && !defined(PLATFORM_CH32)
+#include "core/services/storage/flash_sched.h"
+#endif
 #include "core/services/leds/neopixel/ws2812.h"
 #include "core/services/profiles/profile.h"
 #include "core/services/players/manager.h"
 #include "core/services/players/feedback.h"
+#include "core/services/loadgen/loadgen.h"
 #include "platform/platform.h"
 #if !defined(PLATFORM_ESP32) && !defined(PLATFORM_NRF) && !defined(PLATFORM_CH32)
 #include "pico/stdio.h"
@@ -133,38 +137,142 @@ static char log_event_buf[384];
 // JSON HELPERS
 // ============================================================================
 
-// Simple JSON string extractor: finds "key":"value" and returns value
-// Returns NULL if not found, or pointer to value (not null-terminated)
-static const char* json_get_string(const char* json, const char* key,
-                                   int* out_len)
+// Each command message is indexed once: every "key": pair (at any depth,
+// matching the old strstr lookups) is recorded with its hash and a pointer
+// to the value. The json_get_* helpers then walk the short key index
+// instead of rescanning the payload for every field. A message with more
+// keys than the index holds is rejected rather than partially indexed.
+#define JSON_MAX_KEYS 96
+
+typedef struct {
+    const char* key;
+    const char* value;      // First char of the value (inside the quotes for strings)
+    uint16_t value_len;     // Strings only
+    uint16_t hash;
+    uint8_t key_len;
+    bool is_string;
+} json_key_t;
+
+static struct {
+    const char* src;
+    uint8_t count;
+    json_key_t keys[JSON_MAX_KEYS];
+} json_index;
+
+// FNV-1a, shared by the key index and the command table
+static uint32_t fnv1a(const char* s, size_t len)
 {
-    char search[64];
-    snprintf(search, sizeof(search), "\"%s\":\"", key);
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ (uint8_t)s[i]) * 16777619u;
+    }
+    return h;
+}
 
-    const char* start = strstr(json, search);
-    if (!start) return NULL;
+static inline bool json_is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
 
-    start += strlen(search);
-    const char* end = strchr(start, '"');
-    if (!end) return NULL;
+// Returns pointer to the closing quote (or the terminator)
+static const char* json_skip_string(const char* p)
+{
+    while (*p && *p != '"') {
+        if (*p == '\\' && p[1]) p++;
+        p++;
+    }
+    return p;
+}
 
-    if (out_len) *out_len = end - start;
-    return start;
+// Returns false if the message has more than JSON_MAX_KEYS keys
+static bool json_index_build(const char* json)
+{
+    json_index.src = json;
+    json_index.count = 0;
+
+    const char* p = json;
+    while (*p) {
+        if (*p != '"') {
+            p++;
+            continue;
+        }
+
+        const char* key = ++p;
+        p = json_skip_string(p);
+        if (!*p) break;
+        size_t key_len = p++ - key;
+
+        // A string followed by ':' is a key
+        const char* v = p;
+        while (json_is_space(*v)) v++;
+        if (*v != ':') continue;
+        v++;
+        while (json_is_space(*v)) v++;
+
+        if (json_index.count >= JSON_MAX_KEYS) {
+            return false;
+        }
+        if (key_len > 255) {
+            p = v;
+            continue;
+        }
+
+        json_key_t* k = &json_index.keys[json_index.count++];
+        k->key = key;
+        k->key_len = (uint8_t)key_len;
+        k->hash = (uint16_t)fnv1a(key, key_len);
+        k->value = v;
+        k->value_len = 0;
+        k->is_string = (*v == '"');
+
+        if (k->is_string) {
+            k->value = ++v;
+            v = json_skip_string(v);
+            k->value_len = (uint16_t)(v - k->value);
+            if (*v) v++;
+        }
+        p = v;
+    }
+    return true;
 }
 
-// Simple JSON integer extractor: finds "key":123 and returns value
-static bool json_get_int(const char* json, const char* key, int* out_val)
+// First occurrence of key, like strstr
+static const json_key_t* json_find(const char* json, const char* key)
+{
+    if (json != json_index.src) {
+        json_index_build(json);
+    }
+
+    size_t len = strlen(key);
+    uint16_t hash = (uint16_t)fnv1a(key, len);
+    for (uint8_t i = 0; i < json_index.count; i++) {
+        const json_key_t* k = &json_index.keys[i];
+        if (k->hash == hash && k->key_len == len && memcmp(k->key, key, len) == 0) {
+            return k;
+        }
+    }
+    return NULL;
+}
+
+// JSON string extractor: finds "key":"value" and returns value
+// Returns NULL if not found, or pointer to value (not null-terminated)
+static const char* json_get_string(const char* json, const char* key,
+                                   int* out_len)
 {
-    char search[64];
-    snprintf(search, sizeof(search), "\"%s\":", key);
+    const json_key_t* k = json_find(json, key);
+    if (!k || !k->is_string) return NULL;
 
-    const char* start = strstr(json, search);
-    if (!start) return false;
+    if (out_len) *out_len = k->value_len;
+    return k->value;
+}
 
-    start += strlen(search);
-    // Skip whitespace
-    while (*start == ' ' || *start == '\t') start++;
+// JSON integer extractor: finds "key":123 and returns value
+static bool json_get_int(const char* json, const char* key, int* out_val)
+{
+    const json_key_t* k = json_find(json, key);
+    if (!k) return false;
 
+    const char* start = k->value;
     if (*start == '-' || (*start >= '0' && *start <= '9')) {
         *out_val = atoi(start);
         return true;
@@ -172,18 +280,13 @@ static bool json_get_int(const char* json, const char* key, int* out_val)
     return false;
 }
 
-// Simple JSON bool extractor
+// JSON bool extractor
 static bool json_get_bool(const char* json, const char* key, bool* out_val)
 {
-    char search[64];
-    snprintf(search, sizeof(search), "\"%s\":", key);
-
-    const char* start = strstr(json, search);
-    if (!start) return false;
-
-    start += strlen(search);
-    while (*start == ' ' || *start == '\t') start++;
+    const json_key_t* k = json_find(json, key);
+    if (!k) return false;
 
+    const char* start = k->value;
     if (strncmp(start, "true", 4) == 0) {
         *out_val = true;
         return true;
@@ -194,6 +297,14 @@ static bool json_get_bool(const char* json, const char* key, bool* out_val)
     return false;
 }
 
+// Start of the elements of "key":[...], NULL if absent or not an array
+static const char* json_get_array(const char* json, const char* key)
+{
+    const json_key_t* k = json_find(json, key);
+    if (!k || *k->value != '[') return NULL;
+    return k->value + 1;
+}
+
 // Extract command name from JSON
 static bool json_get_cmd(const char* json, char* cmd_buf, size_t buf_size)
 {
@@ -284,8 +395,10 @@ static void cmd_mode_get(const char* json)
     (void)json;
     usb_output_mode_t mode = usbd_get_mode();
     snprintf(response_buf, sizeof(response_buf),
-             "{\"mode\":%d,\"name\":\"%s\"}",
-             (int)mode, usbd_get_mode_name(mode));
+             "{\"mode\":%d,\"name\":\"%s\",\"high_speed\":%s,\"report_hz\":%lu}",
+             (int)mode, usbd_get_mode_name(mode),
+             usbd_is_high_speed() ? "true" : "false",
+             (unsigned long)usbd_get_report_rate());
     send_json(response_buf);
 }
 
@@ -316,16 +429,8 @@ static void cmd_mode_set(const char* json)
              mode, usbd_get_mode_name((usb_output_mode_t)mode));
     send_json(response_buf);
 
-    // Flush then switch mode (triggers reboot)
-#ifdef PLATFORM_ESP32
-    tud_task_ext(1, false);
-    platform_sleep_ms(50);
-    tud_task_ext(1, false);
-#else
-    tud_task();
-    platform_sleep_ms(50);
-    tud_task();
-#endif
+    // usbd_set_mode lets the response drain before the device re-enumerates
+    // (or flushes it before the reset on platforms that still reboot)
     usbd_set_mode((usb_output_mode_t)mode);
 }
 
@@ -728,13 +833,9 @@ static void cmd_input_stream(const char* json)
 static int json_get_int_array(const char* json, const char* key,
                                uint8_t* out, int max_count)
 {
-    char search[64];
-    snprintf(search, sizeof(search), "\"%s\":[", key);
-
-    const char* start = strstr(json, search);
+    const char* start = json_get_array(json, key);
     if (!start) return 0;
 
-    start += strlen(search);
     int count = 0;
 
     while (*start && count < max_count) {
@@ -1413,18 +1514,25 @@ static void cmd_caps_get(const char* json)
         const InputInterface* it = ins ? ins[i] : NULL;
         if (!it) continue;
         const char* name = it->name ? it->name : "";
+        // Inputs still initializing (main loop bring-up) aren't queried
+        const input_bringup_t* up = app_registry_input_bringup(i);
+        bool ready = up && up->ready;
         bool has_conn = (it->is_connected != NULL);
-        bool connected = has_conn ? it->is_connected() : false;
+        bool connected = (has_conn && ready) ? it->is_connected() : false;
         bool has_devs = (it->get_device_count != NULL);
-        uint8_t devs = has_devs ? it->get_device_count() : 0;
+        uint8_t devs = (has_devs && ready) ? it->get_device_count() : 0;
         n = snprintf(out, rem,
                      "%s{\"name\":\"%s\",\"source\":%d,\"source_name\":\"%s\""
-                     ",\"connected\":%s,\"devices\":%u}",
+                     ",\"connected\":%s,\"devices\":%u"
+                     ",\"ready\":%s,\"ready_ms\":%lu,\"first_input_ms\":%lu}",
                      i == 0 ? "" : ",",
                      name, (int)it->source,
                      app_registry_input_source_name(it->source),
                      has_conn ? (connected ? "true" : "false") : "null",
-                     has_devs ? devs : 0);
+                     has_devs ? devs : 0,
+                     ready ? "true" : "false",
+                     (unsigned long)(up ? up->ready_ms : 0),
+                     (unsigned long)(up ? up->first_input_ms : 0));
         if (n < 0 || n >= rem) goto overflow;
         out += n; rem -= n;
     }
@@ -1907,6 +2015,119 @@ static void cmd_rumble_stop(const char* json)
     send_ok();
 }
 
+// ============================================================================
+// LOAD GENERATOR
+// ============================================================================
+
+// LOADGEN.START - {"devices":4,"rate":1000,"pattern":"random","transport":"usb"}
+static void cmd_loadgen_start(const char* json)
+{
+    loadgen_config_t cfg = {
+        .devices = 1,
+        .rate_hz = 1000,
+        .pattern = LOADGEN_PATTERN_RANDOM,
+        .transport = INPUT_TRANSPORT_USB,
+    };
+
+    int val;
+    if (json_get_int(json, "devices", &val)) {
+        if (val < 1 || val > LOADGEN_MAX_DEVICES) {
+            send_error("invalid devices");
+            return;
+        }
+        cfg.devices = (uint8_t)val;
+    }
+    if (json_get_int(json, "rate", &val)) {
+        if (val < 1 || val > 0xFFFF) {
+            send_error("invalid rate");
+            return;
+        }
+        cfg.rate_hz = (uint16_t)val;
+    }
+
+    int len;
+    const char* str = json_get_string(json, "pattern", &len);
+    if (str) {
+        cfg.pattern = LOADGEN_PATTERN_COUNT;
+        for (int p = 0; p < LOADGEN_PATTERN_COUNT; p++) {
+            const char* name = loadgen_pattern_name((loadgen_pattern_t)p);
+            if ((int)strlen(name) == len && strncmp(str, name, len) == 0) {
+                cfg.pattern = (loadgen_pattern_t)p;
+                break;
+            }
+        }
+    }
+
+    str = json_get_string(json, "transport", &len);
+    if (str) {
+        if (len == 3 && strncmp(str, "usb", 3) == 0) cfg.transport = INPUT_TRANSPORT_USB;
+        else if (len == 2 && strncmp(str, "bt", 2) == 0) cfg.transport = INPUT_TRANSPORT_BT_CLASSIC;
+        else if (len == 3 && strncmp(str, "ble", 3) == 0) cfg.transport = INPUT_TRANSPORT_BT_BLE;
+        else if (len == 6 && strncmp(str, "native", 6) == 0) cfg.transport = INPUT_TRANSPORT_NATIVE;
+        else {
+            send_error("invalid transport");
+            return;
+        }
+    }
+
+    if (!loadgen_start(&cfg)) {
+        send_error("invalid config");
+        return;
+    }
+    send_ok();
+}
+
+static void cmd_loadgen_stop(const char* json)
+{
+    (void)json;
+    loadgen_stop();
+    send_ok();
+}
+
+// LOADGEN.STATUS - throughput, drops and loop-time impact of the running load.
+// report_hz is what the USB device output actually delivered to the host.
+static void cmd_loadgen_status(const char* json)
+{
+    (void)json;
+    loadgen_config_t cfg;
+    loadgen_stats_t st;
+    loadgen_get_config(&cfg);
+    loadgen_get_stats(&st);
+
+    snprintf(response_buf, sizeof(response_buf),
+             "{\"running\":%s,\"devices\":%u,\"rate\":%u,\"pattern\":\"%s\","
+             "\"elapsed_ms\":%lu,\"submitted\":%lu,\"skipped\":%lu,\"submit_hz\":%lu,"
+             "\"loop_avg_us\":%lu,\"loop_max_us\":%lu,\"report_hz\":%lu}",
+             st.running ? "true" : "false",
+             cfg.devices, cfg.rate_hz, loadgen_pattern_name(cfg.pattern),
+             (unsigned long)st.elapsed_ms, (unsigned long)st.submitted,
+             (unsigned long)st.skipped, (unsigned long)st.submit_rate_hz,
+             (unsigned long)st.loop_avg_us, (unsigned long)st.loop_max_us,
+             (unsigned long)usbd_get_report_rate());
+    send_json(response_buf);
+}
+
+#if !defined(PLATFORM_ESP32) && !defined(PLATFORM_NRF) && !defined(PLATFORM_CH32)
+// FLASH.STATUS - flash scheduler counters and worst-case stall
+static void cmd_flash_status(const char* json)
+{
+    (void)json;
+    flash_sched_stats_t st;
+    flash_sched_get_stats(&st);
+
+    snprintf(response_buf, sizeof(response_buf),
+             "{\"queued\":%u,\"programs\":%lu,\"erases\":%lu,\"coalesced\":%lu,"
+             "\"batches\":%lu,\"forced\":%lu,\"refused\":%lu,\"overdue\":%lu,"
+             "\"stall_last_us\":%lu,\"stall_max_us\":%lu}",
+             st.queued, (unsigned long)st.programs, (unsigned long)st.erases,
+             (unsigned long)st.coalesced, (unsigned long)st.batches,
+             (unsigned long)st.forced, (unsigned long)st.refused,
+             (unsigned long)st.overdue, (unsigned long)st.stall_last_us,
+             (unsigned long)st.stall_max_us);
+    send_json(response_buf);
+}
+#endif
+
 // Call from main loop to auto-stop rumble after duration and drain log buffer
 void cdc_commands_task(void)
 {
@@ -2016,13 +2237,9 @@ static const char* const pad_button_names[] = {
 static int json_get_int16_array(const char* json, const char* key,
                                 int16_t* out, int max_count)
 {
-    char search[64];
-    snprintf(search, sizeof(search), "\"%s\":[", key);
-
-    const char* start = strstr(json, search);
+    const char* start = json_get_array(json, key);
     if (!start) return 0;
 
-    start += strlen(search);
     int count = 0;
 
     while (*start && count < max_count) {
@@ -2784,6 +3001,13 @@ static const cmd_entry_t commands[] = {
     // Rumble testing
     {"RUMBLE.TEST", cmd_rumble_test},
     {"RUMBLE.STOP", cmd_rumble_stop},
+    // Synthetic load generator
+    {"LOADGEN.START", cmd_loadgen_start},
+    {"LOADGEN.STOP", cmd_loadgen_stop},
+    {"LOADGEN.STATUS", cmd_loadgen_status},
+#if !defined(PLATFORM_ESP32) && !defined(PLATFORM_NRF) && !defined(PLATFORM_CH32)
+    {"FLASH.STATUS", cmd_flash_status},
+#endif
 #if defined(CONFIG_MAX3421) && CFG_TUH_MAX3421
     {"MAX3421.STATUS", cmd_max3421_status},
 #endif
@@ -2812,6 +3036,49 @@ static const cmd_entry_t commands[] = {
     {NULL, NULL}
 };
 
+// Open-addressed hash over commands[], built on the first lookup so BLE NUS
+// commands work in modes that never call cdc_commands_init(). Slots hold the
+// command index + 1 (0 = empty); at under half load a lookup is one hash
+// and usually a single strcmp.
+#define CMD_HASH_SIZE 128   // Power of two
+
+_Static_assert(sizeof(commands) / sizeof(commands[0]) - 1 <= CMD_HASH_SIZE / 2,
+               "CMD_HASH_SIZE too small for command table");
+
+static uint8_t cmd_slots[CMD_HASH_SIZE];
+static bool cmd_slots_built = false;
+
+static void cmd_table_build(void)
+{
+    memset(cmd_slots, 0, sizeof(cmd_slots));
+    for (uint8_t i = 0; commands[i].name; i++) {
+        const char* name = commands[i].name;
+        uint32_t slot = fnv1a(name, strlen(name)) & (CMD_HASH_SIZE - 1);
+        while (cmd_slots[slot]) {
+            slot = (slot + 1) & (CMD_HASH_SIZE - 1);
+        }
+        cmd_slots[slot] = i + 1;
+    }
+    cmd_slots_built = true;
+}
+
+static const cmd_entry_t* cmd_lookup(const char* cmd)
+{
+    if (!cmd_slots_built) {
+        cmd_table_build();
+    }
+
+    uint32_t slot = fnv1a(cmd, strlen(cmd)) & (CMD_HASH_SIZE - 1);
+    while (cmd_slots[slot]) {
+        const cmd_entry_t* entry = &commands[cmd_slots[slot] - 1];
+        if (strcmp(cmd, entry->name) == 0) {
+            return entry;
+        }
+        slot = (slot + 1) & (CMD_HASH_SIZE - 1);
+    }
+    return NULL;
+}
+
 // ============================================================================
 // PACKET HANDLER
 // ============================================================================
@@ -2828,6 +3095,12 @@ static void packet_handler(const cdc_packet_t* packet)
     memcpy(json, packet->payload, packet->length);
     json[packet->length] = '\0';
 
+    // Index all keys once; handlers' json_get_* calls read from it
+    if (!json_index_build(json)) {
+        send_error("too many keys");
+        return;
+    }
+
     // Extract command name
     char cmd[32];
     if (!json_get_cmd(json, cmd, sizeof(cmd))) {
@@ -2836,11 +3109,10 @@ static void packet_handler(const cdc_packet_t* packet)
     }
 
     // Find and execute handler
-    for (const cmd_entry_t* entry = commands; entry->name; entry++) {
-        if (strcmp(cmd, entry->name) == 0) {
-            entry->handler(json);
-            return;
-        }
+    const cmd_entry_t* entry = cmd_lookup(cmd);
+    if (entry) {
+        entry->handler(json);
+        return;
     }
 
     send_error("unknown command");
@@ -211,7 +211,7 @@ extern uint32_t tud_cdc_n_write_available(uint8_t itf);
 static bool stream_tx_backlogged(cdc_protocol_t* ctx)
 {
     // Custom transport (e.g. BLE NUS) — let it manage its own flow.
-    if (ctx->write) return false;
+    if (ctx->write) return ctx->backlogged ? ctx->backlogged() : false;
 #if CFG_TUD_CDC
     uint32_t avail = tud_cdc_n_write_available(0);
     uint32_t queued = (CFG_TUD_CDC_TX_BUFSIZE > avail)
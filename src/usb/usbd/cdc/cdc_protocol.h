@@ -91,12 +91,17 @@ typedef void (*cdc_packet_handler_t)(const cdc_packet_t* packet);
 // Transport write function: sends raw bytes over the underlying transport
 typedef uint32_t (*cdc_transport_write_t)(const uint8_t* data, uint16_t len);
 
+// Transport backlog check: true when a streaming event should be skipped
+// rather than queued (frame-granularity backpressure for custom transports)
+typedef bool (*cdc_transport_backlogged_t)(void);
+
 typedef struct {
     cdc_receiver_t rx;
     uint8_t tx_seq;             // Next TX sequence number (for EVT)
     uint8_t cmd_seq;            // Last received CMD sequence (for RSP)
     cdc_packet_handler_t handler;
     cdc_transport_write_t write; // Transport write function (NULL = USB CDC default)
+    cdc_transport_backlogged_t backlogged; // Custom transport backlog check (NULL = never)
     bool input_streaming;       // Input event streaming enabled
     bool log_streaming;         // Debug log streaming enabled
     bool ble_transport;         // True if transport is BLE NUS (slower throttle)
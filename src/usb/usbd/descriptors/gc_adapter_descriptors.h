@@ -44,6 +44,20 @@
 #define GC_ADAPTER_STATUS_NONE          0x00  // No controller, no rumble
 #define GC_ADAPTER_STATUS_CONNECTED     (GC_ADAPTER_STATUS_CONTROLLER | GC_ADAPTER_STATUS_RUMBLE)  // 0x14
 
+// Button bits within gc_adapter_port_t.buttons1 / buttons2
+#define GC_ADAPTER_BTN1_A            (1U << 0)
+#define GC_ADAPTER_BTN1_B            (1U << 1)
+#define GC_ADAPTER_BTN1_X            (1U << 2)
+#define GC_ADAPTER_BTN1_Y            (1U << 3)
+#define GC_ADAPTER_BTN1_DPAD_LEFT    (1U << 4)
+#define GC_ADAPTER_BTN1_DPAD_RIGHT   (1U << 5)
+#define GC_ADAPTER_BTN1_DPAD_DOWN    (1U << 6)
+#define GC_ADAPTER_BTN1_DPAD_UP      (1U << 7)
+#define GC_ADAPTER_BTN2_START        (1U << 0)
+#define GC_ADAPTER_BTN2_Z            (1U << 1)
+#define GC_ADAPTER_BTN2_R            (1U << 2)
+#define GC_ADAPTER_BTN2_L            (1U << 3)
+
 // Legacy defines (kept for compatibility but not used in new format)
 #define GC_ADAPTER_PORT_NONE         0x00
 #define GC_ADAPTER_PORT_WIRED        0x10
@@ -67,25 +81,31 @@ typedef struct __attribute__((packed)) {
     uint8_t status;
 
     // Byte 1: Buttons (A, B, X, Y, D-pad)
-    struct {
-        uint8_t a : 1;
-        uint8_t b : 1;
-        uint8_t x : 1;
-        uint8_t y : 1;
-        uint8_t dpad_left : 1;
-        uint8_t dpad_right : 1;
-        uint8_t dpad_down : 1;
-        uint8_t dpad_up : 1;
+    union {
+        struct {
+            uint8_t a : 1;
+            uint8_t b : 1;
+            uint8_t x : 1;
+            uint8_t y : 1;
+            uint8_t dpad_left : 1;
+            uint8_t dpad_right : 1;
+            uint8_t dpad_down : 1;
+            uint8_t dpad_up : 1;
+        };
+        uint8_t buttons1;     // Whole byte (GC_ADAPTER_BTN1_*)
     };
 
     // Byte 2: Buttons (Start, Z, R, L)
     // Bits 4-7 are unused in original GC protocol
-    struct {
-        uint8_t start : 1;
-        uint8_t z : 1;
-        uint8_t r : 1;
-        uint8_t l : 1;
-        uint8_t : 4;          // Reserved (bits 4-7)
+    union {
+        struct {
+            uint8_t start : 1;
+            uint8_t z : 1;
+            uint8_t r : 1;
+            uint8_t l : 1;
+            uint8_t : 4;      // Reserved (bits 4-7)
+        };
+        uint8_t buttons2;     // Whole byte (GC_ADAPTER_BTN2_*)
     };
 
     // Bytes 3-8: Analog axes
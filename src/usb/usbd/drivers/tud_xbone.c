@@ -21,10 +21,10 @@ __attribute__((weak)) bool xbone_auth_is_available(void) { return false; }
 #define XBONE_RX_BUFSIZE       64
 
 #define REPORT_QUEUE_SIZE      16
-#define REPORT_QUEUE_INTERVAL  15    // ms between queued reports
+#define REPORT_QUEUE_RESERVE   2     // Slots kept free for ACKs while chunks are queued
 #define ANNOUNCE_DELAY         500   // ms minimum before sending announce
 #define ANNOUNCE_MAX_WAIT      5000  // ms maximum wait for auth controller
-#define ACK_WAIT_TIMEOUT       2000  // ms to wait for ACK
+#define ACK_WAIT_TIMEOUT       500   // ms to wait for a lost ACK before moving on
 #define IDLE_REPORT_INTERVAL   25    // ms between idle reports during auth
 #define KEEPALIVE_INTERVAL     15000 // ms between keep-alive packets after auth
 
@@ -61,9 +61,9 @@ static xbone_interface_t xbone_itf[XBONE_ITF_COUNT];
 static xbone_driver_state_t driver_state = XBONE_STATE_IDLE;
 static bool xbox_powered_on = false;
 static bool waiting_ack = false;
+static uint8_t waiting_ack_cmd = 0;
 static uint32_t waiting_ack_timeout = 0;
 static uint32_t timer_announce = 0;
-static uint32_t last_report_queue_sent = 0;
 
 // XGIP protocol handlers
 static xgip_t outgoing_xgip;
@@ -120,23 +120,10 @@ static void queue_report(uint8_t* report, uint16_t len)
     queue_count++;
 }
 
-static bool dequeue_report(uint8_t* report, uint16_t* len)
-{
-    if (queue_count == 0) {
-        return false;
-    }
-
-    memcpy(report, report_queue[queue_head].report, report_queue[queue_head].len);
-    *len = report_queue[queue_head].len;
-
-    queue_head = (queue_head + 1) % REPORT_QUEUE_SIZE;
-    queue_count--;
-    return true;
-}
-
-static void set_ack_wait(void)
+static void set_ack_wait(uint8_t cmd)
 {
     waiting_ack = true;
+    waiting_ack_cmd = cmd;
     waiting_ack_timeout = platform_time_ms();
 }
 
@@ -165,6 +152,42 @@ static bool send_report_internal(uint8_t* report, uint16_t len)
     return false;
 }
 
+// Send the queue head whenever the IN endpoint is free. A busy endpoint
+// leaves it in place for the next update.
+static void drain_queue(void)
+{
+    if (queue_count == 0) {
+        return;
+    }
+
+    report_queue_item_t* item = &report_queue[queue_head];
+    if (send_report_internal(item->report, item->len)) {
+        queue_head = (queue_head + 1) % REPORT_QUEUE_SIZE;
+        queue_count--;
+    }
+}
+
+// Queue chunks of outgoing_xgip back to back, stopping after one that needs
+// an ACK (first, every 5th and last) so the console paces the transfer.
+// Returns true once the end of the message is queued.
+static bool queue_outgoing_chunks(void)
+{
+    while (queue_count < REPORT_QUEUE_SIZE - REPORT_QUEUE_RESERVE) {
+        queue_report(xgip_generate_packet(&outgoing_xgip),
+                    xgip_get_packet_length(&outgoing_xgip));
+
+        bool done = !xgip_is_chunked(&outgoing_xgip) || xgip_end_of_chunk(&outgoing_xgip);
+        if (xgip_get_packet_ack(&outgoing_xgip)) {
+            set_ack_wait(outgoing_xgip.header.command);
+            return done;
+        }
+        if (done) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // ============================================================================
 // TINYUSB CLASS DRIVER CALLBACKS
 // ============================================================================
@@ -286,7 +309,10 @@ static bool xbone_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t result,
         uint8_t cmd = xgip_get_command(&incoming_xgip);
 
         if (cmd == GIP_ACK_RESPONSE) {
-            waiting_ack = false;
+            // ACK payload byte 1 echoes the command it acknowledges
+            if (xferred_bytes > 5 && p_xbone->epout_buf[5] == waiting_ack_cmd) {
+                waiting_ack = false;
+            }
         } else if (cmd == GIP_DEVICE_DESCRIPTOR) {
             // Console requested descriptor
             xgip_reset(&outgoing_xgip);
@@ -300,6 +326,10 @@ static bool xbone_xfer_cb(uint8_t rhport, uint8_t ep_addr, xfer_result_t result,
             // Check for auth complete marker
             if (xgip_get_data_length(&incoming_xgip) == 2 &&
                 memcmp(xgip_get_data(&incoming_xgip), auth_ready, sizeof(auth_ready)) == 0) {
+                if (!auth_data.auth_completed) {
+                    printf("[tud_xbone] Auth complete %lums after enumeration\n",
+                           (unsigned long)(platform_time_ms() - timer_announce));
+                }
                 auth_data.auth_completed = true;
             }
 
@@ -417,6 +447,10 @@ void tud_xbone_update(void)
 {
     uint32_t now = platform_time_ms();
 
+    // Queued GIP traffic (ACKs, announce, descriptor and auth chunks) goes
+    // ahead of idle reports whenever the endpoint is free
+    drain_queue();
+
     // Keep the console from disconnecting (runs every iteration, independent of
     // ACK wait state — GP2040-CE process() does these unconditionally):
     //  - while auth is pending, push idle GIP_INPUT_REPORTs continuously
@@ -455,29 +489,13 @@ void tud_xbone_update(void)
         }
     }
 
-    // Process report queue
-    if (queue_count > 0 && (now - last_report_queue_sent) > REPORT_QUEUE_INTERVAL) {
-        uint8_t report[XBONE_ENDPOINT_SIZE];
-        uint16_t len;
-
-        if (dequeue_report(report, &len)) {
-            if (send_report_internal(report, len)) {
-                last_report_queue_sent = now;
-            } else {
-                // Failed - re-queue at front (by adjusting head back)
-                queue_head = (queue_head + REPORT_QUEUE_SIZE - 1) % REPORT_QUEUE_SIZE;
-                queue_count++;
-                platform_sleep_ms(REPORT_QUEUE_INTERVAL);
-            }
-        }
-    }
-
     // Don't proceed if waiting for ACK
     if (waiting_ack) {
         if ((now - waiting_ack_timeout) < ACK_WAIT_TIMEOUT) {
             return;
         }
         // ACK timeout - continue anyway
+        printf("[tud_xbone] ACK timeout (cmd=0x%02x), continuing\n", waiting_ack_cmd);
         waiting_ack = false;
     }
 
@@ -514,16 +532,9 @@ void tud_xbone_update(void)
             break;
 
         case XBONE_STATE_SEND_DESCRIPTOR:
-            queue_report(xgip_generate_packet(&outgoing_xgip),
-                        xgip_get_packet_length(&outgoing_xgip));
-
-            if (xgip_end_of_chunk(&outgoing_xgip)) {
+            if (queue_outgoing_chunks()) {
                 driver_state = XBONE_STATE_SETUP_AUTH;
             }
-
-            if (xgip_get_packet_ack(&outgoing_xgip)) {
-                set_ack_wait();
-            }
             break;
 
         case XBONE_STATE_SETUP_AUTH:
@@ -535,17 +546,11 @@ void tud_xbone_update(void)
                                    auth_data.sequence, 1, is_chunked, 1);
                 xgip_set_data(&outgoing_xgip, auth_data.buffer, auth_data.length);
                 auth_data.state = XBONE_AUTH_WAIT_DONGLE_TO_CONSOLE;
-            } else if (auth_data.state == XBONE_AUTH_WAIT_DONGLE_TO_CONSOLE) {
-                queue_report(xgip_generate_packet(&outgoing_xgip),
-                            xgip_get_packet_length(&outgoing_xgip));
-
-                if (!xgip_is_chunked(&outgoing_xgip) || xgip_end_of_chunk(&outgoing_xgip)) {
+            }
+            if (auth_data.state == XBONE_AUTH_WAIT_DONGLE_TO_CONSOLE) {
+                if (queue_outgoing_chunks()) {
                     auth_data.state = XBONE_AUTH_IDLE;
                 }
-
-                if (xgip_get_packet_ack(&outgoing_xgip)) {
-                    set_ack_wait();
-                }
             }
             break;
 
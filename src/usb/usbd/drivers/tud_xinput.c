@@ -54,6 +54,18 @@ static uint8_t _auth_buffer[48];    // Receive buffer for 0x82/0x87 data
 static uint8_t _auth_response[48];  // Response buffer for 0x83
 static uint8_t _auth_response_len;  // Response length for 0x83
 static uint8_t _auth_request_id;    // Which request triggered processing
+static uint8_t _auth_request_seq;   // Bumped on every 0x82/0x87 data stage
+
+// Challenge crypto runs off the main loop when an idle core is available.
+// The job works on its own copy of the challenge so a console retry that
+// overwrites _auth_buffer mid-computation can't corrupt it; the main loop
+// publishes the result (or discards it if a newer challenge arrived).
+static uint8_t _auth_job_challenge[48];
+static uint8_t _auth_job_request;
+static uint8_t _auth_job_seq;
+static uint8_t _auth_job_response[48];
+static volatile bool _auth_job_busy = false;
+static volatile bool _auth_job_done = false;
 
 // Per-board copy of the XSM3 identification packet. The serial-number field
 // (12 bytes at offset 5) is patched from the chip's unique ID so that two
@@ -280,6 +292,7 @@ bool tud_xinput_vendor_control_xfer_cb(uint8_t rhport, uint8_t stage, tusb_contr
                     // 0x82: Console sends 34-byte challenge init
                     TU_LOG1("[XINPUT] Auth: INIT_AUTH (%u bytes)\r\n", request->wLength);
                     _auth_request_id = XSM3_REQ_INIT_AUTH;
+                    _auth_request_seq++;
                     _auth_state = XSM3_AUTH_INIT_RECEIVED;
                     return true;
                 }
@@ -288,6 +301,7 @@ bool tud_xinput_vendor_control_xfer_cb(uint8_t rhport, uint8_t stage, tusb_contr
                     // 0x87: Console sends 22-byte verify challenge
                     TU_LOG1("[XINPUT] Auth: VERIFY (%u bytes)\r\n", request->wLength);
                     _auth_request_id = XSM3_REQ_VERIFY;
+                    _auth_request_seq++;
                     _auth_state = XSM3_AUTH_VERIFY_RECEIVED;
                     return true;
                 }
@@ -421,33 +435,67 @@ void tud_xinput_xsm3_init(void)
     TU_LOG1("[XINPUT] XSM3 auth initialized\r\n");
 }
 
+// Runs on the idle core (or inline as a fallback). libxsm3 keeps its state in
+// globals, so only one job is ever in flight.
+static void xsm3_challenge_job(void)
+{
+    if (_auth_job_request == XSM3_REQ_INIT_AUTH) {
+        // Challenge init: header + 0x28 payload + checksum = 0x2E = 46 bytes
+        xsm3_do_challenge_init(_auth_job_challenge);
+        memcpy(_auth_job_response, xsm3_challenge_response, XSM3_RESPONSE_INIT_LEN);
+    } else {
+        // Verify: header + 0x10 payload + checksum = 0x16 = 22 bytes
+        xsm3_do_challenge_verify(_auth_job_challenge);
+        memcpy(_auth_job_response, xsm3_challenge_response, XSM3_RESPONSE_VERIFY_LEN);
+    }
+    _auth_job_done = true;
+}
+
+// Hand a finished job's response to the control handler
+static void xsm3_publish_job(void)
+{
+    uint8_t request = _auth_job_request;
+    _auth_job_busy = false;
+    _auth_job_done = false;
+
+    // A newer challenge arrived while computing: drop this result, the
+    // caller restarts the job with the fresh data.
+    if (_auth_job_seq != _auth_request_seq) return;
+
+    _auth_response_len = (request == XSM3_REQ_INIT_AUTH)
+                       ? XSM3_RESPONSE_INIT_LEN : XSM3_RESPONSE_VERIFY_LEN;
+    memcpy(_auth_response, _auth_job_response, _auth_response_len);
+    _auth_state = (request == XSM3_REQ_INIT_AUTH)
+                ? XSM3_AUTH_RESPONDED : XSM3_AUTH_AUTHENTICATED;
+    _auth_request_id = 0;
+    TU_LOG1("[XINPUT] XSM3: %s processed, response ready (%u bytes)\r\n",
+            request == XSM3_REQ_INIT_AUTH ? "challenge init" : "verify",
+            _auth_response_len);
+}
+
 void tud_xinput_xsm3_process(void)
 {
-    if (_auth_state == XSM3_AUTH_INIT_RECEIVED &&
-        _auth_request_id == XSM3_REQ_INIT_AUTH)
-    {
-        // Process challenge init (34 bytes in _auth_buffer)
-        xsm3_do_challenge_init(_auth_buffer);
-        // Copy response (header + 0x28 payload + checksum = 0x2E = 46 bytes)
-        _auth_response_len = XSM3_RESPONSE_INIT_LEN;
-        memcpy(_auth_response, xsm3_challenge_response, _auth_response_len);
-        _auth_state = XSM3_AUTH_RESPONDED;
-        _auth_request_id = 0;
-        TU_LOG1("[XINPUT] XSM3: challenge init processed, response ready (%u bytes)\r\n",
-                _auth_response_len);
+    if (_auth_job_busy) {
+        if (!_auth_job_done) return;  // Still computing on the idle core
+        xsm3_publish_job();
     }
-    else if (_auth_state == XSM3_AUTH_VERIFY_RECEIVED &&
-             _auth_request_id == XSM3_REQ_VERIFY)
-    {
-        // Process verify challenge (22 bytes in _auth_buffer)
-        xsm3_do_challenge_verify(_auth_buffer);
-        // Copy response (header + 0x10 payload + checksum = 0x16 = 22 bytes)
-        _auth_response_len = XSM3_RESPONSE_VERIFY_LEN;
-        memcpy(_auth_response, xsm3_challenge_response, _auth_response_len);
-        _auth_state = XSM3_AUTH_AUTHENTICATED;
-        _auth_request_id = 0;
-        TU_LOG1("[XINPUT] XSM3: verify processed, auth complete (%u bytes)\r\n",
-                _auth_response_len);
+
+    bool init_pending = (_auth_state == XSM3_AUTH_INIT_RECEIVED &&
+                         _auth_request_id == XSM3_REQ_INIT_AUTH);
+    bool verify_pending = (_auth_state == XSM3_AUTH_VERIFY_RECEIVED &&
+                           _auth_request_id == XSM3_REQ_VERIFY);
+    if (!init_pending && !verify_pending) return;
+
+    // Start a job. STATE (0x86) keeps answering "processing" until published.
+    memcpy(_auth_job_challenge, _auth_buffer, sizeof(_auth_job_challenge));
+    _auth_job_request = _auth_request_id;
+    _auth_job_seq = _auth_request_seq;
+    _auth_job_done = false;
+    _auth_job_busy = true;
+    if (!platform_idle_core_submit(xsm3_challenge_job)) {
+        // No idle core on this build: compute inline
+        xsm3_challenge_job();
+        xsm3_publish_job();
     }
 }
 
@@ -0,0 +1,29 @@
+// gc_adapter_button_map.h - JP_BUTTON_* -> GC adapter port button bytes
+//
+// Built into a button_encoder_t at init; checked against the old branch
+// encoder by test/button_encoder_test.c.
+
+#ifndef GC_ADAPTER_BUTTON_MAP_H
+#define GC_ADAPTER_BUTTON_MAP_H
+
+#include "descriptors/gc_adapter_descriptors.h"
+#include "core/buttons.h"
+#include "core/button_encoder.h"
+
+// Port button bytes: buttons1 in bits 0-7, buttons2 in bits 8-15
+static const button_encoder_map_t gc_adapter_button_map[] = {
+    { JP_BUTTON_B2, GC_ADAPTER_BTN1_A },
+    { JP_BUTTON_B1, GC_ADAPTER_BTN1_B },
+    { JP_BUTTON_B4, GC_ADAPTER_BTN1_X },
+    { JP_BUTTON_B3, GC_ADAPTER_BTN1_Y },
+    { JP_BUTTON_DU, GC_ADAPTER_BTN1_DPAD_UP },
+    { JP_BUTTON_DD, GC_ADAPTER_BTN1_DPAD_DOWN },
+    { JP_BUTTON_DL, GC_ADAPTER_BTN1_DPAD_LEFT },
+    { JP_BUTTON_DR, GC_ADAPTER_BTN1_DPAD_RIGHT },
+    { JP_BUTTON_S2, GC_ADAPTER_BTN2_START << 8 },
+    { JP_BUTTON_R1, GC_ADAPTER_BTN2_Z << 8 },
+    { JP_BUTTON_L2, GC_ADAPTER_BTN2_L << 8 },
+    { JP_BUTTON_R2, GC_ADAPTER_BTN2_R << 8 },
+};
+
+#endif // GC_ADAPTER_BUTTON_MAP_H
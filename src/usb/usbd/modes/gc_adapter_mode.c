@@ -19,6 +19,8 @@
 #include "../usbd.h"
 #include "descriptors/gc_adapter_descriptors.h"
 #include "core/buttons.h"
+#include "core/button_encoder.h"
+#include "gc_adapter_button_map.h"
 #include "core/output_interface.h"
 #include <string.h>
 #include "../tusb_compat.h"  // usbd_edpt_xfer is_isr shim (0.20.0 vs master)
@@ -237,8 +239,13 @@ static const usbd_class_driver_t gc_class_driver = {
 // MODE INTERFACE IMPLEMENTATION
 // ============================================================================
 
+static button_encoder_t gc_adapter_button_encoder;
+
 static void gc_adapter_mode_init(void)
 {
+    button_encoder_build(&gc_adapter_button_encoder, gc_adapter_button_map,
+                         sizeof(gc_adapter_button_map) / sizeof(gc_adapter_button_map[0]));
+
     memset(&gc_adapter_report, 0, sizeof(gc_adapter_in_report_t));
     gc_adapter_report.report_id = GC_ADAPTER_REPORT_ID_INPUT;
 
@@ -276,18 +283,9 @@ static bool gc_adapter_mode_send_report(uint8_t player_index,
     gc_adapter_report.port[port].status = GC_ADAPTER_STATUS_CONNECTED;
 
     // Map buttons
-    gc_adapter_report.port[port].a = (buttons & JP_BUTTON_B2) ? 1 : 0;
-    gc_adapter_report.port[port].b = (buttons & JP_BUTTON_B1) ? 1 : 0;
-    gc_adapter_report.port[port].x = (buttons & JP_BUTTON_B4) ? 1 : 0;
-    gc_adapter_report.port[port].y = (buttons & JP_BUTTON_B3) ? 1 : 0;
-    gc_adapter_report.port[port].z = (buttons & JP_BUTTON_R1) ? 1 : 0;
-    gc_adapter_report.port[port].l = (buttons & JP_BUTTON_L2) ? 1 : 0;
-    gc_adapter_report.port[port].r = (buttons & JP_BUTTON_R2) ? 1 : 0;
-    gc_adapter_report.port[port].start = (buttons & JP_BUTTON_S2) ? 1 : 0;
-    gc_adapter_report.port[port].dpad_up = (buttons & JP_BUTTON_DU) ? 1 : 0;
-    gc_adapter_report.port[port].dpad_down = (buttons & JP_BUTTON_DD) ? 1 : 0;
-    gc_adapter_report.port[port].dpad_left = (buttons & JP_BUTTON_DL) ? 1 : 0;
-    gc_adapter_report.port[port].dpad_right = (buttons & JP_BUTTON_DR) ? 1 : 0;
+    uint32_t bits = button_encoder_encode(&gc_adapter_button_encoder, buttons);
+    gc_adapter_report.port[port].buttons1 = bits & 0xFF;
+    gc_adapter_report.port[port].buttons2 = (bits >> 8) & 0x0F;
 
     // Analog sticks (Y inverted for GC)
     gc_adapter_report.port[port].stick_x = profile_out->left_x;
@@ -0,0 +1,31 @@
+// ps4_button_map.h - JP_BUTTON_* -> PS4 report bytes 5-7
+//
+// Built into a button_encoder_t at init; checked against the old branch
+// encoder by test/button_encoder_test.c.
+
+#ifndef PS4_BUTTON_MAP_H
+#define PS4_BUTTON_MAP_H
+
+#include "core/buttons.h"
+#include "core/button_encoder.h"
+
+// Report bytes 5-7: face buttons in bits 4-7 of byte 5, byte 6, and the
+// PS/touchpad bits of byte 7 (bits 0-7, 8-15, 16-23 of the encoded value)
+static const button_encoder_map_t ps4_button_map[] = {
+    { JP_BUTTON_B3, 0x10 },         // Square
+    { JP_BUTTON_B1, 0x20 },         // Cross
+    { JP_BUTTON_B2, 0x40 },         // Circle
+    { JP_BUTTON_B4, 0x80 },         // Triangle
+    { JP_BUTTON_L1, 0x01 << 8 },    // L1
+    { JP_BUTTON_R1, 0x02 << 8 },    // R1
+    { JP_BUTTON_L2, 0x04 << 8 },    // L2 (digital)
+    { JP_BUTTON_R2, 0x08 << 8 },    // R2 (digital)
+    { JP_BUTTON_S1, 0x10 << 8 },    // Share
+    { JP_BUTTON_S2, 0x20 << 8 },    // Options
+    { JP_BUTTON_L3, 0x40 << 8 },    // L3
+    { JP_BUTTON_R3, 0x80 << 8 },    // R3
+    { JP_BUTTON_A1, 0x01 << 16 },   // PS button
+    { JP_BUTTON_A2, 0x02 << 16 },   // Touchpad click
+};
+
+#endif // PS4_BUTTON_MAP_H
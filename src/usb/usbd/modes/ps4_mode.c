@@ -7,6 +7,10 @@
 #include "../usbd.h"
 #include "descriptors/ps4_descriptors.h"
 #include "core/buttons.h"
+#include "core/button_encoder.h"
+#include "ps4_button_map.h"
+#include "core/services/motion/imu.h"
+#include "platform/platform.h"
 #include <string.h>
 
 #ifndef DISABLE_USB_HOST
@@ -23,12 +27,17 @@ static ps4_out_report_t ps4_output;
 static bool ps4_output_available = false;
 static uint8_t ps4_report_counter = 0;
 
+static button_encoder_t ps4_button_encoder;
+
 // ============================================================================
 // MODE INTERFACE IMPLEMENTATION
 // ============================================================================
 
 static void ps4_mode_init(void)
 {
+    button_encoder_build(&ps4_button_encoder, ps4_button_map,
+                         sizeof(ps4_button_map) / sizeof(ps4_button_map[0]));
+
     // Initialize PS4 report to neutral state (raw buffer approach)
     memset(ps4_report_buffer, 0, sizeof(ps4_report_buffer));
     ps4_report_buffer[0] = 0x01;  // Report ID
@@ -64,14 +73,16 @@ static bool ps4_mode_is_ready(void)
 //   Byte 7:    PS (bit 0) + Touchpad (bit 1) + Counter (bits 2-7)
 //   Byte 8:    Left trigger analog (0x00-0xFF)
 //   Byte 9:    Right trigger analog (0x00-0xFF)
-//   Bytes 10-63: Timestamp, sensor data, touchpad data, padding
+//   Bytes 10-11: Sensor timestamp (5.33 us units)
+//   Bytes 13-18: Gyro X/Y/Z (int16 LE, ±2000 dps)
+//   Bytes 19-24: Accel X/Y/Z (int16 LE, ±4 g)
+//   Bytes 25-63: Sensor status, touchpad data, padding
 static bool ps4_mode_send_report(uint8_t player_index,
                                   const input_event_t* event,
                                   const profile_output_t* profile_out,
                                   uint32_t buttons)
 {
     (void)player_index;
-    (void)event;
 
     // Byte 0: Report ID
     ps4_report_buffer[0] = 0x01;
@@ -99,30 +110,15 @@ static bool ps4_mode_send_report(uint8_t player_index,
     else if (right)         dpad = PS4_HAT_RIGHT;
     else                    dpad = PS4_HAT_NOTHING;
 
-    uint8_t face_buttons = 0;
-    if (buttons & JP_BUTTON_B3) face_buttons |= 0x10;  // Square
-    if (buttons & JP_BUTTON_B1) face_buttons |= 0x20;  // Cross
-    if (buttons & JP_BUTTON_B2) face_buttons |= 0x40;  // Circle
-    if (buttons & JP_BUTTON_B4) face_buttons |= 0x80;  // Triangle
+    uint32_t bits = button_encoder_encode(&ps4_button_encoder, buttons);
 
-    ps4_report_buffer[5] = dpad | face_buttons;
+    ps4_report_buffer[5] = dpad | (bits & 0xF0);
 
     // Byte 6: Shoulder buttons + other buttons
-    uint8_t byte6 = 0;
-    if (buttons & JP_BUTTON_L1) byte6 |= 0x01;  // L1
-    if (buttons & JP_BUTTON_R1) byte6 |= 0x02;  // R1
-    if (buttons & JP_BUTTON_L2) byte6 |= 0x04;  // L2 (digital)
-    if (buttons & JP_BUTTON_R2) byte6 |= 0x08;  // R2 (digital)
-    if (buttons & JP_BUTTON_S1) byte6 |= 0x10;  // Share
-    if (buttons & JP_BUTTON_S2) byte6 |= 0x20;  // Options
-    if (buttons & JP_BUTTON_L3) byte6 |= 0x40;  // L3
-    if (buttons & JP_BUTTON_R3) byte6 |= 0x80;  // R3
-    ps4_report_buffer[6] = byte6;
+    ps4_report_buffer[6] = (bits >> 8) & 0xFF;
 
     // Byte 7: PS + Touchpad + Counter (6-bit)
-    uint8_t byte7 = 0;
-    if (buttons & JP_BUTTON_A1) byte7 |= 0x01;  // PS button
-    if (buttons & JP_BUTTON_A2) byte7 |= 0x02;  // Touchpad click
+    uint8_t byte7 = (bits >> 16) & 0x03;
     byte7 |= ((ps4_report_counter++ & 0x3F) << 2);       // Counter in bits 2-7
     ps4_report_buffer[7] = byte7;
 
@@ -130,8 +126,33 @@ static bool ps4_mode_send_report(uint8_t player_index,
     ps4_report_buffer[8] = profile_out->l2_analog;  // Left trigger
     ps4_report_buffer[9] = profile_out->r2_analog;  // Right trigger
 
-    // Bytes 10-11: Timestamp (we can just increment)
-    // Bytes 12-63: Leave as initialized (sensor data, touchpad, padding)
+    // Bytes 10-24: Motion. Ring-fed controllers deliver one queued sample per
+    // report with its capture time and keep the last one when the ring runs
+    // dry; single-sample controllers pass the event's motion through.
+    imu_sample_t imu;
+    bool have_imu = imu_pop(event->dev_addr, event->instance, &imu);
+    if (!have_imu && !imu_streaming(event->dev_addr, event->instance)) {
+        memset(&imu, 0, sizeof(imu));
+        imu.timestamp_us = platform_time_us();
+        if (event->has_motion) {
+            memcpy(imu.accel, event->accel, sizeof(imu.accel));
+            memcpy(imu.gyro, event->gyro, sizeof(imu.gyro));
+        }
+        have_imu = true;
+    }
+    if (have_imu) {
+        uint16_t ts = (uint16_t)(((uint64_t)imu.timestamp_us * 3) / 16);  // 16/3 us per tick
+        ps4_report_buffer[10] = ts & 0xFF;
+        ps4_report_buffer[11] = ts >> 8;
+        for (int i = 0; i < 3; i++) {
+            ps4_report_buffer[13 + i * 2] = (uint16_t)imu.gyro[i] & 0xFF;
+            ps4_report_buffer[14 + i * 2] = (uint16_t)imu.gyro[i] >> 8;
+            ps4_report_buffer[19 + i * 2] = (uint16_t)imu.accel[i] & 0xFF;
+            ps4_report_buffer[20 + i * 2] = (uint16_t)imu.accel[i] >> 8;
+        }
+    }
+
+    // Bytes 25-63: Leave as initialized (touchpad, padding)
 
     // Send with report_id=0x01, letting TinyUSB prepend it
     // Skip byte 0 of buffer (our report_id) and send 63 bytes of data
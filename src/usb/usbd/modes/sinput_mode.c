@@ -11,6 +11,7 @@
 #include "descriptors/sinput_descriptors.h"
 #include "core/buttons.h"
 #include "core/services/players/manager.h"
+#include "core/services/motion/imu.h"
 #include "platform/platform.h"
 #include <string.h>
 
@@ -353,11 +354,23 @@ static bool sinput_mode_send_report(uint8_t player_index,
     sinput_report.lt = convert_trigger_to_s16(profile_out->l2_analog);
     sinput_report.rt = convert_trigger_to_s16(profile_out->r2_analog);
 
-    // IMU timestamp (microseconds since boot)
-    sinput_report.imu_timestamp = platform_time_us();
-
-    // IMU data - passthrough from input controller if available
-    if (event->has_motion) {
+    // IMU data. Ring-fed controllers deliver one queued sample per report with
+    // its capture timestamp; when their ring runs dry the last sample is kept
+    // so the host never sees a duplicate with a new timestamp. Single-sample
+    // controllers pass the event's motion through.
+    imu_sample_t imu;
+    if (imu_pop(event->dev_addr, event->instance, &imu)) {
+        sinput_report.imu_timestamp = imu.timestamp_us;
+        sinput_report.accel_x = imu.accel[0];
+        sinput_report.accel_y = imu.accel[1];
+        sinput_report.accel_z = imu.accel[2];
+        sinput_report.gyro_x = imu.gyro[0];
+        sinput_report.gyro_y = imu.gyro[1];
+        sinput_report.gyro_z = imu.gyro[2];
+    } else if (imu_streaming(event->dev_addr, event->instance)) {
+        // Keep previous sample and timestamp
+    } else if (event->has_motion) {
+        sinput_report.imu_timestamp = platform_time_us();
         sinput_report.accel_x = event->accel[0];
         sinput_report.accel_y = event->accel[1];
         sinput_report.accel_z = event->accel[2];
@@ -365,6 +378,7 @@ static bool sinput_mode_send_report(uint8_t player_index,
         sinput_report.gyro_y = event->gyro[1];
         sinput_report.gyro_z = event->gyro[2];
     } else {
+        sinput_report.imu_timestamp = platform_time_us();
         sinput_report.accel_x = 0;
         sinput_report.accel_y = 0;
         sinput_report.accel_z = 0;
@@ -605,10 +619,12 @@ static void sinput_mode_task(void)
     // Face style (from connected device) | sub product (0)
     f[5] = (cached_face_style << 5);
 
-    // Polling rate: 1000 microseconds (1000Hz) — matches the 1ms HID endpoint
-    // bInterval. SDL also derives its gyro/accel sensor rate from this value.
-    f[6] = 0xE8;  // 1000 & 0xFF
-    f[7] = 0x03;  // 1000 >> 8
+    // Polling rate in microseconds — matches the HID endpoint interval: 1000
+    // (1ms frame) at full speed, 125 (one microframe) at high speed. SDL also
+    // derives its gyro/accel sensor rate from this value.
+    uint16_t poll_us = usbd_is_high_speed() ? 125 : 1000;
+    f[6] = poll_us & 0xFF;
+    f[7] = poll_us >> 8;
 
     // Accel/Gyro ranges (uint16 LE): 0 = not supported
     if (cached_has_motion) {
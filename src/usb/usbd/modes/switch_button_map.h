@@ -0,0 +1,31 @@
+// switch_button_map.h - JP_BUTTON_* -> Switch SWITCH_MASK_* buttons
+//
+// Built into a button_encoder_t at init; checked against the old branch
+// encoder by test/button_encoder_test.c.
+
+#ifndef SWITCH_BUTTON_MAP_H
+#define SWITCH_BUTTON_MAP_H
+
+#include "descriptors/switch_descriptors.h"
+#include "core/buttons.h"
+#include "core/button_encoder.h"
+
+// Position-based mapping (matches GP2040-CE)
+static const button_encoder_map_t switch_button_map[] = {
+    { JP_BUTTON_B1, SWITCH_MASK_B },        // B1 (bottom) -> B
+    { JP_BUTTON_B2, SWITCH_MASK_A },        // B2 (right)  -> A
+    { JP_BUTTON_B3, SWITCH_MASK_Y },        // B3 (left)   -> Y
+    { JP_BUTTON_B4, SWITCH_MASK_X },        // B4 (top)    -> X
+    { JP_BUTTON_L1, SWITCH_MASK_L },
+    { JP_BUTTON_R1, SWITCH_MASK_R },
+    { JP_BUTTON_L2, SWITCH_MASK_ZL },
+    { JP_BUTTON_R2, SWITCH_MASK_ZR },
+    { JP_BUTTON_S1, SWITCH_MASK_MINUS },
+    { JP_BUTTON_S2, SWITCH_MASK_PLUS },
+    { JP_BUTTON_L3, SWITCH_MASK_L3 },
+    { JP_BUTTON_R3, SWITCH_MASK_R3 },
+    { JP_BUTTON_A1, SWITCH_MASK_HOME },
+    { JP_BUTTON_A2, SWITCH_MASK_CAPTURE },
+};
+
+#endif // SWITCH_BUTTON_MAP_H
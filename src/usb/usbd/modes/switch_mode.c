@@ -7,6 +7,8 @@
 #include "../usbd.h"
 #include "descriptors/switch_descriptors.h"
 #include "core/buttons.h"
+#include "core/button_encoder.h"
+#include "switch_button_map.h"
 #include <string.h>
 
 // ============================================================================
@@ -39,12 +41,17 @@ static uint8_t convert_dpad_to_hat(uint32_t buttons)
     return SWITCH_HAT_CENTER;
 }
 
+static button_encoder_t switch_button_encoder;
+
 // ============================================================================
 // MODE INTERFACE IMPLEMENTATION
 // ============================================================================
 
 static void switch_mode_init(void)
 {
+    button_encoder_build(&switch_button_encoder, switch_button_map,
+                         sizeof(switch_button_map) / sizeof(switch_button_map[0]));
+
     memset(&switch_report, 0, sizeof(switch_in_report_t));
     switch_report.hat = SWITCH_HAT_CENTER;
     switch_report.lx = SWITCH_JOYSTICK_MID;
@@ -67,21 +74,7 @@ static bool switch_mode_send_report(uint8_t player_index,
     (void)event;
 
     // Buttons (16-bit) - position-based mapping (matches GP2040-CE)
-    switch_report.buttons = 0;
-    if (buttons & JP_BUTTON_B1) switch_report.buttons |= SWITCH_MASK_B;     // B1 (bottom) -> B
-    if (buttons & JP_BUTTON_B2) switch_report.buttons |= SWITCH_MASK_A;     // B2 (right)  -> A
-    if (buttons & JP_BUTTON_B3) switch_report.buttons |= SWITCH_MASK_Y;     // B3 (left)   -> Y
-    if (buttons & JP_BUTTON_B4) switch_report.buttons |= SWITCH_MASK_X;     // B4 (top)    -> X
-    if (buttons & JP_BUTTON_L1) switch_report.buttons |= SWITCH_MASK_L;     // L
-    if (buttons & JP_BUTTON_R1) switch_report.buttons |= SWITCH_MASK_R;     // R
-    if (buttons & JP_BUTTON_L2) switch_report.buttons |= SWITCH_MASK_ZL;    // ZL
-    if (buttons & JP_BUTTON_R2) switch_report.buttons |= SWITCH_MASK_ZR;    // ZR
-    if (buttons & JP_BUTTON_S1) switch_report.buttons |= SWITCH_MASK_MINUS; // Minus
-    if (buttons & JP_BUTTON_S2) switch_report.buttons |= SWITCH_MASK_PLUS;  // Plus
-    if (buttons & JP_BUTTON_L3) switch_report.buttons |= SWITCH_MASK_L3;
-    if (buttons & JP_BUTTON_R3) switch_report.buttons |= SWITCH_MASK_R3;
-    if (buttons & JP_BUTTON_A1) switch_report.buttons |= SWITCH_MASK_HOME;
-    if (buttons & JP_BUTTON_A2) switch_report.buttons |= SWITCH_MASK_CAPTURE;
+    switch_report.buttons = (uint16_t)button_encoder_encode(&switch_button_encoder, buttons);
 
     // D-pad as hat switch
     switch_report.hat = convert_dpad_to_hat(buttons);
@@ -0,0 +1,34 @@
+// xinput_button_map.h - JP_BUTTON_* -> XInput button bytes
+//
+// Built into a button_encoder_t at init; checked against the old branch
+// encoder by test/button_encoder_test.c.
+
+#ifndef XINPUT_BUTTON_MAP_H
+#define XINPUT_BUTTON_MAP_H
+
+#include "descriptors/xinput_descriptors.h"
+#include "core/buttons.h"
+#include "core/button_encoder.h"
+
+// Button bytes: buttons0 in bits 0-7, buttons1 in bits 8-15
+static const button_encoder_map_t xinput_button_map[] = {
+    // Byte 0 (DPAD, Start, Back, L3, R3)
+    { JP_BUTTON_DU, XINPUT_BTN_DPAD_UP },
+    { JP_BUTTON_DD, XINPUT_BTN_DPAD_DOWN },
+    { JP_BUTTON_DL, XINPUT_BTN_DPAD_LEFT },
+    { JP_BUTTON_DR, XINPUT_BTN_DPAD_RIGHT },
+    { JP_BUTTON_S2, XINPUT_BTN_START },
+    { JP_BUTTON_S1, XINPUT_BTN_BACK },
+    { JP_BUTTON_L3, XINPUT_BTN_L3 },
+    { JP_BUTTON_R3, XINPUT_BTN_R3 },
+    // Byte 1 (LB, RB, Guide, A, B, X, Y)
+    { JP_BUTTON_L1, XINPUT_BTN_LB << 8 },
+    { JP_BUTTON_R1, XINPUT_BTN_RB << 8 },
+    { JP_BUTTON_A1, XINPUT_BTN_GUIDE << 8 },
+    { JP_BUTTON_B1, XINPUT_BTN_A << 8 },
+    { JP_BUTTON_B2, XINPUT_BTN_B << 8 },
+    { JP_BUTTON_B3, XINPUT_BTN_X << 8 },
+    { JP_BUTTON_B4, XINPUT_BTN_Y << 8 },
+};
+
+#endif // XINPUT_BUTTON_MAP_H
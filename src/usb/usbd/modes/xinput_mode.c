@@ -8,6 +8,8 @@
 #include "../drivers/tud_xinput.h"
 #include "descriptors/xinput_descriptors.h"
 #include "core/buttons.h"
+#include "core/button_encoder.h"
+#include "xinput_button_map.h"
 #include <string.h>
 
 #if CFG_TUD_XINPUT
@@ -42,12 +44,17 @@ static int16_t convert_axis_to_s16_inverted(uint8_t value)
     return (int16_t)scaled;
 }
 
+static button_encoder_t xinput_button_encoder;
+
 // ============================================================================
 // MODE INTERFACE IMPLEMENTATION
 // ============================================================================
 
 static void xinput_mode_init(void)
 {
+    button_encoder_build(&xinput_button_encoder, xinput_button_map,
+                         sizeof(xinput_button_map) / sizeof(xinput_button_map[0]));
+
     memset(&xinput_report, 0, sizeof(xinput_in_report_t));
     xinput_report.report_id = 0x00;
     xinput_report.report_size = sizeof(xinput_in_report_t);
@@ -71,26 +78,10 @@ static bool xinput_mode_send_report(uint8_t player_index,
     (void)player_index;
     (void)event;
 
-    // Digital buttons byte 0 (DPAD, Start, Back, L3, R3)
-    xinput_report.buttons0 = 0;
-    if (buttons & JP_BUTTON_DU) xinput_report.buttons0 |= XINPUT_BTN_DPAD_UP;
-    if (buttons & JP_BUTTON_DD) xinput_report.buttons0 |= XINPUT_BTN_DPAD_DOWN;
-    if (buttons & JP_BUTTON_DL) xinput_report.buttons0 |= XINPUT_BTN_DPAD_LEFT;
-    if (buttons & JP_BUTTON_DR) xinput_report.buttons0 |= XINPUT_BTN_DPAD_RIGHT;
-    if (buttons & JP_BUTTON_S2) xinput_report.buttons0 |= XINPUT_BTN_START;
-    if (buttons & JP_BUTTON_S1) xinput_report.buttons0 |= XINPUT_BTN_BACK;
-    if (buttons & JP_BUTTON_L3) xinput_report.buttons0 |= XINPUT_BTN_L3;
-    if (buttons & JP_BUTTON_R3) xinput_report.buttons0 |= XINPUT_BTN_R3;
-
-    // Digital buttons byte 1 (LB, RB, Guide, A, B, X, Y)
-    xinput_report.buttons1 = 0;
-    if (buttons & JP_BUTTON_L1) xinput_report.buttons1 |= XINPUT_BTN_LB;
-    if (buttons & JP_BUTTON_R1) xinput_report.buttons1 |= XINPUT_BTN_RB;
-    if (buttons & JP_BUTTON_A1) xinput_report.buttons1 |= XINPUT_BTN_GUIDE;
-    if (buttons & JP_BUTTON_B1) xinput_report.buttons1 |= XINPUT_BTN_A;
-    if (buttons & JP_BUTTON_B2) xinput_report.buttons1 |= XINPUT_BTN_B;
-    if (buttons & JP_BUTTON_B3) xinput_report.buttons1 |= XINPUT_BTN_X;
-    if (buttons & JP_BUTTON_B4) xinput_report.buttons1 |= XINPUT_BTN_Y;
+    // Digital buttons (byte 0: DPAD, Start, Back, L3, R3; byte 1: LB, RB, Guide, A, B, X, Y)
+    uint32_t bits = button_encoder_encode(&xinput_button_encoder, buttons);
+    xinput_report.buttons0 = bits & 0xFF;
+    xinput_report.buttons1 = (bits >> 8) & 0xFF;
 
     // Analog triggers (0-255)
     xinput_report.trigger_l = profile_out->l2_analog;
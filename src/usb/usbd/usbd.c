@@ -11,12 +11,12 @@
 // - Future: XInput, PS4, Switch, etc.
 //
 // Mode is stored in flash and can be changed via CDC commands.
-// Mode changes require USB re-enumeration (device reset).
+// Mode changes re-enumerate the device stack in place (CH32/ESP32 reset).
 
 #include "usbd.h"
 #include "usbd_mode.h"
 #if defined(CONFIG_JOYBUS_BRIDGE)
-#include "hardware/clocks.h"  // set_sys_clock_khz — see joybus clock note in usbd_init
+#include "native/joybus_clock.h"  // see joybus clock note in usbd_init
 #endif
 #include "descriptors/hid_descriptors.h"
 #include "descriptors/sinput_descriptors.h"
@@ -46,6 +46,7 @@
 #include "core/services/storage/flash.h"
 #include "core/services/button/button.h"
 #include "core/services/profiles/profile.h"
+#include "core/services/motion/imu.h"
 #ifndef DISABLE_USB_HOST
 #include "usb/usbh/hid/devices/vendors/sony/sony_ds4.h"
 #endif
@@ -87,6 +88,15 @@ static joypad_hid_report_t hid_report;
 static input_event_t pending_events[USB_MAX_PLAYERS];
 static bool pending_flags[USB_MAX_PLAYERS] = {false};
 
+// Motion-capable modes (SInput, PS4) also send a report per queued IMU sample,
+// re-using the last event, so multi-frame controllers aren't decimated to
+// their input report rate
+static bool usbd_imu_pending(uint8_t player_index)
+{
+    const input_event_t* event = &pending_events[player_index];
+    return event->type != INPUT_TYPE_NONE && imu_pending(event->dev_addr, event->instance);
+}
+
 // Serial number from board unique ID (12 hex chars + null)
 #define USB_SERIAL_LEN 12
 static char usb_serial_str[USB_SERIAL_LEN + 1];
@@ -109,6 +119,38 @@ static usb_output_mode_t output_mode = USBD_DEFAULT_MODE;
 // Forward declaration (defined in CONFIGURATION DESCRIPTOR section)
 static void build_config_descriptors(void);
 
+// Forward declarations (defined in PUBLIC API section)
+static void usbd_start_stack(void);
+static void usbd_init_mode(void);
+
+// ============================================================================
+// LIVE MODE SWITCH STATE
+// ============================================================================
+
+// Mode changes tear down only the device stack and re-enumerate with the new
+// descriptors; host stacks (PIO-USB, BTstack), router and players stay up.
+// CH32 USBHS can't re-attach without a full reset and ESP32 runs TinyUSB
+// under its own task, so those still reboot into the new mode.
+#if !defined(PLATFORM_ESP32) && !defined(PLATFORM_CH32)
+#define USBD_LIVE_MODE_SWITCH 1
+#endif
+
+#if USBD_LIVE_MODE_SWITCH
+#define MODE_SWITCH_DRAIN_MS   10   // Let queued CDC/debug output reach the host
+#define MODE_SWITCH_DETACH_MS  20   // Time off the bus so the host drops the old device
+
+typedef enum {
+    MODE_SWITCH_IDLE = 0,
+    MODE_SWITCH_DRAIN,          // Requested, old mode still running
+    MODE_SWITCH_DETACHED,       // Stack down, waiting out the disconnect
+} mode_switch_state_t;
+
+static mode_switch_state_t mode_switch_state = MODE_SWITCH_IDLE;
+static usb_output_mode_t mode_switch_target;
+static uint32_t mode_switch_ms;         // Entered current state
+static uint32_t mode_switch_start_ms;   // Request time, for the log
+#endif
+
 // Mode names for display
 static const char* mode_names[] = {
     [USB_OUTPUT_MODE_HID] = "DInput",
@@ -326,7 +368,8 @@ usb_output_mode_t usbd_get_mode(void)
     return output_mode;
 }
 
-// Helper to flush debug output over CDC
+#if !USBD_LIVE_MODE_SWITCH
+// Helper to flush debug output over CDC before a reset
 static void flush_debug_output(void)
 {
 #ifdef PLATFORM_ESP32
@@ -339,6 +382,7 @@ static void flush_debug_output(void)
     tud_task();
 #endif
 }
+#endif
 
 bool usbd_set_mode(usb_output_mode_t mode)
 {
@@ -376,13 +420,29 @@ bool usbd_set_mode(usb_output_mode_t mode)
         return false;
     }
 
+#if USBD_LIVE_MODE_SWITCH
+    if (mode_switch_state != MODE_SWITCH_IDLE) {
+        // Already re-enumerating: the latest request wins
+        if (mode == mode_switch_target) {
+            return false;
+        }
+        printf("[usbd] Mode switch retargeted to %s\n", mode_names[mode]);
+        mode_switch_target = mode;
+        flash_t* settings = flash_get_settings();
+        if (settings) {
+            settings->usb_output_mode = (uint8_t)mode;
+            flash_save_now(settings);
+        }
+        return true;
+    }
+#endif
+
     if (mode == output_mode) {
         return false;  // Same mode, no change needed
     }
 
     printf("[usbd] Changing mode from %s to %s\n",
            mode_names[output_mode], mode_names[mode]);
-    flush_debug_output();
 
     // Fast switch: SInput <-> KB/Mouse share the same USB descriptor (composite device)
     // No re-enumeration needed — just switch the mode logic
@@ -392,13 +452,13 @@ bool usbd_set_mode(usb_output_mode_t mode)
                                   mode == USB_OUTPUT_MODE_KEYBOARD_MOUSE);
     if (is_sinput_family_old && is_sinput_family_new) {
         printf("[usbd] Fast switch (same USB descriptor)\n");
-        flush_debug_output();
 
+        // Nothing resets, so the write can wait for an idle moment
         output_mode = mode;
         flash_t* settings = flash_get_settings();
         if (settings) {
             settings->usb_output_mode = (uint8_t)mode;
-            flash_save_force(settings);
+            flash_save_now(settings);
         }
 
         // Re-init the new mode
@@ -412,6 +472,24 @@ bool usbd_set_mode(usb_output_mode_t mode)
         return true;
     }
 
+#if USBD_LIVE_MODE_SWITCH
+    // Re-enumerate from usbd_task: callers may be inside cdc_task or a
+    // TinyUSB callback, where the stack can't be torn down. The setting is
+    // queued and lands at the flash scheduler's next idle window.
+    flash_t* settings = flash_get_settings();
+    if (settings) {
+        settings->usb_output_mode = (uint8_t)mode;
+        flash_save_now(settings);
+    }
+
+    mode_switch_target = mode;
+    mode_switch_state = MODE_SWITCH_DRAIN;
+    mode_switch_start_ms = platform_time_ms();
+    mode_switch_ms = mode_switch_start_ms;
+    return true;
+#else
+    flush_debug_output();
+
     // Save mode to flash immediately (we're about to reset)
     // Use runtime settings (not local copy) to preserve custom profiles
     flash_t* settings = flash_get_settings();
@@ -434,6 +512,7 @@ bool usbd_set_mode(usb_output_mode_t mode)
     platform_reboot();
 
     return true;  // Never reached
+#endif
 }
 
 const char* usbd_get_mode_name(usb_output_mode_t mode)
@@ -543,83 +622,10 @@ static void usbd_on_input(output_target_t output, uint8_t player_index, const in
 // PUBLIC API
 // ============================================================================
 
-void usbd_init(void)
+// Bring up the TinyUSB device stack for output_mode. Class drivers and
+// descriptors are picked from output_mode by the TinyUSB callbacks.
+static void usbd_start_stack(void)
 {
-#ifdef DISABLE_USB_DEVICE
-    printf("[usbd] USB device DISABLED\n");
-    return;
-#endif
-#if defined(CONFIG_JOYBUS_BRIDGE)
-    // Joybus-bridge apps need 130 MHz before tusb_init AND before
-    // gc_host_init so USB SOF timing and the joybus PIO divider both
-    // see the final clock. Without this, the divider ends up ~4% off
-    // and GBA replies never decode (rx=000000 timeouts).
-    bool clk_ok = set_sys_clock_khz(130000, true);
-    printf("[usbd] sys_clock=130MHz set: %s\n", clk_ok ? "OK" : "FAIL");
-#endif
-    printf("[usbd] Initializing USB device output\n");
-
-    // Register all mode implementations
-    usbd_register_modes();
-
-    // Initialize and load settings from flash
-    flash_init();
-    // Load saved mode from flash (runtime_settings holds the canonical state)
-    flash_t* settings = flash_get_settings();
-    if (settings) {
-        printf("[usbd] Flash load success! usb_output_mode=%d, active_profile=%d\n",
-               settings->usb_output_mode, settings->active_profile_index);
-        // Validate loaded mode
-        if (settings->usb_output_mode < USB_OUTPUT_MODE_COUNT) {
-            // Only accept supported modes
-            if (settings->usb_output_mode == USB_OUTPUT_MODE_SINPUT ||
-                settings->usb_output_mode == USB_OUTPUT_MODE_XBOX_ORIGINAL ||
-                settings->usb_output_mode == USB_OUTPUT_MODE_XINPUT ||
-                settings->usb_output_mode == USB_OUTPUT_MODE_PS3 ||
-                settings->usb_output_mode == USB_OUTPUT_MODE_PS4 ||
-                settings->usb_output_mode == USB_OUTPUT_MODE_SWITCH ||
-                settings->usb_output_mode == USB_OUTPUT_MODE_PSCLASSIC ||
-                settings->usb_output_mode == USB_OUTPUT_MODE_XBONE ||
-                settings->usb_output_mode == USB_OUTPUT_MODE_XAC ||
-                settings->usb_output_mode == USB_OUTPUT_MODE_KEYBOARD_MOUSE ||
-                settings->usb_output_mode == USB_OUTPUT_MODE_GC_ADAPTER ||
-                settings->usb_output_mode == USB_OUTPUT_MODE_PCEMINI ||
-#if CFG_TUD_VENDOR && defined(CONFIG_JOYBUS_BRIDGE)
-                settings->usb_output_mode == USB_OUTPUT_MODE_GBA_LINK ||
-#endif
-                settings->usb_output_mode == USB_OUTPUT_MODE_CDC) {
-                output_mode = (usb_output_mode_t)settings->usb_output_mode;
-                printf("[usbd] Loaded mode from flash: %s\n", mode_names[output_mode]);
-            } else if (settings->usb_output_mode == USB_OUTPUT_MODE_HID) {
-                // DInput (mode 0) is deprecated / uninitialized flash default.
-                // Keep compile-time default (SInput for usb2usb, CDC for usb2ble).
-                printf("[usbd] Flash has DInput (0), keeping default: %s\n", mode_names[output_mode]);
-            } else {
-                printf("[usbd] Unsupported mode %d in flash, using default\n",
-                       settings->usb_output_mode);
-            }
-        }
-    } else {
-        printf("[usbd] No valid flash settings, using defaults\n");
-    }
-
-#ifdef CONFIG_NGC
-    // GameCube config mode: always force CDC-only (ignore flash-saved mode)
-    output_mode = USB_OUTPUT_MODE_CDC;
-#endif
-    printf("[usbd] Mode: %s\n", mode_names[output_mode]);
-
-    // Build runtime config descriptors (must happen before tusb_init)
-    build_config_descriptors();
-
-    // Get unique board ID for USB serial number (first 12 chars)
-    char full_id[17];  // Up to 8 bytes * 2 hex chars + null
-    platform_get_serial(full_id, sizeof(full_id));
-    memcpy(usb_serial_str, full_id, USB_SERIAL_LEN);
-    usb_serial_str[USB_SERIAL_LEN] = '\0';
-    printf("[usbd] Serial: %s\n", usb_serial_str);
-
-    // Initialize TinyUSB device stack
     tusb_rhport_init_t dev_init = {
         .role = TUSB_ROLE_DEVICE,
         .speed = (output_mode == USB_OUTPUT_MODE_XBOX_ORIGINAL)
@@ -627,7 +633,11 @@ void usbd_init(void)
                  : TUSB_SPEED_AUTO
     };
     tusb_init(0, &dev_init);
+}
 
+// Reset the active mode's state and hook up CDC for modes that carry it
+static void usbd_init_mode(void)
+{
     // Initialize reports based on mode
     switch (output_mode) {
         case USB_OUTPUT_MODE_XBOX_ORIGINAL:
@@ -748,6 +758,88 @@ void usbd_init(void)
         output_mode == USB_OUTPUT_MODE_CDC) {
         cdc_init();
     }
+}
+
+void usbd_init(void)
+{
+#ifdef DISABLE_USB_DEVICE
+    printf("[usbd] USB device DISABLED\n");
+    return;
+#endif
+#if defined(CONFIG_JOYBUS_BRIDGE)
+    // Joybus-bridge apps need the joybus clock before tusb_init AND
+    // before gc_host_init so USB SOF timing and the joybus PIO divider
+    // both see the final clock. Without this, the divider ends up ~4%
+    // off and GBA replies never decode (rx=000000 timeouts).
+    uint32_t clk_khz = joybus_clock_init();
+    printf("[usbd] sys_clock=%luMHz (joybus %s)\n", (unsigned long)(clk_khz / 1000),
+           joybus_clock_is_clean(clock_get_hz(clk_sys)) ? "clean" : "FRACTIONAL");
+#endif
+    printf("[usbd] Initializing USB device output\n");
+
+    // Register all mode implementations
+    usbd_register_modes();
+
+    // Initialize and load settings from flash
+    flash_init();
+    // Load saved mode from flash (runtime_settings holds the canonical state)
+    flash_t* settings = flash_get_settings();
+    if (settings) {
+        printf("[usbd] Flash load success! usb_output_mode=%d, active_profile=%d\n",
+               settings->usb_output_mode, settings->active_profile_index);
+        // Validate loaded mode
+        if (settings->usb_output_mode < USB_OUTPUT_MODE_COUNT) {
+            // Only accept supported modes
+            if (settings->usb_output_mode == USB_OUTPUT_MODE_SINPUT ||
+                settings->usb_output_mode == USB_OUTPUT_MODE_XBOX_ORIGINAL ||
+                settings->usb_output_mode == USB_OUTPUT_MODE_XINPUT ||
+                settings->usb_output_mode == USB_OUTPUT_MODE_PS3 ||
+                settings->usb_output_mode == USB_OUTPUT_MODE_PS4 ||
+                settings->usb_output_mode == USB_OUTPUT_MODE_SWITCH ||
+                settings->usb_output_mode == USB_OUTPUT_MODE_PSCLASSIC ||
+                settings->usb_output_mode == USB_OUTPUT_MODE_XBONE ||
+                settings->usb_output_mode == USB_OUTPUT_MODE_XAC ||
+                settings->usb_output_mode == USB_OUTPUT_MODE_KEYBOARD_MOUSE ||
+                settings->usb_output_mode == USB_OUTPUT_MODE_GC_ADAPTER ||
+                settings->usb_output_mode == USB_OUTPUT_MODE_PCEMINI ||
+#if CFG_TUD_VENDOR && defined(CONFIG_JOYBUS_BRIDGE)
+                settings->usb_output_mode == USB_OUTPUT_MODE_GBA_LINK ||
+#endif
+                settings->usb_output_mode == USB_OUTPUT_MODE_CDC) {
+                output_mode = (usb_output_mode_t)settings->usb_output_mode;
+                printf("[usbd] Loaded mode from flash: %s\n", mode_names[output_mode]);
+            } else if (settings->usb_output_mode == USB_OUTPUT_MODE_HID) {
+                // DInput (mode 0) is deprecated / uninitialized flash default.
+                // Keep compile-time default (SInput for usb2usb, CDC for usb2ble).
+                printf("[usbd] Flash has DInput (0), keeping default: %s\n", mode_names[output_mode]);
+            } else {
+                printf("[usbd] Unsupported mode %d in flash, using default\n",
+                       settings->usb_output_mode);
+            }
+        }
+    } else {
+        printf("[usbd] No valid flash settings, using defaults\n");
+    }
+
+#ifdef CONFIG_NGC
+    // GameCube config mode: always force CDC-only (ignore flash-saved mode)
+    output_mode = USB_OUTPUT_MODE_CDC;
+#endif
+    printf("[usbd] Mode: %s\n", mode_names[output_mode]);
+
+    // Build runtime config descriptors (must happen before tusb_init)
+    build_config_descriptors();
+
+    // Get unique board ID for USB serial number (first 12 chars)
+    char full_id[17];  // Up to 8 bytes * 2 hex chars + null
+    platform_get_serial(full_id, sizeof(full_id));
+    memcpy(usb_serial_str, full_id, USB_SERIAL_LEN);
+    usb_serial_str[USB_SERIAL_LEN] = '\0';
+    printf("[usbd] Serial: %s\n", usb_serial_str);
+
+    // Initialize TinyUSB device stack, then the mode's report state
+    usbd_start_stack();
+    usbd_init_mode();
 
     // Register tap callback for event-driven input (push-based notification)
     router_set_tap(OUTPUT_TARGET_USB_DEVICE, usbd_on_input);
@@ -755,8 +847,50 @@ void usbd_init(void)
     printf("[usbd] Initialization complete\n");
 }
 
+#if USBD_LIVE_MODE_SWITCH
+// Advance a pending mode switch. Returns false while the stack is down.
+static bool mode_switch_task(void)
+{
+    uint32_t now = platform_time_ms();
+
+    if (mode_switch_state == MODE_SWITCH_DRAIN) {
+        if (now - mode_switch_ms < MODE_SWITCH_DRAIN_MS) {
+            return true;
+        }
+        printf("[usbd] Re-enumerating as %s\n", mode_names[mode_switch_target]);
+        tud_disconnect();
+        tud_deinit(0);
+        mode_switch_state = MODE_SWITCH_DETACHED;
+        mode_switch_ms = now;
+        return false;
+    }
+
+    if (now - mode_switch_ms < MODE_SWITCH_DETACH_MS) {
+        return false;
+    }
+
+    // Queued input events are kept: they are the latest state per player
+    // and go out in the new format once the host configures us
+    output_mode = mode_switch_target;
+    usbd_start_stack();
+    tud_connect();
+    usbd_init_mode();
+    mode_switch_state = MODE_SWITCH_IDLE;
+
+    printf("[usbd] Mode switch complete: %s (%lums)\n", mode_names[output_mode],
+           (unsigned long)(platform_time_ms() - mode_switch_start_ms));
+    return true;
+}
+#endif
+
 void usbd_task(void)
 {
+#if USBD_LIVE_MODE_SWITCH
+    if (mode_switch_state != MODE_SWITCH_IDLE && !mode_switch_task()) {
+        return;
+    }
+#endif
+
     // TinyUSB device task - runs from core0 main loop
     // On ESP32 (FreeRTOS), tud_task() blocks forever (UINT32_MAX timeout).
     // Use tud_task_ext with short timeout so the main loop keeps running.
@@ -993,8 +1127,10 @@ static bool usbd_send_sinput_report(uint8_t player_index)
         return false;
     }
 
-    // Check for pending event (event-driven from tap callback)
-    if (player_index >= USB_MAX_PLAYERS || !pending_flags[player_index]) {
+    // Check for pending event (event-driven from tap callback), or queued
+    // IMU samples that still need their own report
+    if (player_index >= USB_MAX_PLAYERS ||
+        (!pending_flags[player_index] && !usbd_imu_pending(player_index))) {
         return false;
     }
 
@@ -1160,8 +1296,9 @@ static bool usbd_send_ps4_report(uint8_t player_index)
     if (!mode || !mode->send_report) return false;
     if (mode->is_ready && !mode->is_ready()) return false;
 
-    // Check for pending event
-    if (player_index >= USB_MAX_PLAYERS || !pending_flags[player_index]) {
+    // Check for pending event or queued IMU samples
+    if (player_index >= USB_MAX_PLAYERS ||
+        (!pending_flags[player_index] && !usbd_imu_pending(player_index))) {
         return false;
     }
 
@@ -1266,7 +1403,46 @@ static bool usbd_send_gc_adapter_report(uint8_t player_index)
 }
 #endif
 
+// ============================================================================
+// DELIVERED REPORT RATE
+// ============================================================================
+
+// Reports actually handed to the IN endpoint, counted over one-second windows.
+// At HS with a 125us HID endpoint this is what tells a host-limited 1 kHz apart
+// from a true 8 kHz stream.
+static uint32_t report_count = 0;
+static uint32_t report_window_start_ms = 0;
+static uint32_t report_rate_hz = 0;
+
+static void usbd_count_report(void)
+{
+    report_count++;
+    uint32_t now = platform_time_ms();
+    uint32_t elapsed = now - report_window_start_ms;
+    if (elapsed >= 1000) {
+        report_rate_hz = (uint32_t)(((uint64_t)report_count * 1000) / elapsed);
+        report_count = 0;
+        report_window_start_ms = now;
+    }
+}
+
+uint32_t usbd_get_report_rate(void)
+{
+    // Decay to zero once reports stop, instead of holding the last busy window
+    if (platform_time_ms() - report_window_start_ms >= 2000) return 0;
+    return report_rate_hz;
+}
+
+static bool usbd_dispatch_report(uint8_t player_index);
+
 bool usbd_send_report(uint8_t player_index)
+{
+    bool sent = usbd_dispatch_report(player_index);
+    if (sent) usbd_count_report();
+    return sent;
+}
+
+static bool usbd_dispatch_report(uint8_t player_index)
 {
     switch (output_mode) {
         case USB_OUTPUT_MODE_CDC:
@@ -1736,9 +1912,9 @@ static void build_config_descriptors(void)
     memcpy(runtime_desc_cdc, cdc_header, TUD_CONFIG_DESC_LEN);
 }
 
-uint8_t const *tud_descriptor_configuration_cb(uint8_t index)
+// Full-speed descriptor for the active mode (bInterval in 1ms frames)
+static const uint8_t* usbd_fs_config_descriptor(void)
 {
-    (void)index;
     switch (output_mode) {
         case USB_OUTPUT_MODE_CDC:
             return runtime_desc_cdc;
@@ -1777,6 +1953,88 @@ uint8_t const *tud_descriptor_configuration_cb(uint8_t index)
     }
 }
 
+// ============================================================================
+// HIGH-SPEED DESCRIPTORS
+// ============================================================================
+
+// At high speed an interrupt bInterval is an exponent: the endpoint is polled
+// every 2^(bInterval-1) 125us microframes. The FS descriptors above carry 1ms
+// frame counts, so served unchanged at HS a PSClassic bInterval of 10 would be
+// polled every 64ms. HID-class endpoints get the fastest HS interval (default
+// 1 = every microframe, 8 kHz); vendor-class endpoints (XInput, XID, GIP, GC
+// adapter) keep their FS period so console-facing timing doesn't change.
+#ifndef USBD_HS_HID_BINTERVAL
+#define USBD_HS_HID_BINTERVAL 1
+#endif
+
+#define USBD_CONFIG_DESC_MAX 256
+
+#ifdef PLATFORM_CH32
+static uint8_t other_speed_desc[USBD_CONFIG_DESC_MAX];
+#endif
+
+#if TUD_OPT_HIGH_SPEED
+static uint8_t hs_config_desc[USBD_CONFIG_DESC_MAX];
+
+// FS frame count -> HS exponent with the same period (1ms = 8 microframes = 4)
+static uint8_t hs_interval_from_fs(uint8_t frames)
+{
+    uint8_t exp = 1;
+    uint32_t microframes = (uint32_t)(frames ? frames : 1) * 8;
+    while ((1u << exp) <= microframes && exp < 16) exp++;
+    return exp;
+}
+
+// Copy an FS config descriptor into hs_config_desc with HS interrupt intervals.
+// Returns the FS descriptor unchanged if it doesn't fit the buffer.
+static const uint8_t* build_hs_config_descriptor(const uint8_t* fs)
+{
+    uint16_t total = tu_le16toh(tu_unaligned_read16(fs + 2));
+    if (total > sizeof(hs_config_desc)) return fs;
+    memcpy(hs_config_desc, fs, total);
+
+    uint8_t itf_class = 0;
+    uint16_t off = 0;
+    while (off + 2 <= total) {
+        uint8_t* d = hs_config_desc + off;
+        if (d[0] == 0) break;
+        if (d[1] == TUSB_DESC_INTERFACE) {
+            itf_class = ((tusb_desc_interface_t*)d)->bInterfaceClass;
+        } else if (d[1] == TUSB_DESC_ENDPOINT) {
+            tusb_desc_endpoint_t* ep = (tusb_desc_endpoint_t*)d;
+            if (ep->bmAttributes.xfer == TUSB_XFER_INTERRUPT) {
+                ep->bInterval = (itf_class == TUSB_CLASS_HID)
+                    ? USBD_HS_HID_BINTERVAL
+                    : hs_interval_from_fs(ep->bInterval);
+            }
+        }
+        off += d[0];
+    }
+    return hs_config_desc;
+}
+#endif
+
+uint8_t const *tud_descriptor_configuration_cb(uint8_t index)
+{
+    (void)index;
+    const uint8_t* fs = usbd_fs_config_descriptor();
+#if TUD_OPT_HIGH_SPEED
+    if (tud_speed_get() == TUSB_SPEED_HIGH) {
+        return build_hs_config_descriptor(fs);
+    }
+#endif
+    return fs;
+}
+
+bool usbd_is_high_speed(void)
+{
+#if TUD_OPT_HIGH_SPEED
+    return tud_speed_get() == TUSB_SPEED_HIGH;
+#else
+    return false;
+#endif
+}
+
 // USB 2.0 device qualifier — Xbox console enumeration requests this during
 // the SET_CONFIGURATION dance. Returning NULL causes a STALL which some
 // hosts tolerate but the Xbox console treats as a hard failure for XBONE
@@ -1809,11 +2067,24 @@ uint8_t const *tud_descriptor_device_qualifier_cb(void)
 }
 
 #ifdef PLATFORM_CH32
-// After a valid qualifier the host requests the OTHER_SPEED_CONFIGURATION. The
-// device behaves identically at FS, so report the active config descriptor.
+// After a valid qualifier the host requests the OTHER_SPEED_CONFIGURATION: the
+// descriptor set the device would use at the speed it is NOT running at. Same
+// interfaces either way; only the endpoint intervals and the type byte differ.
 uint8_t const *tud_descriptor_other_speed_configuration_cb(uint8_t index)
 {
-    return tud_descriptor_configuration_cb(index);
+    (void)index;
+    const uint8_t* fs = usbd_fs_config_descriptor();
+    const uint8_t* other = fs;
+#if TUD_OPT_HIGH_SPEED
+    if (tud_speed_get() != TUSB_SPEED_HIGH) {
+        other = build_hs_config_descriptor(fs);
+    }
+#endif
+    uint16_t total = tu_le16toh(tu_unaligned_read16(other + 2));
+    if (total > sizeof(other_speed_desc)) return other;
+    memcpy(other_speed_desc, other, total);
+    other_speed_desc[1] = TUSB_DESC_OTHER_SPEED_CONFIG;
+    return other_speed_desc;
 }
 #endif
 
@@ -124,6 +124,12 @@ void usbd_task(void);
 // Send gamepad report for a player
 bool usbd_send_report(uint8_t player_index);
 
+// Reports delivered to the host per second (measured over 1s windows, 0 when idle)
+uint32_t usbd_get_report_rate(void);
+
+// True when the device enumerated at USB high speed (125us HID polling)
+bool usbd_is_high_speed(void);
+
 // App-overridable callback fired when the host (currently: PS3) issues a
 // "turn off controller" command to the USB device. Default impl in usbd.c
 // is a no-op; bt2usb overrides it to disconnect the bridged BT controller
@@ -141,7 +147,8 @@ usb_output_mode_t usbd_get_mode(void);
 
 // Set output mode (requires USB re-enumeration)
 // Returns true if mode was changed, false if same mode or invalid
-// Note: This will trigger a device reset to re-enumerate with new descriptors
+// Note: The device stack re-enumerates with the new descriptors from
+// usbd_task a few ms later; controllers stay connected. CH32/ESP32 reset.
 bool usbd_set_mode(usb_output_mode_t mode);
 
 // Get mode name string
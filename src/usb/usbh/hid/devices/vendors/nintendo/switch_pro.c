@@ -4,6 +4,8 @@
 #include "core/services/players/manager.h"
 #include "core/router/router.h"
 #include "core/input_event.h"
+#include "core/services/motion/imu.h"
+#include "usb/usbh/hid/hid_init_seq.h"
 #include "platform/platform.h"
 
 // Stick calibration data
@@ -17,11 +19,7 @@ typedef struct TU_ATTR_PACKED
   bool conn_ack;
   bool baud;
   bool baud_ack;
-  bool handshake;
-  bool handshake_ack;
-  bool usb_enable;
   bool usb_enable_ack;
-  bool home_led_set;
   bool full_report_enabled;
   bool imu_enabled;
   bool command_ack;
@@ -51,10 +49,35 @@ typedef struct
   // vice versa). -1 = unknown, 0 = left, 1 = right. Used by router to
   // produce "Joy-Con (L)"/"(R)" names.
   int8_t grip_side[CFG_TUH_HID];
+  hid_init_seq_t init[CFG_TUH_HID];
 } switch_device_t;
 
 static switch_device_t switch_devices[MAX_DEVICES] = { 0 };
 
+// USB bring-up, in order. Ack codes: 0x81xx = USB command reply (xx echoes
+// the command), 0x21xx = subcommand reply (xx = subcommand id at byte 14).
+// Subcommand acks only cut the settle time short: third-party controllers
+// don't always send them.
+enum {
+  INIT_HANDSHAKE = 0,
+  INIT_DISABLE_TIMEOUT,
+  INIT_HOME_LED,
+  INIT_FULL_REPORT,
+  INIT_IMU,
+  INIT_STEP_COUNT
+};
+
+#define INIT_ACK_USB(cmd)    (0x8100 | (cmd))
+#define INIT_ACK_SUBCMD(cmd) (0x2100 | (cmd))
+
+static const hid_init_step_t init_steps[INIT_STEP_COUNT] = {
+  [INIT_HANDSHAKE]       = { .ack = INIT_ACK_USB(SUBCMD_HANDSHAKE), .timeout_ms = 100 },
+  [INIT_DISABLE_TIMEOUT] = { .ack = 0, .timeout_ms = 100 },
+  [INIT_HOME_LED]        = { .ack = INIT_ACK_SUBCMD(CMD_LED_HOME), .timeout_ms = 100, .optional = true },
+  [INIT_FULL_REPORT]     = { .ack = INIT_ACK_SUBCMD(CMD_MODE), .timeout_ms = 100, .optional = true },
+  [INIT_IMU]             = { .ack = INIT_ACK_SUBCMD(CMD_GYRO), .timeout_ms = 100, .optional = true },
+};
+
 // Encode HD Rumble data for one motor (4 bytes)
 // Format from OGX-Mini (working implementation):
 //   Byte 0: Amplitude (0x40-0xC0 range for active, 0x00 for off)
@@ -137,6 +160,30 @@ static uint8_t scale_analog_calibrated(uint16_t val, uint16_t center) {
   return (uint8_t)(scaled + 128);
 }
 
+// Full mode (0x30) reports carry three IMU frames, oldest first and 5 ms
+// apart, at bytes 13-48: accel X/Y/Z then gyro X/Y/Z, int16 LE.
+// Default sensitivity is ±8 g / ±2000 dps.
+#define IMU_FRAME_OFFSET 13
+#define IMU_FRAME_SIZE 12
+#define IMU_FRAME_COUNT 3
+#define IMU_FRAME_US 5000
+#define IMU_ACCEL_RANGE_MG 8000
+#define IMU_GYRO_RANGE_DPS 2000
+
+// Decode one frame into DS4 axis order (X right, Y up, Z toward the player)
+static void decode_imu_frame(uint8_t const* f, int16_t accel[3], int16_t gyro[3])
+{
+  int16_t ax = (int16_t)(f[0] | (f[1] << 8));
+  int16_t ay = (int16_t)(f[2] | (f[3] << 8));
+  int16_t az = (int16_t)(f[4] | (f[5] << 8));
+  int16_t gx = (int16_t)(f[6] | (f[7] << 8));
+  int16_t gy = (int16_t)(f[8] | (f[9] << 8));
+  int16_t gz = (int16_t)(f[10] | (f[11] << 8));
+
+  accel[0] = -ay; accel[1] = az; accel[2] = -ax;
+  gyro[0] = -gy;  gyro[1] = gz;  gyro[2] = -gx;
+}
+
 // resets default values in case devices are hotswapped
 void unmount_switch_pro(uint8_t dev_addr, uint8_t instance)
 {
@@ -144,17 +191,14 @@ void unmount_switch_pro(uint8_t dev_addr, uint8_t instance)
   switch_devices[dev_addr].instances[instance].conn_ack = false;
   switch_devices[dev_addr].instances[instance].baud = false;
   switch_devices[dev_addr].instances[instance].baud_ack = false;
-  switch_devices[dev_addr].instances[instance].handshake = false;
-  switch_devices[dev_addr].instances[instance].handshake_ack = false;
-  switch_devices[dev_addr].instances[instance].usb_enable = false;
   switch_devices[dev_addr].instances[instance].usb_enable_ack = false;
-  switch_devices[dev_addr].instances[instance].home_led_set = false;
   switch_devices[dev_addr].instances[instance].command_ack = true;
   switch_devices[dev_addr].instances[instance].full_report_enabled = false;
   switch_devices[dev_addr].instances[instance].imu_enabled = false;
   switch_devices[dev_addr].instances[instance].rumble_left = 0;
   switch_devices[dev_addr].instances[instance].rumble_right = 0;
   switch_devices[dev_addr].instances[instance].player_led_set = 0xff;
+  hid_init_seq_reset(&switch_devices[dev_addr].init[instance]);
   switch_devices[dev_addr].is_pro = false;
 
   if (switch_devices[dev_addr].instance_count > 1) {
@@ -201,6 +245,27 @@ void input_report_switch_pro(uint8_t dev_addr, uint8_t instance, uint8_t const*
   {
     switch_devices[dev_addr].instances[instance].usb_enable_ack = true;
 
+    if (update_report.report_id == 0x21 && len > 14) {
+      hid_init_seq_ack(&switch_devices[dev_addr].init[instance], init_steps, INIT_STEP_COUNT,
+                       INIT_ACK_SUBCMD(report[14]));
+    }
+
+    // Queue every IMU frame at its capture time; the input event below only
+    // carries the newest one and is only submitted when buttons/sticks change.
+    int16_t accel[3] = { 0 };
+    int16_t gyro[3] = { 0 };
+    bool has_motion = update_report.report_id == 0x30 &&
+                      switch_devices[dev_addr].instances[instance].imu_enabled &&
+                      len >= IMU_FRAME_OFFSET + IMU_FRAME_SIZE * IMU_FRAME_COUNT;
+    if (has_motion) {
+      uint32_t now_us = platform_time_us();
+      for (uint8_t i = 0; i < IMU_FRAME_COUNT; i++) {
+        decode_imu_frame(&report[IMU_FRAME_OFFSET + i * IMU_FRAME_SIZE], accel, gyro);
+        imu_push(dev_addr, instance, accel, gyro, IMU_ACCEL_RANGE_MG, IMU_GYRO_RANGE_DPS,
+                 now_us - (IMU_FRAME_COUNT - 1 - i) * IMU_FRAME_US);
+      }
+    }
+
     update_report.left_x = (update_report.left_stick[0] & 0xFF) | ((update_report.left_stick[1] & 0x0F) << 8);
     update_report.left_y = ((update_report.left_stick[1] & 0xF0) >> 4) | ((update_report.left_stick[2] & 0xFF) << 4);
     update_report.right_x = (update_report.right_stick[0] & 0xFF) | ((update_report.right_stick[1] & 0x0F) << 8);
@@ -386,6 +451,11 @@ void input_report_switch_pro(uint8_t dev_addr, uint8_t instance, uint8_t const*
         .keys = 0,
         .battery_level = bat_level,
         .battery_charging = bat_charging,
+        .accel = { accel[0], accel[1], accel[2] },
+        .gyro = { gyro[0], gyro[1], gyro[2] },
+        .gyro_range = IMU_GYRO_RANGE_DPS,
+        .accel_range = IMU_ACCEL_RANGE_MG,
+        .has_motion = has_motion,
       };
       router_submit_input(&event);
 
@@ -411,7 +481,8 @@ void input_report_switch_pro(uint8_t dev_addr, uint8_t instance, uint8_t const*
       }
     }
     else if (state_report.buf[0] == 0x81 && state_report.buf[1] == 0x02) { // JC_USB_CMD_HANDSHAKE
-      switch_devices[dev_addr].instances[instance].handshake_ack = true;
+      hid_init_seq_ack(&switch_devices[dev_addr].init[instance], init_steps, INIT_STEP_COUNT,
+                       INIT_ACK_USB(SUBCMD_HANDSHAKE));
     }
     else if (state_report.buf[0] == 0x81 && state_report.buf[1] == 0x03) { // JC_USB_CMD_BAUDRATE_3M
       switch_devices[dev_addr].instances[instance].baud_ack = true;
@@ -470,162 +541,186 @@ void output_switch_pro(uint8_t dev_addr, uint8_t instance, device_output_config_
 
     // // wait for baud ask and then send init handshake
     // } else if (!switch_devices[dev_addr].instances[instance].handshake && switch_devices[dev_addr].instances[instance].baud_ack) {
-    if (!switch_devices[dev_addr].instances[instance].handshake) {
-      TU_LOG1("SWITCH[%d|%d]: CMD_HID, HANDSHAKE\r\n", dev_addr, instance);
+    hid_init_seq_t* seq = &switch_devices[dev_addr].init[instance];
+    hid_init_action_t action = hid_init_seq_poll(seq, init_steps, INIT_STEP_COUNT, platform_time_ms());
 
-      uint8_t handshake_command[2] = {CMD_HID, SUBCMD_HANDSHAKE};
+    // No handshake ack after every retry: start over rather than stall here
+    if (action == HID_INIT_FAILED) {
+      TU_LOG1("SWITCH[%d|%d]: No handshake ack, restarting init\r\n", dev_addr, instance);
+      hid_init_seq_reset(seq);
+      return;
+    }
 
-      switch_devices[dev_addr].instances[instance].handshake =
-        tuh_hid_send_report(dev_addr, instance, 0, handshake_command, sizeof(handshake_command));
+    // Waiting for an ack or settle time; poll again next loop
+    if (action == HID_INIT_WAIT) {
+      return;
+    }
 
-      tuh_hid_receive_report(dev_addr, instance);
+    uint8_t report[14] = { 0 };
+    uint8_t report_size = 10;
 
-    // wait for handshake ack and then send USB enable mode
-    } else if (!switch_devices[dev_addr].instances[instance].usb_enable && switch_devices[dev_addr].instances[instance].handshake_ack) {
-      TU_LOG1("SWITCH[%d|%d]: CMD_HID, DISABLE_TIMEOUT\r\n", dev_addr, instance);
+    report[0x00] = CMD_RUMBLE_ONLY; // COMMAND
+    // Lowest 4-bit is a sequence number, which needs to be increased for every report
 
-      uint8_t disable_timeout_cmd[2] = {CMD_HID, SUBCMD_DISABLE_TIMEOUT};
+    if (action == HID_INIT_SEND) {
+      bool sent = false;
 
-      switch_devices[dev_addr].instances[instance].usb_enable =
-        tuh_hid_send_report(dev_addr, instance, 0, disable_timeout_cmd, sizeof(disable_timeout_cmd));
+      switch (seq->step) {
+        case INIT_HANDSHAKE: {
+          TU_LOG1("SWITCH[%d|%d]: CMD_HID, HANDSHAKE\r\n", dev_addr, instance);
 
-      platform_sleep_ms(100);
-      tuh_hid_receive_report(dev_addr, instance);
+          uint8_t handshake_command[2] = {CMD_HID, SUBCMD_HANDSHAKE};
 
-    // wait for usb enabled acknowledgment
-    } else if (switch_devices[dev_addr].instances[instance].usb_enable) {
+          sent = tuh_hid_send_report(dev_addr, instance, 0, handshake_command, sizeof(handshake_command));
+          tuh_hid_receive_report(dev_addr, instance);
+          break;
+        }
 
-      uint8_t report[14] = { 0 };
-      uint8_t report_size = 10;
+        // handshake acked, send USB enable mode
+        case INIT_DISABLE_TIMEOUT: {
+          TU_LOG1("SWITCH[%d|%d]: CMD_HID, DISABLE_TIMEOUT\r\n", dev_addr, instance);
 
-      report[0x00] = CMD_RUMBLE_ONLY; // COMMAND
-       // Lowest 4-bit is a sequence number, which needs to be increased for every report
+          uint8_t disable_timeout_cmd[2] = {CMD_HID, SUBCMD_DISABLE_TIMEOUT};
 
-      if (!switch_devices[dev_addr].instances[instance].home_led_set) {
-        TU_LOG1("SWITCH[%d|%d]: CMD_AND_RUMBLE, CMD_LED_HOME \r\n", dev_addr, instance);
-        
-        report_size = 14;
+          sent = tuh_hid_send_report(dev_addr, instance, 0, disable_timeout_cmd, sizeof(disable_timeout_cmd));
+          tuh_hid_receive_report(dev_addr, instance);
+          break;
+        }
 
-        report[0x01] = output_sequence_counter++;
-        report[0x00] = CMD_AND_RUMBLE;   // COMMAND
-        report[0x0A + 0] = CMD_LED_HOME; // SUB_COMMAND
-        
-        // SUB_COMMAND ARGS
-        report[0x0A + 1] = (0 /* Number of cycles */ << 4) | (true ? 0xF : 0) /* Global mini cycle duration */;
-        report[0x0A + 2] = (0x1 /* LED start intensity */ << 4) | 0x0 /* Number of full cycles */;
-        report[0x0A + 3] = (0x0 /* Mini Cycle 1 LED intensity */ << 4) | 0x1 /* Mini Cycle 2 LED intensity */;
+        case INIT_HOME_LED:
+          TU_LOG1("SWITCH[%d|%d]: CMD_AND_RUMBLE, CMD_LED_HOME \r\n", dev_addr, instance);
 
-        // It is possible set up to 15 mini cycles, but we simply just set the LED constantly on after momentary off.
-        // See: https://github.com/dekuNukem/Nintendo_Switch_Reverse_Engineering/blob/master/bluetooth_hid_subcommands_notes.md#subcommand-0x38-set-home-light
+          report_size = 14;
 
-        if (tuh_hid_send_report(dev_addr, instance, 0, report, report_size)) {
-          switch_devices[dev_addr].instances[instance].home_led_set = true;
-          platform_sleep_ms(100);
-        }
+          report[0x01] = output_sequence_counter++;
+          report[0x00] = CMD_AND_RUMBLE;   // COMMAND
+          report[0x0A + 0] = CMD_LED_HOME; // SUB_COMMAND
 
-      } else if (!switch_devices[dev_addr].instances[instance].full_report_enabled) {
-        TU_LOG1("SWITCH[%d|%d]: CMD_AND_RUMBLE, CMD_MODE, FULL_REPORT_MODE \r\n", dev_addr, instance);
+          // SUB_COMMAND ARGS
+          report[0x0A + 1] = (0 /* Number of cycles */ << 4) | (true ? 0xF : 0) /* Global mini cycle duration */;
+          report[0x0A + 2] = (0x1 /* LED start intensity */ << 4) | 0x0 /* Number of full cycles */;
+          report[0x0A + 3] = (0x0 /* Mini Cycle 1 LED intensity */ << 4) | 0x1 /* Mini Cycle 2 LED intensity */;
 
-        report_size = 14;
+          // It is possible set up to 15 mini cycles, but we simply just set the LED constantly on after momentary off.
+          // See: https://github.com/dekuNukem/Nintendo_Switch_Reverse_Engineering/blob/master/bluetooth_hid_subcommands_notes.md#subcommand-0x38-set-home-light
 
-        report[0x01] = output_sequence_counter++;
-        report[0x00] = CMD_AND_RUMBLE;              // COMMAND
-        report[0x0A + 0] = CMD_MODE;                // SUB_COMMAND
-        report[0x0A + 1] = SUBCMD_FULL_REPORT_MODE; // SUB_COMMAND ARGS
+          sent = tuh_hid_send_report(dev_addr, instance, 0, report, report_size);
+          break;
 
-        if (tuh_hid_send_report(dev_addr, instance, 0, report, report_size)) {
-          switch_devices[dev_addr].instances[instance].full_report_enabled = true;
-          platform_sleep_ms(100);
-        }
+        case INIT_FULL_REPORT:
+          TU_LOG1("SWITCH[%d|%d]: CMD_AND_RUMBLE, CMD_MODE, FULL_REPORT_MODE \r\n", dev_addr, instance);
 
-      // } else if (!switch_devices[dev_addr].instances[instance].imu_enabled) {
-      //   TU_LOG1("SWITCH[%d|%d]: CMD_AND_RUMBLE, CMD_GYRO, 1 \r\n", dev_addr, instance);
-
-      //   report_size = 12;
-
-      //   report[0x00] = CMD_AND_RUMBLE; // COMMAND
-      //   report[0x0A + 0] = CMD_GYRO;   // SUB_COMMAND
-      //   report[0x0A + 1] = 1 ? 1 : 0;  // SUB_COMMAND ARGS
-
-      //   switch_devices[dev_addr].instances[instance].imu_enabled = true;
-      //   tuh_hid_send_report(dev_addr, instance, 0, report, report_size);
-      //   platform_sleep_ms(100);
-
-      // } else if (switch_devices[dev_addr].instances[instance].imu_enabled) {
-      } else if (switch_devices[dev_addr].instances[instance].full_report_enabled) {
-        // Use player_index from USB output interface config. Joy-Con
-        // Charging Grip exposes both Joy-Cons as separate HID interfaces
-        // but they share a single player slot at the root instance — so
-        // for non-root joycons we look the slot up via the root instance
-        // ourselves (hid.c iterates per-instance and would pass -1).
-        int player_index = config->player_index;
-        if (switch_devices[dev_addr].instance_count > 1 &&
-            instance != switch_devices[dev_addr].instance_root) {
-          int root_pi = find_player_index(dev_addr, switch_devices[dev_addr].instance_root);
-          if (root_pi >= 0) player_index = root_pi;
-        }
+          report_size = 14;
 
-        // Skip LED command before a player slot is assigned (player_index < 0).
-        // Otherwise we spam the controller with LED OFF every loop iteration:
-        // player_led_set (uint8_t 0xFF) != -1 (sign-extended) is always true,
-        // and (-1 cast back to uint8_t) is 0xFF — so the comparison never
-        // becomes false until the slot is assigned.
-        if (player_index >= 0 && (config->test ||
-          switch_devices[dev_addr].instances[instance].player_led_set != player_index
-        )) {
-          TU_LOG1("SWITCH[%d|%d]: CMD_AND_RUMBLE, CMD_LED, %d (was %d)\r\n",
-                  dev_addr, instance, player_index,
-                  switch_devices[dev_addr].instances[instance].player_led_set);
+          report[0x01] = output_sequence_counter++;
+          report[0x00] = CMD_AND_RUMBLE;              // COMMAND
+          report[0x0A + 0] = CMD_MODE;                // SUB_COMMAND
+          report[0x0A + 1] = SUBCMD_FULL_REPORT_MODE; // SUB_COMMAND ARGS
+
+          sent = tuh_hid_send_report(dev_addr, instance, 0, report, report_size);
+          if (sent) {
+            switch_devices[dev_addr].instances[instance].full_report_enabled = true;
+          }
+          break;
+
+        case INIT_IMU:
+          TU_LOG1("SWITCH[%d|%d]: CMD_AND_RUMBLE, CMD_GYRO, 1 \r\n", dev_addr, instance);
 
           report_size = 12;
 
-          report[0x00] = CMD_AND_RUMBLE; // COMMAND
           report[0x01] = output_sequence_counter++;
+          report[0x00] = CMD_AND_RUMBLE; // COMMAND
+          report[0x0A + 0] = CMD_GYRO;   // SUB_COMMAND
+          report[0x0A + 1] = 0x01;       // SUB_COMMAND ARGS (enable)
+
+          sent = tuh_hid_send_report(dev_addr, instance, 0, report, report_size);
+          if (sent) {
+            switch_devices[dev_addr].instances[instance].imu_enabled = true;
+          }
+          break;
 
-          // Include current rumble state in CMD_AND_RUMBLE
-          encode_rumble(config->rumble_left, &report[0x02]);       // Left motor
-          encode_rumble(config->rumble_right, &report[0x02 + 4]);  // Right motor
+        default:
+          break;
+      }
 
-          report[0x0A + 0] = CMD_LED;    // SUB_COMMAND
+      // Endpoint busy: try the same step again next loop
+      if (sent) {
+        hid_init_seq_sent(seq, platform_time_ms());
+      }
 
-          // SUB_COMMAND ARGS - use PLAYER_LEDS pattern based on player index
-          if (player_index >= 0 && player_index < 5) {
-            report[0x0A + 1] = PLAYER_LEDS[player_index + 1];
-          } else {
-            // unassigned - turn all leds on
-            report[0x0A + 1] = 0x0f;
-          }
+    } else if (switch_devices[dev_addr].instances[instance].full_report_enabled) {
+      // Use player_index from USB output interface config. Joy-Con
+      // Charging Grip exposes both Joy-Cons as separate HID interfaces
+      // but they share a single player slot at the root instance — so
+      // for non-root joycons we look the slot up via the root instance
+      // ourselves (hid.c iterates per-instance and would pass -1).
+      int player_index = config->player_index;
+      if (switch_devices[dev_addr].instance_count > 1 &&
+          instance != switch_devices[dev_addr].instance_root) {
+        int root_pi = find_player_index(dev_addr, switch_devices[dev_addr].instance_root);
+        if (root_pi >= 0) player_index = root_pi;
+      }
 
-          // test mode override
-          if (config->test) {
-            report[0x0A + 1] = (config->test & 0b00001111);
-          }
+      // Skip LED command before a player slot is assigned (player_index < 0).
+      // Otherwise we spam the controller with LED OFF every loop iteration:
+      // player_led_set (uint8_t 0xFF) != -1 (sign-extended) is always true,
+      // and (-1 cast back to uint8_t) is 0xFF — so the comparison never
+      // becomes false until the slot is assigned.
+      if (player_index >= 0 && (config->test ||
+        switch_devices[dev_addr].instances[instance].player_led_set != player_index
+      )) {
+        TU_LOG1("SWITCH[%d|%d]: CMD_AND_RUMBLE, CMD_LED, %d (was %d)\r\n",
+                dev_addr, instance, player_index,
+                switch_devices[dev_addr].instances[instance].player_led_set);
+
+        report_size = 12;
+
+        report[0x00] = CMD_AND_RUMBLE; // COMMAND
+        report[0x01] = output_sequence_counter++;
 
-          if (tuh_hid_send_report(dev_addr, instance, 0, report, report_size)) {
-            switch_devices[dev_addr].instances[instance].player_led_set = player_index;
-            switch_devices[dev_addr].instances[instance].rumble_left = config->rumble_left;
-            switch_devices[dev_addr].instances[instance].rumble_right = config->rumble_right;
-          }
+        // Include current rumble state in CMD_AND_RUMBLE
+        encode_rumble(config->rumble_left, &report[0x02]);       // Left motor
+        encode_rumble(config->rumble_right, &report[0x02 + 4]);  // Right motor
+
+        report[0x0A + 0] = CMD_LED;    // SUB_COMMAND
+
+        // SUB_COMMAND ARGS - use PLAYER_LEDS pattern based on player index
+        if (player_index >= 0 && player_index < 5) {
+          report[0x0A + 1] = PLAYER_LEDS[player_index + 1];
+        } else {
+          // unassigned - turn all leds on
+          report[0x0A + 1] = 0x0f;
         }
-        else if (switch_devices[dev_addr].instances[instance].rumble_left != config->rumble_left ||
-                 switch_devices[dev_addr].instances[instance].rumble_right != config->rumble_right)
-        {
-          TU_LOG1("SWITCH[%d|%d]: CMD_RUMBLE_ONLY, L=%d R=%d\r\n", dev_addr, instance,
-                  config->rumble_left, config->rumble_right);
 
-          report_size = 10;
+        // test mode override
+        if (config->test) {
+          report[0x0A + 1] = (config->test & 0b00001111);
+        }
 
-          report[0x01] = output_sequence_counter++;
-          report[0x00] = CMD_RUMBLE_ONLY; // COMMAND
+        if (tuh_hid_send_report(dev_addr, instance, 0, report, report_size)) {
+          switch_devices[dev_addr].instances[instance].player_led_set = player_index;
+          switch_devices[dev_addr].instances[instance].rumble_left = config->rumble_left;
+          switch_devices[dev_addr].instances[instance].rumble_right = config->rumble_right;
+        }
+      }
+      else if (switch_devices[dev_addr].instances[instance].rumble_left != config->rumble_left ||
+               switch_devices[dev_addr].instances[instance].rumble_right != config->rumble_right)
+      {
+        TU_LOG1("SWITCH[%d|%d]: CMD_RUMBLE_ONLY, L=%d R=%d\r\n", dev_addr, instance,
+                config->rumble_left, config->rumble_right);
 
-          // Encode rumble with intensity passthrough
-          encode_rumble(config->rumble_left, &report[0x02]);       // Left motor
-          encode_rumble(config->rumble_right, &report[0x02 + 4]);  // Right motor
+        report_size = 10;
 
-          if (tuh_hid_send_report(dev_addr, instance, 0, report, report_size)) {
-            switch_devices[dev_addr].instances[instance].rumble_left = config->rumble_left;
-            switch_devices[dev_addr].instances[instance].rumble_right = config->rumble_right;
-          }
+        report[0x01] = output_sequence_counter++;
+        report[0x00] = CMD_RUMBLE_ONLY; // COMMAND
+
+        // Encode rumble with intensity passthrough
+        encode_rumble(config->rumble_left, &report[0x02]);       // Left motor
+        encode_rumble(config->rumble_right, &report[0x02 + 4]);  // Right motor
+
+        if (tuh_hid_send_report(dev_addr, instance, 0, report, report_size)) {
+          switch_devices[dev_addr].instances[instance].rumble_left = config->rumble_left;
+          switch_devices[dev_addr].instances[instance].rumble_right = config->rumble_right;
         }
       }
     }
@@ -657,6 +752,7 @@ static inline bool init_switch_pro(uint8_t dev_addr, uint8_t instance)
   switch_devices[dev_addr].instances[instance].rumble_right = 0xFF;
   switch_devices[dev_addr].instances[instance].player_led_set = 0xFF;
   switch_devices[dev_addr].grip_side[instance] = -1;  // Unknown until first report
+  hid_init_seq_reset(&switch_devices[dev_addr].init[instance]);
 
   if ((++switch_devices[dev_addr].instance_count) == 1) {
     switch_devices[dev_addr].instance_root = instance; // save initial root instance to merge extras into
@@ -5,6 +5,7 @@
 #include "core/services/players/manager.h"
 #include "core/router/router.h"
 #include "core/input_event.h"
+#include "usb/usbh/hid/hid_init_seq.h"
 #include "platform/platform.h"
 
 // TODO: Get these from BTstack when BT dongle is connected
@@ -23,8 +24,7 @@ typedef enum {
   DS3_STATE_IDLE,           // Not initialized
   DS3_STATE_ACTIVATING,     // Sent activation report 0xF4, waiting for completion
   DS3_STATE_WAIT_ACTIVE,    // Wait for DS3 to become active (receive first input)
-  DS3_STATE_SET_BT_ADDR,    // Need to send BT host address report 0xF5
-  DS3_STATE_VERIFY_BT_ADDR, // Read back BT address to verify
+  DS3_STATE_SET_BT_ADDR,    // Running the pairing sequence (read, then set 0xF5)
   DS3_STATE_READY           // Fully initialized
 } ds3_state_t;
 
@@ -37,14 +37,13 @@ typedef struct TU_ATTR_PACKED
   bool bt_addr_sent;        // Have we successfully sent BT address?
   bool input_received;      // Have we received input (DS3 is active)?
   bool button_pressed;      // Has user pressed any button? (for BT pairing trigger)
-  bool verify_pending;      // Waiting for GET_REPORT callback?
-  uint32_t delay_start;     // For timing delays
 } ds3_instance_t;
 
 // Cached device report properties on mount
-typedef struct TU_ATTR_PACKED
+typedef struct
 {
   ds3_instance_t instances[CFG_TUH_HID];
+  hid_init_seq_t pairing[CFG_TUH_HID];
 } ds3_device_t;
 
 static ds3_device_t ds3_devices[MAX_DEVICES] = { 0 };
@@ -56,13 +55,38 @@ static const uint8_t ds3_init_cmd_buf[4] = {0x42, 0x0c, 0x00, 0x00};
 #define DS3_REPORT_ACTIVATE     0xF4
 #define DS3_REPORT_BT_HOST_ADDR 0xF5
 
-// Called from sony_ds4.c when GET_REPORT 0xF5 completes
-void ds3_on_get_report_complete(uint8_t dev_addr, uint8_t instance) {
+// BT pairing: read the current host address, then program ours. The read is
+// informational, so a missing reply only costs its timeout.
+enum {
+  DS3_PAIR_GET_BT_ADDR = 0,
+  DS3_PAIR_SET_BT_ADDR,
+  DS3_PAIR_STEP_COUNT
+};
+
+#define DS3_ACK_GET_BT_ADDR 1
+#define DS3_ACK_SET_BT_ADDR 2
+
+static const hid_init_step_t ds3_pair_steps[DS3_PAIR_STEP_COUNT] = {
+  [DS3_PAIR_GET_BT_ADDR] = { .ack = DS3_ACK_GET_BT_ADDR, .timeout_ms = 500, .optional = true },
+  [DS3_PAIR_SET_BT_ADDR] = { .ack = DS3_ACK_SET_BT_ADDR, .timeout_ms = 500 },
+};
+
+static void ds3_pair_ack(uint8_t dev_addr, uint8_t instance, uint16_t ack) {
   if (dev_addr < MAX_DEVICES && instance < CFG_TUH_HID) {
-    ds3_devices[dev_addr].instances[instance].verify_pending = false;
+    hid_init_seq_ack(&ds3_devices[dev_addr].pairing[instance], ds3_pair_steps, DS3_PAIR_STEP_COUNT, ack);
   }
 }
 
+// Called from sony_ds4.c when GET_REPORT 0xF5 completes (len 0 = failed)
+void ds3_on_get_report_complete(uint8_t dev_addr, uint8_t instance, uint16_t len) {
+  if (len) ds3_pair_ack(dev_addr, instance, DS3_ACK_GET_BT_ADDR);
+}
+
+// Called from sony_ds4.c when SET_REPORT 0xF5 completes (len 0 = failed)
+void ds3_on_set_report_complete(uint8_t dev_addr, uint8_t instance, uint16_t len) {
+  if (len) ds3_pair_ack(dev_addr, instance, DS3_ACK_SET_BT_ADDR);
+}
+
 // check if device is Sony PlayStation 3 controllers
 bool is_sony_ds3(uint16_t vid, uint16_t pid) {
   return (
@@ -364,89 +388,6 @@ void output_sony_ds3(uint8_t dev_addr, uint8_t instance, device_output_config_t*
   }
 }
 
-// Static buffer for control transfer (must persist until transfer completes)
-static uint8_t ds3_ctrl_buf[16];  // Extra space for report ID prefix
-static tusb_control_request_t ds3_ctrl_request;
-static volatile bool ds3_xfer_complete = false;
-static volatile bool ds3_xfer_success = false;
-
-// Callback for async control transfer
-static void ds3_ctrl_xfer_cb(tuh_xfer_t* xfer) {
-  printf("[DS3] Control transfer callback: result=%d xferred=%lu\n",
-         xfer->result, (unsigned long)xfer->actual_len);
-  ds3_xfer_success = (xfer->result == XFER_RESULT_SUCCESS);
-  ds3_xfer_complete = true;
-}
-
-// Raw USB control transfer for DS3 SET_REPORT (bypasses TinyUSB HID layer)
-// USB Host Shield uses: ctrlReq(addr, ep0, 0x21, 0x09, 0xF5, 0x03, 0x00, 8, 8, buf)
-static bool ds3_set_report_raw(uint8_t dev_addr, uint8_t instance, uint8_t report_id, uint8_t* data, uint16_t len) {
-  printf("[DS3] ds3_set_report_raw called: dev=%d inst=%d report=0x%02X len=%d\n",
-         dev_addr, instance, report_id, len);
-
-  // Get interface number from TinyUSB HID layer
-  tuh_itf_info_t itf_info;
-  bool got_info = tuh_hid_itf_get_info(dev_addr, instance, &itf_info);
-  printf("[DS3] tuh_hid_itf_get_info returned: %d\n", got_info);
-
-  uint8_t itf_num = 0;  // Default to interface 0
-  if (got_info) {
-    itf_num = itf_info.desc.bInterfaceNumber;
-  }
-  printf("[DS3] Using interface %d for SET_REPORT\n", itf_num);
-
-  // Copy to static buffer
-  memcpy(ds3_ctrl_buf, data, len);
-
-  ds3_ctrl_request = (tusb_control_request_t){
-    .bmRequestType_bit = {
-      .recipient = TUSB_REQ_RCPT_INTERFACE,
-      .type = TUSB_REQ_TYPE_CLASS,
-      .direction = TUSB_DIR_OUT
-    },
-    .bRequest = 0x09,  // HID_REQUEST_SET_REPORT
-    .wValue = tu_htole16((0x03 << 8) | report_id),  // Feature report (0x03) | report_id
-    .wIndex = tu_htole16(itf_num),
-    .wLength = len
-  };
-
-  ds3_xfer_complete = false;
-  ds3_xfer_success = false;
-
-  tuh_xfer_t xfer = {
-    .daddr = dev_addr,
-    .ep_addr = 0,
-    .setup = &ds3_ctrl_request,
-    .buffer = ds3_ctrl_buf,
-    .buflen = len,
-    .complete_cb = ds3_ctrl_xfer_cb,
-    .user_data = 0
-  };
-
-  printf("[DS3] Control xfer: wValue=0x%04X wIndex=0x%04X wLength=%d\n",
-         ds3_ctrl_request.wValue, ds3_ctrl_request.wIndex, ds3_ctrl_request.wLength);
-
-  bool queued = tuh_control_xfer(&xfer);
-  printf("[DS3] tuh_control_xfer queued: %d\n", queued);
-
-  if (!queued) {
-    return false;
-  }
-
-  // Wait for completion with timeout
-  uint32_t start = platform_time_ms();
-  while (!ds3_xfer_complete) {
-    tuh_task();  // Process USB events
-    if (platform_time_ms() - start > 1000) {
-      printf("[DS3] Control transfer timeout!\n");
-      return false;
-    }
-  }
-
-  printf("[DS3] Control transfer complete: success=%d\n", ds3_xfer_success);
-  return ds3_xfer_success;
-}
-
 // Static buffer for SET_REPORT - must persist until async transfer completes!
 static uint8_t ds3_bt_addr_buf[8];
 
@@ -508,6 +449,7 @@ static inline bool init_sony_ds3(uint8_t dev_addr, uint8_t instance) {
 // process usb hid output reports
 void task_sony_ds3(uint8_t dev_addr, uint8_t instance, device_output_config_t* config) {
   ds3_instance_t* inst = &ds3_devices[dev_addr].instances[instance];
+  hid_init_seq_t* pairing = &ds3_devices[dev_addr].pairing[instance];
 
   // Handle init state machine
   switch (inst->init_state) {
@@ -528,34 +470,41 @@ void task_sony_ds3(uint8_t dev_addr, uint8_t instance, device_output_config_t* c
     case DS3_STATE_WAIT_ACTIVE:
       // Wait until user presses a button
       if (inst->button_pressed) {
-        // Read current address before setting
-        extern uint8_t* ds3_get_verify_buffer(void);
-        if (tuh_hid_get_report(dev_addr, instance, DS3_REPORT_BT_HOST_ADDR,
-                               HID_REPORT_TYPE_FEATURE, ds3_get_verify_buffer(), 8)) {
-          inst->verify_pending = true;
-        }
+        hid_init_seq_reset(pairing);
         inst->init_state = DS3_STATE_SET_BT_ADDR;
       }
       break;
 
     case DS3_STATE_SET_BT_ADDR:
-      // Wait for GET_REPORT to complete before sending SET_REPORT
-      if (inst->verify_pending) {
-        break;
-      }
+      // Read current address, then set ours. Each step goes out once the
+      // previous one completed (or timed out) so GET and SET never overlap.
+      switch (hid_init_seq_poll(pairing, ds3_pair_steps, DS3_PAIR_STEP_COUNT, platform_time_ms())) {
+        case HID_INIT_SEND: {
+          bool sent = false;
+          if (pairing->step == DS3_PAIR_GET_BT_ADDR) {
+            extern uint8_t* ds3_get_verify_buffer(void);
+            sent = tuh_hid_get_report(dev_addr, instance, DS3_REPORT_BT_HOST_ADDR,
+                                      HID_REPORT_TYPE_FEATURE, ds3_get_verify_buffer(), 8);
+          } else {
+            sent = ds3_send_bt_host_address(dev_addr, instance);
+          }
+          if (sent) hid_init_seq_sent(pairing, platform_time_ms());
+          break;
+        }
 
-      // Set BT address (only once)
-      if (!inst->bt_addr_sent) {
-        if (ds3_send_bt_host_address(dev_addr, instance)) {
+        case HID_INIT_DONE:
           inst->bt_addr_sent = true;
-        }
-      }
-      inst->init_state = DS3_STATE_READY;
-      break;
+          inst->init_state = DS3_STATE_READY;
+          break;
+
+        case HID_INIT_FAILED:
+          printf("[DS3] BT host address not acknowledged, pairing skipped\n");
+          inst->init_state = DS3_STATE_READY;
+          break;
 
-    case DS3_STATE_VERIFY_BT_ADDR:
-      // Skip verification for now - it conflicts with SET_REPORT
-      inst->init_state = DS3_STATE_READY;
+        default:
+          break;
+      }
       break;
 
     case DS3_STATE_READY:
@@ -592,8 +592,8 @@ void tuh_hid_get_report_complete_cb(uint8_t dev_addr, uint8_t idx,
     // Handle DS3 BT address verification (report 0xF5)
     if (report_id == 0xF5) {
         // Notify DS3 driver that GET_REPORT completed
-        extern void ds3_on_get_report_complete(uint8_t dev_addr, uint8_t instance);
-        ds3_on_get_report_complete(dev_addr, idx);
+        extern void ds3_on_get_report_complete(uint8_t dev_addr, uint8_t instance, uint16_t len);
+        ds3_on_get_report_complete(dev_addr, idx, len);
 
         if (len == 0) {
             printf("[DS3] GET_REPORT 0xF5 FAILED\n");
@@ -670,6 +670,8 @@ void tuh_hid_set_report_complete_cb(uint8_t dev_addr, uint8_t idx,
                                     uint16_t len) {
     // DS3 BT address programming complete
     if (report_id == 0xF5) {
+        extern void ds3_on_set_report_complete(uint8_t dev_addr, uint8_t instance, uint16_t len);
+        ds3_on_set_report_complete(dev_addr, idx, len);
         if (len == 8) {
             printf("[DS3] BT host address programmed successfully\n");
         }
@@ -1,6 +1,7 @@
 // hid.c - HID protocol handler (TinyUSB HID host callbacks)
 #include "tusb.h"
 #include <stdio.h>
+#include <string.h>
 #include "core/buttons.h"
 #include "core/output_interface.h"
 #include "core/services/players/manager.h"
@@ -278,6 +279,20 @@ void tuh_hid_umount_cb(uint8_t dev_addr, uint8_t instance)
 // Invoked when received report from device via interrupt endpoint
 void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len)
 {
+  // Double-buffer: copy the report out of TinyUSB's endpoint buffer and
+  // re-arm the IN transfer before parsing, so the next report can land while
+  // this one is being processed instead of waiting for the driver to finish.
+  // Callbacks are serialized in tuh_task(), so a single copy buffer suffices.
+  static uint8_t report_copy[CFG_TUH_HID_EPIN_BUFSIZE];
+  if (len > sizeof(report_copy)) len = sizeof(report_copy);
+  memcpy(report_copy, report, len);
+  report = report_copy;
+
+  // Note: vendor drivers (e.g. switch_pro) still re-arm inside process() to
+  // avoid stalling between subcommand exchanges. Their claim will now fail
+  // because the endpoint is already busy — that's expected, not an error.
+  tuh_hid_receive_report(dev_addr, instance);
+
   dev_type_t dev_type = devices[dev_addr].instances[instance].type;
   if (dev_type == CONTROLLER_UNKNOWN)
   {
@@ -305,12 +320,6 @@ void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance, uint8_t cons
     // process known device interface reports
     device_interfaces[dev_type]->process(dev_addr, instance, report, len);
   }
-
-  // continue to request to receive report.
-  // Note: vendor drivers (e.g. switch_pro) may have already re-armed inside
-  // their process() above to avoid stalling between subcommand exchanges.
-  // In that case the claim here will fail — that's expected, not an error.
-  tuh_hid_receive_report(dev_addr, instance);
 }
 
 //--------------------------------------------------------------------+
@@ -0,0 +1,126 @@
+// hid_init_seq.h - Non-blocking init sequencer for USB host vendor drivers
+//
+// Vendor handshakes are a list of "send X, then wait for Y or some time".
+// Sleeping for the wait stalls every other controller and the console
+// output, so drivers describe the steps instead and drive them from their
+// task (called every main loop) and report callbacks:
+//
+//   static const hid_init_step_t steps[] = {
+//       { .ack = ACK_HANDSHAKE, .timeout_ms = 100 },                   // Resend until acked
+//       { .ack = 0,             .timeout_ms = 100 },                   // Settle time only
+//       { .ack = ACK_SET_MODE,  .timeout_ms = 100, .optional = true }, // Ack or settle time
+//   };
+//
+//   // task
+//   switch (hid_init_seq_poll(&seq, steps, count, platform_time_ms())) {
+//       case HID_INIT_SEND:
+//           if (send_step(seq.step)) hid_init_seq_sent(&seq, platform_time_ms());
+//           break;
+//       ...
+//   }
+//
+//   // report callback
+//   hid_init_seq_ack(&seq, steps, count, ack_code_of(report));
+//
+// A step with an ack advances as soon as the ack arrives and is resent when
+// its timeout passes without one; after HID_INIT_SEQ_MAX_ATTEMPTS sends the
+// sequence fails. An optional step moves on at the timeout instead of
+// resending, and a step without an ack just waits out its timeout.
+
+#ifndef HID_INIT_SEQ_H
+#define HID_INIT_SEQ_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Sends of one step before the sequence gives up
+#ifndef HID_INIT_SEQ_MAX_ATTEMPTS
+#define HID_INIT_SEQ_MAX_ATTEMPTS 5
+#endif
+
+typedef struct {
+    uint16_t ack;           // Driver-defined code that completes the step (0 = timer only)
+    uint16_t timeout_ms;    // Settle time, or ack wait before resending
+    bool optional;          // Move on at the timeout instead of resending
+} hid_init_step_t;
+
+typedef enum {
+    HID_INIT_SEND = 0,      // Send steps[seq.step], then call hid_init_seq_sent()
+    HID_INIT_WAIT,          // Request out, waiting for ack or timer
+    HID_INIT_DONE,          // All steps complete
+    HID_INIT_FAILED,        // A step ran out of attempts
+} hid_init_action_t;
+
+typedef struct {
+    uint8_t step;           // Current step index
+    uint8_t attempts;       // Sends of the current step
+    bool pending;           // Current step's request is out
+    bool failed;
+    uint32_t sent_ms;
+} hid_init_seq_t;
+
+static inline void hid_init_seq_reset(hid_init_seq_t* seq)
+{
+    seq->step = 0;
+    seq->attempts = 0;
+    seq->pending = false;
+    seq->failed = false;
+    seq->sent_ms = 0;
+}
+
+static inline void hid_init_seq_advance(hid_init_seq_t* seq)
+{
+    seq->step++;
+    seq->attempts = 0;
+    seq->pending = false;
+}
+
+// What the driver should do now
+static inline hid_init_action_t hid_init_seq_poll(hid_init_seq_t* seq,
+                                                  const hid_init_step_t* steps,
+                                                  uint8_t count, uint32_t now_ms)
+{
+    if (seq->failed) return HID_INIT_FAILED;
+    if (seq->step >= count) return HID_INIT_DONE;
+    if (!seq->pending) return HID_INIT_SEND;
+
+    const hid_init_step_t* step = &steps[seq->step];
+    if (now_ms - seq->sent_ms < step->timeout_ms) return HID_INIT_WAIT;
+
+    if (step->ack == 0 || step->optional) {
+        hid_init_seq_advance(seq);
+        return (seq->step >= count) ? HID_INIT_DONE : HID_INIT_SEND;
+    }
+
+    if (seq->attempts >= HID_INIT_SEQ_MAX_ATTEMPTS) {
+        seq->failed = true;
+        return HID_INIT_FAILED;
+    }
+    seq->pending = false;  // Resend
+    return HID_INIT_SEND;
+}
+
+// The current step's request went out
+static inline void hid_init_seq_sent(hid_init_seq_t* seq, uint32_t now_ms)
+{
+    seq->pending = true;
+    seq->attempts++;
+    seq->sent_ms = now_ms;
+}
+
+// An ack arrived. Advances if it completes the pending step.
+static inline bool hid_init_seq_ack(hid_init_seq_t* seq, const hid_init_step_t* steps,
+                                    uint8_t count, uint16_t ack)
+{
+    if (!seq->pending || seq->failed || seq->step >= count) return false;
+    if (ack == 0 || steps[seq->step].ack != ack) return false;
+    hid_init_seq_advance(seq);
+    return true;
+}
+
+static inline bool hid_init_seq_done(const hid_init_seq_t* seq, uint8_t count)
+{
+    return !seq->failed && seq->step >= count;
+}
+
+#endif // HID_INIT_SEQ_H
@@ -2,7 +2,9 @@
 //
 // Provides initialization, probe, and diagnostics for the MAX3421E.
 // Also overrides TinyUSB's BSP tuh_max3421_spi_xfer_api() via --wrap
-// to fix a bug where family.c hardcodes spi0 instead of MAX3421_SPI.
+// to fix a bug where family.c hardcodes spi0 instead of MAX3421_SPI, and
+// to move FIFO bursts onto DMA. Transfers stay synchronous: the HCD expects
+// the data on return, so a DMA burst is started and waited out in place.
 //
 // Pin configuration is passed via compile definitions from CMakeLists.txt:
 //   MAX3421_SPI, MAX3421_CS_PIN, MAX3421_INTR_PIN,
@@ -14,6 +16,7 @@
 
 #include "hardware/spi.h"
 #include "hardware/gpio.h"
+#include "hardware/dma.h"
 #include <stdio.h>
 
 // ISR defined in TinyUSB family.c BSP
@@ -26,6 +29,24 @@ static uint8_t max3421_revision = 0;
 bool max3421_is_detected(void) { return max3421_detected; }
 uint8_t max3421_get_revision(void) { return max3421_revision; }
 
+// MAX3421E maximum SCLK. The RP2040 SPI divider rounds down to the next
+// achievable rate (clk_peri / even prescale), e.g. 20.8 MHz at 125 MHz.
+#ifndef MAX3421_SPI_BAUD
+#define MAX3421_SPI_BAUD (26 * 1000 * 1000)
+#endif
+
+// Transfers at least this long go through DMA; shorter ones (command byte,
+// single register) are cheaper to push by hand than to set up two channels
+#ifndef MAX3421_DMA_MIN_BYTES
+#define MAX3421_DMA_MIN_BYTES 8
+#endif
+
+// DMA channel pair (-1 = not claimed, blocking SPI only)
+static int spi_dma_tx = -1;
+static int spi_dma_rx = -1;
+static dma_channel_config spi_dma_tx_cfg;
+static dma_channel_config spi_dma_rx_cfg;
+
 // SPI register write helper
 // MAX3421E command byte: reg[4:0] << 3 | dir[1] (dir=1 write, bit 1)
 static void max3421_reg_write(uint8_t reg, uint8_t val)
@@ -75,6 +96,51 @@ static bool max3421_probe(void)
     return true;
 }
 
+// Oscillator bring-up, polled from the USB host init stage. CHIPRES stops
+// the oscillator; OSCOKIRQ sets once it is stable again. TinyUSB's hcd_init
+// repeats this reset and spins on OSCOKIRQ with no timeout, so usbh only
+// calls tusb_init() after the oscillator has been seen running here.
+#define MAX3421_REG_USBIRQ   13
+#define MAX3421_REG_USBCTL   15
+#define MAX3421_OSCOKIRQ     0x01
+#define MAX3421_CHIPRES      0x20
+
+void max3421_host_start_osc(void)
+{
+    max3421_reg_write(MAX3421_REG_USBCTL, MAX3421_CHIPRES);
+    max3421_reg_write(MAX3421_REG_USBCTL, 0);
+}
+
+bool max3421_host_osc_ok(void)
+{
+    return (max3421_reg_read(MAX3421_REG_USBIRQ) & MAX3421_OSCOKIRQ) != 0;
+}
+
+// TX channel feeds SPI DR on the TX DREQ, RX channel drains it on the RX
+// DREQ. Both are always run so the RX FIFO is empty after every transfer.
+static void max3421_dma_init(void)
+{
+    spi_dma_tx = dma_claim_unused_channel(false);
+    spi_dma_rx = dma_claim_unused_channel(false);
+    if (spi_dma_tx < 0 || spi_dma_rx < 0) {
+        if (spi_dma_tx >= 0) dma_channel_unclaim(spi_dma_tx);
+        if (spi_dma_rx >= 0) dma_channel_unclaim(spi_dma_rx);
+        spi_dma_tx = spi_dma_rx = -1;
+        printf("[max3421] No free DMA channels, using blocking SPI\n");
+        return;
+    }
+
+    spi_dma_tx_cfg = dma_channel_get_default_config(spi_dma_tx);
+    channel_config_set_transfer_data_size(&spi_dma_tx_cfg, DMA_SIZE_8);
+    channel_config_set_write_increment(&spi_dma_tx_cfg, false);
+    channel_config_set_dreq(&spi_dma_tx_cfg, spi_get_dreq(MAX3421_SPI, true));
+
+    spi_dma_rx_cfg = dma_channel_get_default_config(spi_dma_rx);
+    channel_config_set_transfer_data_size(&spi_dma_rx_cfg, DMA_SIZE_8);
+    channel_config_set_read_increment(&spi_dma_rx_cfg, false);
+    channel_config_set_dreq(&spi_dma_rx_cfg, spi_get_dreq(MAX3421_SPI, false));
+}
+
 bool max3421_host_init(void)
 {
     printf("[max3421] Initializing SPI host\n");
@@ -93,14 +159,14 @@ bool max3421_host_init(void)
     gpio_set_dir(MAX3421_INTR_PIN, GPIO_IN);
     gpio_pull_up(MAX3421_INTR_PIN);
 
-    // SPI init at 16 MHz. The MAX3421E datasheet allows up to 26 MHz; the
-    // 4 MHz default in TinyUSB BSP and reference code is conservative and
-    // adds enough per-transaction latency that chunked GIP_AUTH (Xbox One
-    // dongle pass-through) exceeds Magic-X's response window — the dongle
-    // gives up partway through the chunked exchange and returns empty
-    // responses. 16 MHz is well within tolerance for short FeatherWing
-    // traces and cuts each SPI byte time by 4x, restoring auth headroom.
-    spi_init(MAX3421_SPI, 16 * 1000 * 1000);
+    // SPI init at the chip's maximum (26 MHz per datasheet). The 4 MHz
+    // default in TinyUSB BSP and reference code is conservative and adds
+    // enough per-transaction latency that chunked GIP_AUTH (Xbox One dongle
+    // pass-through) exceeds Magic-X's response window — the dongle gives up
+    // partway through the chunked exchange and returns empty responses.
+    // Short FeatherWing traces are well within tolerance at full speed.
+    uint baud = spi_init(MAX3421_SPI, MAX3421_SPI_BAUD);
+    printf("[max3421] SPI clock: %u Hz\n", baud);
     gpio_set_function(MAX3421_SCK_PIN, GPIO_FUNC_SPI);
     gpio_set_function(MAX3421_MOSI_PIN, GPIO_FUNC_SPI);
     gpio_set_function(MAX3421_MISO_PIN, GPIO_FUNC_SPI);
@@ -116,6 +182,8 @@ bool max3421_host_init(void)
     max3421_revision = max3421_reg_read(18);
     printf("[max3421] Chip detected, revision: 0x%02X\n", max3421_revision);
     max3421_detected = true;
+
+    max3421_dma_init();
     printf("[max3421] Initialization complete\n");
     return true;
 }
@@ -139,6 +207,28 @@ void max3421_host_enable_int(void)
 // modify the submodule, we use --wrap to intercept and provide the correct
 // implementation. The linker flag is set in CMakeLists.txt.
 
+// Full-duplex DMA transfer. A NULL side streams zeros out / discards in.
+// Blocks until RX drains; faster than per-byte SPI, not asynchronous.
+static bool max3421_spi_dma_xfer(uint8_t const* tx_buf, uint8_t* rx_buf, size_t xfer_bytes)
+{
+    static uint8_t dummy_tx = 0;
+    static uint8_t dummy_rx;
+    io_rw_32 *dr = &spi_get_hw(MAX3421_SPI)->dr;
+
+    channel_config_set_read_increment(&spi_dma_tx_cfg, tx_buf != NULL);
+    dma_channel_configure(spi_dma_tx, &spi_dma_tx_cfg, dr,
+                          tx_buf ? tx_buf : &dummy_tx, xfer_bytes, false);
+
+    channel_config_set_write_increment(&spi_dma_rx_cfg, rx_buf != NULL);
+    dma_channel_configure(spi_dma_rx, &spi_dma_rx_cfg,
+                          rx_buf ? rx_buf : &dummy_rx, dr, xfer_bytes, false);
+
+    // Start both together so TX never runs ahead of the RX FIFO
+    dma_start_channel_mask((1u << spi_dma_tx) | (1u << spi_dma_rx));
+    dma_channel_wait_for_finish_blocking(spi_dma_rx);
+    return true;
+}
+
 bool __wrap_tuh_max3421_spi_xfer_api(uint8_t rhport, uint8_t const* tx_buf,
                                       uint8_t* rx_buf, size_t xfer_bytes)
 {
@@ -148,6 +238,11 @@ bool __wrap_tuh_max3421_spi_xfer_api(uint8_t rhport, uint8_t const* tx_buf,
         return false;
     }
 
+    // FIFO bursts (HID reports, GIP chunks): one DMA pass, no per-byte polling
+    if (spi_dma_rx >= 0 && xfer_bytes >= MAX3421_DMA_MIN_BYTES) {
+        return max3421_spi_dma_xfer(tx_buf, rx_buf, xfer_bytes);
+    }
+
     int ret;
 
     if (tx_buf == NULL) {
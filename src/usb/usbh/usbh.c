@@ -7,6 +7,7 @@
 #include "tusb.h"
 #include "core/services/players/manager.h"
 #include "core/services/codes/codes.h"
+#include "platform/platform.h"
 #include <stdio.h>
 
 #if defined(CONFIG_MAX3421) && CFG_TUH_MAX3421
@@ -14,6 +15,13 @@ extern bool max3421_host_init(void);
 extern void max3421_host_enable_int(void);
 extern bool max3421_is_detected(void);
 extern uint8_t max3421_get_revision(void);
+extern void max3421_host_start_osc(void);
+extern bool max3421_host_osc_ok(void);
+
+// How long the init stage waits for the MAX3421E oscillator before giving up
+#ifndef MAX3421_OSC_TIMEOUT_MS
+#define MAX3421_OSC_TIMEOUT_MS 100
+#endif
 #elif defined(CONFIG_USB) && CFG_TUH_RPI_PIO_USB
 #include "pio_usb.h"
 #include "hardware/gpio.h"
@@ -40,6 +48,11 @@ void usbh_set_bt_available(bool available)
 {
     bt_hardware_present = available;
 }
+
+// How long the init stage pumps the onboard radio before reporting ready anyway
+#ifndef USBH_BT_READY_TIMEOUT_MS
+#define USBH_BT_READY_TIMEOUT_MS 3000
+#endif
 #endif
 
 // PIO USB pin definitions (configurable per board).
@@ -78,23 +91,14 @@ void usbh_set_pio_dp_pin(int8_t pin)
     pio_dp_pin_override = pin;
 }
 
-void usbh_init(void)
+// Start the host controller. The MAX3421E only gets its oscillator started
+// here; usbh_controller_start() brings up TinyUSB once it's running.
+static void usbh_controller_init(void)
 {
-    printf("[usbh] Initializing USB host\n");
-
-    hid_init();
-
 #if defined(CONFIG_MAX3421) && CFG_TUH_MAX3421
     // MAX3421E SPI USB host on rhport 1
     if (max3421_host_init()) {
-        tusb_rhport_init_t host_init = {
-            .role = TUSB_ROLE_HOST,
-            .speed = TUSB_SPEED_FULL
-        };
-        tusb_init(1, &host_init);
-        // Enable INT pin interrupt AFTER tusb_init configures the chip,
-        // otherwise a floating INT pin causes interrupt storm
-        max3421_host_enable_int();
+        max3421_host_start_osc();
     } else {
         printf("[usbh] MAX3421E not detected, USB host disabled\n");
     }
@@ -183,18 +187,102 @@ void usbh_init(void)
         tusb_init(0, &host_init);
     }
 #endif
+}
+
+#if defined(CONFIG_MAX3421) && CFG_TUH_MAX3421
+// Bring up TinyUSB on the MAX3421E once its oscillator is running
+static void usbh_controller_start(void)
+{
+    tusb_rhport_init_t host_init = {
+        .role = TUSB_ROLE_HOST,
+        .speed = TUSB_SPEED_FULL
+    };
+    tusb_init(1, &host_init);
+    // Enable INT pin interrupt AFTER tusb_init configures the chip,
+    // otherwise a floating INT pin causes interrupt storm
+    max3421_host_enable_int();
+}
+#endif
+
+// Init stages, one per main loop pass. The WAIT stages poll hardware that
+// takes a while to come up instead of blocking the other inputs on it.
+enum {
+    USBH_STAGE_HID = 0,
+    USBH_STAGE_CONTROLLER,
+    USBH_STAGE_CONTROLLER_WAIT,     // MAX3421E oscillator
+    USBH_STAGE_BT,
+    USBH_STAGE_BT_WAIT,             // Onboard radio powered on
+};
+
+static uint32_t usbh_stage_start_ms;
+
+static input_init_result_t usbh_init_stage(uint8_t stage)
+{
+    switch (stage) {
+        case USBH_STAGE_HID:
+            printf("[usbh] Initializing USB host\n");
+            hid_init();
+            return INPUT_INIT_NEXT;
+
+        case USBH_STAGE_CONTROLLER:
+            usbh_controller_init();
+            usbh_stage_start_ms = platform_time_ms();
+            return INPUT_INIT_NEXT;
+
+        case USBH_STAGE_CONTROLLER_WAIT: {
+#if defined(CONFIG_MAX3421) && CFG_TUH_MAX3421
+            if (!max3421_is_detected()) return INPUT_INIT_NEXT;
+            uint32_t elapsed = platform_time_ms() - usbh_stage_start_ms;
+            if (!max3421_host_osc_ok()) {
+                if (elapsed < MAX3421_OSC_TIMEOUT_MS) return INPUT_INIT_WAIT;
+                printf("[usbh] MAX3421E oscillator not running after %dms, USB host disabled\n",
+                       MAX3421_OSC_TIMEOUT_MS);
+                return INPUT_INIT_NEXT;
+            }
+            printf("[usbh] MAX3421E oscillator running (%lums)\n", (unsigned long)elapsed);
+            usbh_controller_start();
+#endif
+            return INPUT_INIT_NEXT;
+        }
 
 #if CFG_TUH_BTD
-    // Initialize Bluetooth transport (for USB BT dongle support)
-    bt_init(&bt_transport_usb);
+        case USBH_STAGE_BT:
+            // Initialize Bluetooth transport (for USB BT dongle support)
+            bt_init(&bt_transport_usb);
 
-    // Pico W has onboard BT - enable BTstack loop at startup
+            // Pico W has onboard BT - enable BTstack loop at startup
 #if defined(CYW43_WL_GPIO_ON) || defined(PICO_CYW43_SUPPORTED)
-    bt_hardware_present = true;
+            bt_hardware_present = true;
 #endif
+            usbh_stage_start_ms = platform_time_ms();
+            return INPUT_INIT_NEXT;
+
+        case USBH_STAGE_BT_WAIT:
+            // A dongle powers on whenever it enumerates, so only the onboard
+            // radio is waited for. Keep USB serviced while it comes up.
+            if (!bt_hardware_present || bt_is_ready()) return INPUT_INIT_NEXT;
+            usbh_task();
+            if (platform_time_ms() - usbh_stage_start_ms < USBH_BT_READY_TIMEOUT_MS) {
+                return INPUT_INIT_WAIT;
+            }
+            printf("[usbh] BT not ready after %dms, continuing\n", USBH_BT_READY_TIMEOUT_MS);
+            return INPUT_INIT_NEXT;
 #endif
 
-    printf("[usbh] Initialization complete\n");
+        default:
+            printf("[usbh] Initialization complete\n");
+            return INPUT_INIT_DONE;
+    }
+}
+
+// Blocking init for mains without staged bring-up
+void usbh_init(void)
+{
+    uint8_t stage = 0;
+    input_init_result_t result;
+    while ((result = usbh_init_stage(stage)) != INPUT_INIT_DONE) {
+        if (result == INPUT_INIT_NEXT) stage++;
+    }
 }
 
 void usbh_task(void)
@@ -260,6 +348,7 @@ const InputInterface usbh_input_interface = {
     .source = INPUT_SOURCE_USB_HOST,
     .init = usbh_init,
     .task = usbh_task,
+    .init_stage = usbh_init_stage,
     .is_connected = usbh_is_connected,
     .get_device_count = usbh_get_device_count,
 };
@@ -15,7 +15,8 @@
 // ============================================================================
 
 #define REPORT_QUEUE_SIZE      16
-#define REPORT_QUEUE_INTERVAL  15  // ms
+#define REPORT_QUEUE_RESERVE   2    // Slots kept free for ACKs while chunks are queued
+#define ACK_WAIT_TIMEOUT       500  // ms to wait for a lost ACK before moving on
 
 // Power-on and rumble commands for dongle initialization
 static const uint8_t xb1_power_on[] = {
@@ -48,7 +49,11 @@ static report_queue_item_t report_queue[REPORT_QUEUE_SIZE];
 static uint8_t queue_head = 0;
 static uint8_t queue_tail = 0;
 static uint8_t queue_count = 0;
-static uint32_t last_report_queue_sent = 0;
+
+// Chunk pacing: the controller ACKs the first, every 5th and the last chunk
+static bool waiting_ack = false;
+static uint8_t waiting_ack_cmd = 0;
+static uint32_t waiting_ack_start = 0;
 
 // ============================================================================
 // HELPER FUNCTIONS
@@ -77,12 +82,40 @@ static bool send_to_dongle(uint8_t* report, uint16_t len)
         printf("[xbone_auth] send_to_dongle: no controller registered!\n");
         return false;
     }
+    // False while the OUT endpoint is still busy with the previous report
     bool result = tuh_xinput_send_report(xbone_dev_addr, xbone_instance, report, len);
-    printf("[xbone_auth] send_to_dongle: dev=%d inst=%d len=%d result=%s\n",
-           xbone_dev_addr, xbone_instance, len, result ? "OK" : "FAILED");
+#if CFG_TUSB_DEBUG >= 2
+    // Every chunk of an auth exchange goes through here; only log when debugging
+    if (result) {
+        printf("[xbone_auth] send_to_dongle: dev=%d inst=%d len=%d cmd=0x%02x\n",
+               xbone_dev_addr, xbone_instance, len, report[0]);
+    }
+#endif
     return result;
 }
 
+// Queue chunks of outgoing_xgip back to back, stopping after one that needs
+// an ACK. Returns true once the end of the message is queued.
+static bool queue_outgoing_chunks(void)
+{
+    while (queue_count < REPORT_QUEUE_SIZE - REPORT_QUEUE_RESERVE) {
+        queue_host_report(xgip_generate_packet(&outgoing_xgip),
+                         xgip_get_packet_length(&outgoing_xgip));
+
+        bool done = !xgip_is_chunked(&outgoing_xgip) || xgip_end_of_chunk(&outgoing_xgip);
+        if (xgip_get_packet_ack(&outgoing_xgip)) {
+            waiting_ack = true;
+            waiting_ack_cmd = outgoing_xgip.header.command;
+            waiting_ack_start = platform_time_ms();
+            return done;
+        }
+        if (done) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // ============================================================================
 // PUBLIC API
 // ============================================================================
@@ -99,6 +132,7 @@ void xbone_auth_init(void)
     queue_head = 0;
     queue_tail = 0;
     queue_count = 0;
+    waiting_ack = false;
 }
 
 bool xbone_auth_is_available(void)
@@ -134,6 +168,21 @@ void xbone_auth_task(void)
         return;
     }
 
+    // Queued reports go out as soon as the endpoint takes them
+    if (queue_count > 0 && send_to_dongle(report_queue[queue_head].report,
+                                          report_queue[queue_head].len)) {
+        queue_head = (queue_head + 1) % REPORT_QUEUE_SIZE;
+        queue_count--;
+    }
+
+    if (waiting_ack) {
+        if ((platform_time_ms() - waiting_ack_start) < ACK_WAIT_TIMEOUT) {
+            return;
+        }
+        printf("[xbone_auth] ACK timeout (cmd=0x%02x), continuing\n", waiting_ack_cmd);
+        waiting_ack = false;
+    }
+
     if (state == XBONE_AUTH_SEND_CONSOLE_TO_DONGLE) {
         printf("[xbone_auth] Forwarding auth challenge to controller: type=0x%02x len=%d seq=%d\n",
                xbone_auth_get_type(), xbone_auth_get_length(), xbone_auth_get_sequence());
@@ -150,38 +199,17 @@ void xbone_auth_task(void)
         xbone_auth_set_data(xbone_auth_get_buffer(), xbone_auth_get_length(),
                            xbone_auth_get_sequence(), xbone_auth_get_type(),
                            XBONE_AUTH_WAIT_CONSOLE_TO_DONGLE);
+        state = XBONE_AUTH_WAIT_CONSOLE_TO_DONGLE;
+    }
 
-    } else if (state == XBONE_AUTH_WAIT_CONSOLE_TO_DONGLE) {
-        uint8_t* packet = xgip_generate_packet(&outgoing_xgip);
-        uint8_t packet_len = xgip_get_packet_length(&outgoing_xgip);
-        printf("[xbone_auth] Sending auth packet to controller: len=%d\n", packet_len);
-        queue_host_report(packet, packet_len);
-
-        if (!xgip_is_chunked(&outgoing_xgip) || xgip_end_of_chunk(&outgoing_xgip)) {
+    if (state == XBONE_AUTH_WAIT_CONSOLE_TO_DONGLE) {
+        if (queue_outgoing_chunks()) {
             printf("[xbone_auth] Auth challenge sent, waiting for controller response\n");
             xbone_auth_set_data(xbone_auth_get_buffer(), xbone_auth_get_length(),
                                xbone_auth_get_sequence(), xbone_auth_get_type(),
                                XBONE_AUTH_IDLE);
         }
     }
-
-    // Process report queue - send to controller
-    uint32_t now = platform_time_ms();
-    if (queue_count > 0 && (now - last_report_queue_sent) > REPORT_QUEUE_INTERVAL) {
-        uint8_t report[64];
-        uint16_t len = report_queue[queue_head].len;
-        memcpy(report, report_queue[queue_head].report, len);
-
-        printf("[xbone_auth] Sending queued report to controller: len=%d, cmd=0x%02x\n", len, report[0]);
-        if (send_to_dongle(report, len)) {
-            queue_head = (queue_head + 1) % REPORT_QUEUE_SIZE;
-            queue_count--;
-            last_report_queue_sent = now;
-        } else {
-            printf("[xbone_auth] Failed to send report to controller\n");
-            platform_sleep_ms(REPORT_QUEUE_INTERVAL);
-        }
-    }
 }
 
 void xbone_auth_register(uint8_t dev_addr, uint8_t instance)
@@ -192,6 +220,7 @@ void xbone_auth_register(uint8_t dev_addr, uint8_t instance)
 
     xgip_reset(&incoming_xgip);
     xgip_reset(&outgoing_xgip);
+    waiting_ack = false;
 
     // Ready only after the real announce → descriptor → POWER_ON handshake
     // completes (matches GP2040-CE). The source drives this at its own pace.
@@ -239,15 +268,19 @@ void xbone_auth_report_received(uint8_t dev_addr, uint8_t instance,
     xgip_parse(&incoming_xgip, report, len);
 
     if (!xgip_validate(&incoming_xgip)) {
+        // First packet may be invalid while the dongle boots; its announce follows
         printf("[xbone_auth] Invalid packet, resetting\n");
-        // First packet may be invalid, wait for dongle boot
-        platform_sleep_ms(50);
         xgip_reset(&incoming_xgip);
         return;
     }
 
     uint8_t cmd = xgip_get_command(&incoming_xgip);
 
+    // ACK payload byte 1 echoes the command it acknowledges
+    if (cmd == GIP_ACK_RESPONSE && len > 5 && report[5] == waiting_ack_cmd) {
+        waiting_ack = false;
+    }
+
     // Send ACK if required by header, OR for any chunked GIP_AUTH response.
     // The MS Xbox Wireless controller (PID 0x0B12) stops sending mid-stream
     // unless we ACK every chunk during auth, even when its own needs_ack=0.
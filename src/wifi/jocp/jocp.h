@@ -36,6 +36,7 @@ typedef enum {
     JOCP_MSG_CAPS_RES   = 0x03,     // Controller → Dongle (TCP)
     JOCP_MSG_OUTPUT_CMD = 0x04,     // Dongle → Controller (TCP)
     JOCP_MSG_TIME_SYNC  = 0x05,     // Both directions (TCP)
+    JOCP_MSG_INPUT_MULTI = 0x06,    // Controller → Dongle (UDP), several players per datagram
 } jocp_msg_type_t;
 
 // ============================================================================
@@ -165,6 +166,43 @@ typedef struct __attribute__((packed)) {
 
 _Static_assert(sizeof(jocp_input_packet_t) == 76, "JOCP input packet must be 76 bytes");
 
+// ============================================================================
+// MULTI-PLAYER INPUT (INPUT_MULTI)
+// ============================================================================
+//
+// One datagram carries every player a sender drives: header, a 4-byte count
+// block, then `count` slot entries. Each slot has its own sequence number so
+// the dongle can tell fresh state from a reordered or repeated entry without
+// relying on the datagram-level header seq. A sender may omit slots that did
+// not change since the last datagram.
+
+#define JOCP_MAX_SLOTS          4       // Player slots per sender
+
+typedef struct __attribute__((packed)) {
+    uint8_t  count;             // Slot entries that follow (1..JOCP_MAX_SLOTS)
+    uint8_t  reserved[3];
+} jocp_multi_header_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t  slot;              // Sender-side player slot (0..JOCP_MAX_SLOTS-1)
+    uint8_t  reserved;
+    uint16_t seq;               // Per-slot sequence (increments per entry sent)
+    jocp_input_t payload;
+} jocp_slot_entry_t;
+
+_Static_assert(sizeof(jocp_multi_header_t) == 4, "JOCP multi header must be 4 bytes");
+_Static_assert(sizeof(jocp_slot_entry_t) == 68, "JOCP slot entry must be 68 bytes");
+
+// Largest UDP datagram the dongle accepts (full INPUT_MULTI packet)
+#define JOCP_MAX_DATAGRAM       (sizeof(jocp_header_t) + sizeof(jocp_multi_header_t) + \
+                                 JOCP_MAX_SLOTS * sizeof(jocp_slot_entry_t))
+
+// Controllers the dongle tracks at once (all senders, all slots). The
+// wifi2usb lwipopts.h sizes its receive pools for this many.
+#ifndef JOCP_MAX_CONTROLLERS
+#define JOCP_MAX_CONTROLLERS    4
+#endif
+
 // ============================================================================
 // CAPABILITIES STRUCTURES (TCP)
 // ============================================================================
@@ -192,6 +230,11 @@ typedef struct __attribute__((packed)) {
 // ============================================================================
 // OUTPUT COMMANDS (TCP, Dongle → Controller)
 // ============================================================================
+//
+// OUTPUT_CMD payload: command byte, the command's struct below, then one
+// byte with the sender slot the command is for (the INPUT_MULTI slot, 0 for
+// a plain INPUT sender). A sender driving several players routes feedback by
+// that trailing byte; single-player senders can ignore it.
 
 typedef enum {
     JOCP_CMD_RUMBLE      = 0x01,    // Set rumble motors
@@ -229,6 +272,7 @@ typedef struct __attribute__((packed)) {
 void jocp_init(void);
 
 // Process incoming UDP packet (called from wifi_transport)
+// Accepts INPUT and INPUT_MULTI; multi packets are demultiplexed in one pass.
 // Returns true if packet was valid and processed
 bool jocp_process_input_packet(const uint8_t* data, uint16_t len,
                                uint32_t src_ip, uint16_t src_port);
@@ -239,7 +283,8 @@ uint8_t jocp_get_connected_count(void);
 // Send feedback to all connected controllers
 void jocp_send_feedback_all(const output_feedback_t* fb);
 
-// Send feedback to specific controller
+// Send feedback to one controller (dongle-side index). Commands carry the
+// controller's sender slot so multi-player senders can route them.
 void jocp_send_feedback(uint8_t controller_id, const output_feedback_t* fb);
 
 #endif // JOCP_H
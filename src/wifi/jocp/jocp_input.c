@@ -18,24 +18,28 @@
 // STATE
 // ============================================================================
 
-#define MAX_CONTROLLERS 4
-
 typedef struct {
     bool active;
     uint32_t ip;
     uint16_t port;
+    uint8_t sender_slot;        // Player slot on the sender (0 for plain INPUT)
     uint16_t last_seq;
     uint32_t last_seen_ms;
     uint32_t packet_count;
     uint32_t drop_count;
 } jocp_controller_t;
 
-static jocp_controller_t controllers[MAX_CONTROLLERS];
+static jocp_controller_t controllers[JOCP_MAX_CONTROLLERS];
 static uint8_t connected_count = 0;
 
 // Timeout for considering a controller disconnected (ms)
 #define CONTROLLER_TIMEOUT_MS 5000
 
+// A sequence step back of at most this much is a late/duplicate entry and is
+// ignored; anything further back, or a step back to seq 0, is treated as the
+// sender restarting.
+#define SEQ_REORDER_WINDOW 64
+
 // ============================================================================
 // BUTTON CONVERSION
 // ============================================================================
@@ -101,10 +105,13 @@ static uint8_t convert_trigger_u16_to_u8(uint16_t value)
 // CONTROLLER TRACKING
 // ============================================================================
 
-static int find_controller_by_ip(uint32_t ip, uint16_t port)
+// A sender is keyed by IP and UDP source port, so two senders behind one
+// address (or a sender that rebinds after a restart) get their own players
+static int find_controller_by_addr(uint32_t ip, uint16_t port, uint8_t sender_slot)
 {
-    for (int i = 0; i < MAX_CONTROLLERS; i++) {
-        if (controllers[i].active && controllers[i].ip == ip) {
+    for (int i = 0; i < JOCP_MAX_CONTROLLERS; i++) {
+        if (controllers[i].active && controllers[i].ip == ip &&
+            controllers[i].port == port && controllers[i].sender_slot == sender_slot) {
             return i;
         }
     }
@@ -113,15 +120,15 @@ static int find_controller_by_ip(uint32_t ip, uint16_t port)
 
 static int find_free_controller_slot(void)
 {
-    for (int i = 0; i < MAX_CONTROLLERS; i++) {
+    for (int i = 0; i < JOCP_MAX_CONTROLLERS; i++) {
         if (!controllers[i].active) return i;
     }
     return -1;
 }
 
-static int find_or_create_controller(uint32_t ip, uint16_t port)
+static int find_or_create_controller(uint32_t ip, uint16_t port, uint8_t sender_slot)
 {
-    int slot = find_controller_by_ip(ip, port);
+    int slot = find_controller_by_addr(ip, port, sender_slot);
     if (slot >= 0) return slot;
 
     slot = find_free_controller_slot();
@@ -133,14 +140,15 @@ static int find_or_create_controller(uint32_t ip, uint16_t port)
     controllers[slot].active = true;
     controllers[slot].ip = ip;
     controllers[slot].port = port;
+    controllers[slot].sender_slot = sender_slot;
     controllers[slot].last_seq = 0;
     controllers[slot].last_seen_ms = to_ms_since_boot(get_absolute_time());
     controllers[slot].packet_count = 0;
     controllers[slot].drop_count = 0;
     connected_count++;
 
-    printf("[jocp] New controller connected: slot %d, IP %08lX:%d\n",
-           slot, (unsigned long)ip, port);
+    printf("[jocp] New controller connected: slot %d, IP %08lX:%d (sender slot %d)\n",
+           slot, (unsigned long)ip, port, sender_slot);
 
     // Notify transport layer (to exit pairing mode)
     wifi_transport_on_controller_connected();
@@ -152,11 +160,11 @@ static void check_controller_timeouts(void)
 {
     uint32_t now = to_ms_since_boot(get_absolute_time());
 
-    for (int i = 0; i < MAX_CONTROLLERS; i++) {
+    for (int i = 0; i < JOCP_MAX_CONTROLLERS; i++) {
         if (controllers[i].active) {
             if (now - controllers[i].last_seen_ms > CONTROLLER_TIMEOUT_MS) {
-                printf("[jocp] Controller %d timed out (IP %08lX)\n",
-                       i, (unsigned long)controllers[i].ip);
+                printf("[jocp] Controller %d timed out (IP %08lX:%d)\n",
+                       i, (unsigned long)controllers[i].ip, controllers[i].port);
                 controllers[i].active = false;
                 connected_count--;
             }
@@ -175,6 +183,115 @@ void jocp_init(void)
     printf("[jocp] JOCP subsystem initialized\n");
 }
 
+// Track the sequence of one player slot. Returns false if the state is not
+// newer than what was already submitted (reordered or duplicated entry).
+static bool update_sequence(int slot, uint16_t seq, uint32_t now)
+{
+    jocp_controller_t* ctrl = &controllers[slot];
+
+    if (ctrl->packet_count > 0) {
+        int16_t delta = (int16_t)(seq - ctrl->last_seq);
+        if (delta == 0 || (delta < 0 && delta > -SEQ_REORDER_WINDOW && seq != 0)) {
+            // Sender is alive even if this entry is stale
+            ctrl->last_seen_ms = now;
+            return false;
+        }
+
+        if (delta <= 0) {
+            // New session on the same address: start tracking from this seq
+            printf("[jocp] Controller %d: sender restarted (seq %u -> %u)\n",
+                   slot, ctrl->last_seq, seq);
+        } else if (delta > 1) {
+            // Detect packet loss
+            uint16_t dropped = (uint16_t)(delta - 1);
+            ctrl->drop_count += dropped;
+            // Only log occasionally to avoid spam
+            if (ctrl->drop_count % 100 == 1) {
+                printf("[jocp] Controller %d: dropped %u packets (total %lu)\n",
+                       slot, dropped, (unsigned long)ctrl->drop_count);
+            }
+        }
+    }
+
+    ctrl->last_seq = seq;
+    ctrl->last_seen_ms = now;
+    ctrl->packet_count++;
+    return true;
+}
+
+// Convert one player's payload and submit it to the router
+static void submit_input(int slot, const jocp_input_t* input)
+{
+    // Convert to Joypad OS input event
+    input_event_t event = {0};
+
+    // Use a unique dev_addr for WiFi controllers (0xE0 + slot)
+    event.dev_addr = DEV_ADDR_WIFI_BASE + slot;
+    event.instance = 0;
+    event.type = INPUT_TYPE_GAMEPAD;
+
+    // Convert buttons
+    event.buttons = convert_buttons(input->buttons);
+
+    // Convert analog sticks (signed 16-bit → unsigned 8-bit)
+    event.analog[0] = convert_axis_s16_to_u8(input->lx);  // Left X
+    event.analog[1] = convert_axis_s16_to_u8(input->ly);  // Left Y
+    event.analog[2] = convert_axis_s16_to_u8(input->rx);  // Right X
+    event.analog[3] = convert_axis_s16_to_u8(input->ry);  // Right Y
+
+    // Convert triggers (unsigned 16-bit → unsigned 8-bit)
+    event.analog[4] = convert_trigger_u16_to_u8(input->lt);  // Left trigger
+    event.analog[5] = convert_trigger_u16_to_u8(input->rt);  // Right trigger
+
+    // Submit to router
+    router_submit_input(&event);
+}
+
+static bool process_slot(uint32_t src_ip, uint16_t src_port, uint8_t sender_slot,
+                         uint16_t seq, const jocp_input_t* input, uint32_t now)
+{
+    // Find or create controller slot
+    int slot = find_or_create_controller(src_ip, src_port, sender_slot);
+    if (slot < 0) return false;
+
+    if (update_sequence(slot, seq, now)) {
+        submit_input(slot, input);
+    }
+    return true;
+}
+
+// INPUT_MULTI: demultiplex every slot entry of the datagram in one pass
+static bool process_multi_packet(const uint8_t* data, uint16_t len,
+                                 uint32_t src_ip, uint16_t src_port, uint32_t now)
+{
+    if (len < sizeof(jocp_header_t) + sizeof(jocp_multi_header_t)) {
+        printf("[jocp] INPUT_MULTI packet too short: %d bytes\n", len);
+        return false;
+    }
+
+    const jocp_multi_header_t* multi = (const jocp_multi_header_t*)(data + sizeof(jocp_header_t));
+    if (multi->count == 0 || multi->count > JOCP_MAX_SLOTS) {
+        printf("[jocp] INPUT_MULTI bad slot count: %d\n", multi->count);
+        return false;
+    }
+
+    size_t expected = sizeof(jocp_header_t) + sizeof(jocp_multi_header_t) +
+                      multi->count * sizeof(jocp_slot_entry_t);
+    if (len < expected) {
+        printf("[jocp] INPUT_MULTI packet too short: %d bytes (expected %zu)\n",
+               len, expected);
+        return false;
+    }
+
+    const jocp_slot_entry_t* entry = (const jocp_slot_entry_t*)(multi + 1);
+    bool any = false;
+    for (uint8_t i = 0; i < multi->count; i++, entry++) {
+        if (entry->slot >= JOCP_MAX_SLOTS) continue;
+        any |= process_slot(src_ip, src_port, entry->slot, entry->seq, &entry->payload, now);
+    }
+    return any;
+}
+
 bool jocp_process_input_packet(const uint8_t* data, uint16_t len,
                                uint32_t src_ip, uint16_t src_port)
 {
@@ -210,6 +327,9 @@ bool jocp_process_input_packet(const uint8_t* data, uint16_t len,
     }
 
     // Check message type
+    if (header->msg_type == JOCP_MSG_INPUT_MULTI) {
+        return process_multi_packet(data, len, src_ip, src_port, now);
+    }
     if (header->msg_type != JOCP_MSG_INPUT) {
         printf("[jocp] Unexpected message type: 0x%02X\n", header->msg_type);
         return false;
@@ -222,54 +342,9 @@ bool jocp_process_input_packet(const uint8_t* data, uint16_t len,
         return false;
     }
 
-    // Find or create controller slot
-    int slot = find_or_create_controller(src_ip, src_port);
-    if (slot < 0) return false;
-
-    // Check sequence number (detect packet loss)
-    uint16_t expected_seq = controllers[slot].last_seq + 1;
-    if (controllers[slot].packet_count > 0 && header->seq != expected_seq) {
-        uint16_t dropped = header->seq - expected_seq;
-        controllers[slot].drop_count += dropped;
-        // Only log occasionally to avoid spam
-        if (controllers[slot].drop_count % 100 == 1) {
-            printf("[jocp] Controller %d: dropped %u packets (total %lu)\n",
-                   slot, dropped, (unsigned long)controllers[slot].drop_count);
-        }
-    }
-
-    controllers[slot].last_seq = header->seq;
-    controllers[slot].last_seen_ms = now;
-    controllers[slot].packet_count++;
-
-    // Parse input payload
+    // Single-player INPUT: sender slot 0, datagram seq is the slot seq
     const jocp_input_t* input = (const jocp_input_t*)(data + sizeof(jocp_header_t));
-
-    // Convert to Joypad OS input event
-    input_event_t event = {0};
-
-    // Use a unique dev_addr for WiFi controllers (0xE0 + slot)
-    event.dev_addr = 0xE0 + slot;
-    event.instance = 0;
-    event.type = INPUT_TYPE_GAMEPAD;
-
-    // Convert buttons
-    event.buttons = convert_buttons(input->buttons);
-
-    // Convert analog sticks (signed 16-bit → unsigned 8-bit)
-    event.analog[0] = convert_axis_s16_to_u8(input->lx);  // Left X
-    event.analog[1] = convert_axis_s16_to_u8(input->ly);  // Left Y
-    event.analog[2] = convert_axis_s16_to_u8(input->rx);  // Right X
-    event.analog[3] = convert_axis_s16_to_u8(input->ry);  // Right Y
-
-    // Convert triggers (unsigned 16-bit → unsigned 8-bit)
-    event.analog[4] = convert_trigger_u16_to_u8(input->lt);  // Left trigger
-    event.analog[5] = convert_trigger_u16_to_u8(input->rt);  // Right trigger
-
-    // Submit to router
-    router_submit_input(&event);
-
-    return true;
+    return process_slot(src_ip, src_port, 0, header->seq, input, now);
 }
 
 uint8_t jocp_get_connected_count(void)
@@ -283,20 +358,43 @@ uint8_t jocp_get_connected_count(void)
 
 void jocp_send_feedback_all(const output_feedback_t* fb)
 {
-    for (int i = 0; i < MAX_CONTROLLERS; i++) {
+    for (int i = 0; i < JOCP_MAX_CONTROLLERS; i++) {
         if (controllers[i].active) {
             jocp_send_feedback(i, fb);
         }
     }
 }
 
+// One OUTPUT_CMD: header, command byte, command payload, then the sender slot
+// the command is for (see jocp.h)
+static void send_output_cmd(int tcp_client, uint8_t slot, uint8_t cmd,
+                            const void* payload, uint16_t payload_len)
+{
+    uint8_t packet[32];
+    jocp_header_t* header = (jocp_header_t*)packet;
+
+    header->magic = JOCP_MAGIC;
+    header->version = JOCP_VERSION;
+    header->msg_type = JOCP_MSG_OUTPUT_CMD;
+    header->seq = 0;  // Not used for output
+    header->flags = 0;
+    header->timestamp_us = time_us_32();
+
+    uint8_t* body = packet + sizeof(jocp_header_t);
+    body[0] = cmd;
+    memcpy(body + 1, payload, payload_len);
+    body[1 + payload_len] = slot;
+
+    wifi_transport_send_tcp(tcp_client, packet, sizeof(jocp_header_t) + 1 + payload_len + 1);
+}
+
 // Track last feedback time per controller for rate limiting
-static uint32_t last_feedback_ms[MAX_CONTROLLERS] = {0};
+static uint32_t last_feedback_ms[JOCP_MAX_CONTROLLERS] = {0};
 #define FEEDBACK_INTERVAL_MS 50  // Send feedback at most every 50ms
 
 void jocp_send_feedback(uint8_t controller_id, const output_feedback_t* fb)
 {
-    if (controller_id >= MAX_CONTROLLERS) return;
+    if (controller_id >= JOCP_MAX_CONTROLLERS) return;
     if (!controllers[controller_id].active) return;
     if (!fb) return;
 
@@ -314,59 +412,31 @@ void jocp_send_feedback(uint8_t controller_id, const output_feedback_t* fb)
         return;
     }
 
-    // Build OUTPUT_CMD packet for rumble
-    // Always send when feedback is dirty (includes rumble=0 to stop)
+    uint8_t slot = controllers[controller_id].sender_slot;
+
+    // Rumble: always sent when feedback is dirty (includes rumble=0 to stop)
     {
-        uint8_t packet[32];
-        jocp_header_t* header = (jocp_header_t*)packet;
-
-        header->magic = JOCP_MAGIC;
-        header->version = JOCP_VERSION;
-        header->msg_type = JOCP_MSG_OUTPUT_CMD;
-        header->seq = 0;  // Not used for output
-        header->flags = 0;
-        header->timestamp_us = time_us_32();
-
-        // Rumble command
-        uint8_t* cmd = packet + sizeof(jocp_header_t);
-        cmd[0] = JOCP_CMD_RUMBLE;
-        jocp_rumble_cmd_t* rumble = (jocp_rumble_cmd_t*)(cmd + 1);
-        rumble->left_amplitude = fb->rumble_left;
-        rumble->left_brake = 0;
-        rumble->right_amplitude = fb->rumble_right;
-        rumble->right_brake = 0;
-        rumble->duration_ms = 0;  // Until changed
-
-        uint16_t len = sizeof(jocp_header_t) + 1 + sizeof(jocp_rumble_cmd_t);
-
-        printf("[jocp] Sending rumble via TCP: L=%d R=%d\n", fb->rumble_left, fb->rumble_right);
-
-        wifi_transport_send_tcp(tcp_client, packet, len);
+        jocp_rumble_cmd_t rumble = {
+            .left_amplitude = fb->rumble_left,
+            .left_brake = 0,
+            .right_amplitude = fb->rumble_right,
+            .right_brake = 0,
+            .duration_ms = 0,  // Until changed
+        };
+        printf("[jocp] Sending rumble via TCP: slot %d L=%d R=%d\n",
+               slot, fb->rumble_left, fb->rumble_right);
+        send_output_cmd(tcp_client, slot, JOCP_CMD_RUMBLE, &rumble, sizeof(rumble));
     }
 
     // Send RGB LED command if any color is set
     if (fb->led_r > 0 || fb->led_g > 0 || fb->led_b > 0) {
-        uint8_t packet[32];
-        jocp_header_t* header = (jocp_header_t*)packet;
-
-        header->magic = JOCP_MAGIC;
-        header->version = JOCP_VERSION;
-        header->msg_type = JOCP_MSG_OUTPUT_CMD;
-        header->seq = 0;
-        header->flags = 0;
-        header->timestamp_us = time_us_32();
-
-        uint8_t* cmd = packet + sizeof(jocp_header_t);
-        cmd[0] = JOCP_CMD_RGB_LED;
-        jocp_rgb_led_cmd_t* rgb = (jocp_rgb_led_cmd_t*)(cmd + 1);
-        rgb->r = fb->led_r;
-        rgb->g = fb->led_g;
-        rgb->b = fb->led_b;
-
-        uint16_t len = sizeof(jocp_header_t) + 1 + sizeof(jocp_rgb_led_cmd_t);
-
-        printf("[jocp] Sending RGB LED via TCP: R=%d G=%d B=%d\n", fb->led_r, fb->led_g, fb->led_b);
-
-        wifi_transport_send_tcp(tcp_client, packet, len);
+        jocp_rgb_led_cmd_t rgb = {
+            .r = fb->led_r,
+            .g = fb->led_g,
+            .b = fb->led_b,
+        };
+        printf("[jocp] Sending RGB LED via TCP: slot %d R=%d G=%d B=%d\n",
+               slot, fb->led_r, fb->led_g, fb->led_b);
+        send_output_cmd(tcp_client, slot, JOCP_CMD_RGB_LED, &rgb, sizeof(rgb));
     }
 }
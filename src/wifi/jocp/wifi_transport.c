@@ -22,6 +22,10 @@
 #include <stdio.h>
 #include <string.h>
 
+#if defined(JOCP_RX_CONTROLLERS) && JOCP_RX_CONTROLLERS < JOCP_MAX_CONTROLLERS
+#error "lwipopts.h receive pools are sized for fewer controllers than JOCP tracks"
+#endif
+
 // ============================================================================
 // STATE
 // ============================================================================
@@ -345,13 +349,18 @@ static void udp_recv_callback(void* arg, struct udp_pcb* pcb, struct pbuf* p,
 
     if (!p) return;
 
-    // Copy packet data (pbuf may be chained)
-    uint8_t buffer[128];
-    uint16_t len = pbuf_copy_partial(p, buffer, sizeof(buffer), 0);
-
-    // Process JOCP packet
     uint32_t src_ip = ip4_addr_get_u32(ip_2_ip4(addr));
-    jocp_process_input_packet(buffer, len, src_ip, port);
+
+    if (p->next == NULL) {
+        // Whole datagram in one pool pbuf (the normal case: a JOCP datagram
+        // is far below PBUF_POOL_BUFSIZE) - parse it in place
+        jocp_process_input_packet((const uint8_t*)p->payload, p->len, src_ip, port);
+    } else {
+        // Chained pbuf - flatten first
+        uint8_t buffer[JOCP_MAX_DATAGRAM];
+        uint16_t len = pbuf_copy_partial(p, buffer, sizeof(buffer), 0);
+        jocp_process_input_packet(buffer, len, src_ip, port);
+    }
 
     // Free pbuf
     pbuf_free(p);
@@ -362,10 +371,13 @@ int wifi_transport_send_udp(uint32_t dest_ip, uint16_t dest_port,
 {
     if (!udp_pcb || !ap_ready) return -1;
 
-    struct pbuf* p = pbuf_alloc(PBUF_TRANSPORT, len, PBUF_RAM);
+    // Reference the caller's buffer instead of copying it: udp_sendto()
+    // hands the frame to the CYW43 driver before returning, and lwIP clones
+    // PBUF_REF data itself if it has to queue it (e.g. waiting on ARP)
+    struct pbuf* p = pbuf_alloc(PBUF_TRANSPORT, len, PBUF_REF);
     if (!p) return -1;
 
-    memcpy(p->payload, data, len);
+    p->payload = (void*)data;
 
     ip_addr_t addr;
     ip4_addr_set_u32(ip_2_ip4(&addr), dest_ip);
@@ -420,6 +432,10 @@ static err_t tcp_accept_callback(void* arg, struct tcp_pcb* newpcb, err_t err)
     tcp_clients[slot].port = newpcb->remote_port;
     tcp_clients[slot].connected = true;
 
+    // Control messages are small and latency-sensitive (rumble, LEDs):
+    // send each one immediately instead of waiting for Nagle coalescing
+    tcp_nagle_disable(newpcb);
+
     tcp_arg(newpcb, (void*)(intptr_t)slot);
     tcp_recv(newpcb, tcp_recv_callback);
     tcp_err(newpcb, tcp_err_callback);
@@ -442,12 +458,10 @@ static err_t tcp_recv_callback(void* arg, struct tcp_pcb* tpcb, struct pbuf* p,
         return ERR_OK;
     }
 
-    // Copy packet data
-    uint8_t buffer[256];
-    uint16_t len = pbuf_copy_partial(p, buffer, sizeof(buffer), 0);
+    uint16_t len = p->tot_len;
 
     // Acknowledge received data
-    tcp_recved(tpcb, p->tot_len);
+    tcp_recved(tpcb, len);
     pbuf_free(p);
 
     // TODO: Process TCP control messages (CAPS_REQ, OUTPUT_CMD, etc.)
@@ -476,6 +490,9 @@ int wifi_transport_send_tcp(uint32_t client_id, const uint8_t* data, uint16_t le
     struct tcp_pcb* pcb = tcp_clients[client_id].pcb;
     if (!pcb) return -1;
 
+    // COPY: callers pass stack buffers, and TCP may need the bytes again
+    // for a retransmit long after we return. Nagle is off (see accept),
+    // so tcp_output() puts the segment on air now.
     err_t err = tcp_write(pcb, data, len, TCP_WRITE_FLAG_COPY);
     if (err != ERR_OK) return -1;
 
@@ -248,22 +248,25 @@ udpSocket.on('message', (msg, rinfo) => {
         if (cmdType === 0x01 && msg.length >= 19) {
             const leftAmp = msg.readUInt8(13);
             const rightAmp = msg.readUInt8(15);
-            console.log(`Rumble: L=${leftAmp} R=${rightAmp}`);
-            feedback = { type: 'rumble', left: leftAmp, right: rightAmp };
+            const slot = msg.length >= 20 ? msg.readUInt8(19) : 0;
+            console.log(`Rumble: slot=${slot} L=${leftAmp} R=${rightAmp}`);
+            feedback = { type: 'rumble', slot, left: leftAmp, right: rightAmp };
         }
         // PLAYER_LED = 0x02
         else if (cmdType === 0x02 && msg.length >= 14) {
             const index = msg.readUInt8(13);
-            console.log(`Player LED: ${index}`);
-            feedback = { type: 'player_led', index };
+            const slot = msg.length >= 15 ? msg.readUInt8(14) : 0;
+            console.log(`Player LED: slot=${slot} ${index}`);
+            feedback = { type: 'player_led', slot, index };
         }
         // RGB_LED = 0x03
         else if (cmdType === 0x03 && msg.length >= 16) {
             const r = msg.readUInt8(13);
             const g = msg.readUInt8(14);
             const b = msg.readUInt8(15);
-            console.log(`RGB LED: ${r}, ${g}, ${b}`);
-            feedback = { type: 'rgb_led', r, g, b };
+            const slot = msg.length >= 17 ? msg.readUInt8(16) : 0;
+            console.log(`RGB LED: slot=${slot} ${r}, ${g}, ${b}`);
+            feedback = { type: 'rgb_led', slot, r, g, b };
         }
 
         // Forward to browser
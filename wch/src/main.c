@@ -23,6 +23,7 @@
 #include "core/services/players/manager.h"
 #include "core/services/leds/leds.h"
 #include "core/services/storage/storage.h"
+#include "core/services/loadgen/loadgen.h"
 
 // App layer (apps/usb2usb/app.c)
 extern void app_init(void);
@@ -71,6 +72,12 @@ int main(void)
       printf("[joypad] Initializing input: %s\n", inputs[i]->name);
       inputs[i]->init();
     }
+    // Init is synchronous here; record it for the bring-up report
+    input_bringup_t* st = app_registry_input_bringup(i);
+    if (st) {
+      st->ready = true;
+      st->ready_ms = platform_time_ms();
+    }
   }
 
   // Publish active interfaces so shared code (CDC, router) can introspect.
@@ -84,6 +91,7 @@ int main(void)
     leds_task();
     players_task();
     storage_task();
+    loadgen_task();  // Synthetic input load (idle unless started over CDC)
 
     // Poll inputs first so outputs read the freshest router state this iteration
     for (uint8_t i = 0; i < input_count; i++) {